@@ -0,0 +1,362 @@
+// 브로드페이즈 벤치마크 (콘솔)
+// 움직이는 군중 씬에서 모든 브로드페이즈 모드의 스텝 시간을 비교하고,
+// 총알 씬에서 레이어 충돌 행렬이 내로우페이즈 판정 수를 얼마나 줄이는지 측정한다.
+// 지형 씬에서는 같은 지형 타일을 정적 콜라이더(정적 트리)와 Kinematic 강체(동적 브로드페이즈)로 두고 비교한다.
+// Engine/Core (GameObject, Transform)와 Engine/Physics 소스를 함께 빌드한다.
+#include "Core/GameObject.h"
+#include "Physics/PhysicsSystem.h"
+#include "Physics/Rigidbody2D.h"
+#include "Physics/BoxCollider2D.h"
+#include "Physics/CircleCollider.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct CrowdScene
+    {
+        std::vector<GameObject*> objects;
+        float halfExtent = 0.0f;
+
+        ~CrowdScene()
+        {
+            for (GameObject* obj : objects)
+                delete obj;
+        }
+    };
+
+    // 정사각형 영역에 무작위 속도로 움직이는 바디 배치 (중력 없음)
+    void BuildCrowd(CrowdScene& scene, int bodyCount, unsigned int seed)
+    {
+        std::mt19937 rng(seed);
+
+        // 밀도를 일정하게 유지 (바디당 약 48x48 픽셀)
+        scene.halfExtent = sqrtf(static_cast<float>(bodyCount)) * 24.0f;
+
+        std::uniform_real_distribution<float> position(-scene.halfExtent, scene.halfExtent);
+        std::uniform_real_distribution<float> velocity(-120.0f, 120.0f);
+
+        for (int i = 0; i < bodyCount; i++)
+        {
+            GameObject* obj = new GameObject();
+            obj->transform.SetPosition(position(rng), position(rng));
+
+            if (i % 2 == 0)
+            {
+                auto* box = obj->AddComponent<BoxCollider2D>();
+                box->halfSize = { 8.0f, 8.0f };
+            }
+            else
+            {
+                auto* circle = obj->AddComponent<CircleCollider>();
+                circle->radius = 8.0f;
+            }
+
+            auto* rb = obj->AddComponent<Rigidbody2D>();
+            rb->useGravity = false;
+            rb->freezeRotation = true;
+            rb->SetVelocity({ velocity(rng), velocity(rng) });
+
+            scene.objects.push_back(obj);
+        }
+    }
+
+    // 영역 밖으로 나간 바디를 반대편으로 이동 (군중 밀도 유지)
+    void WrapCrowd(CrowdScene& scene)
+    {
+        float size = scene.halfExtent * 2.0f;
+
+        for (GameObject* obj : scene.objects)
+        {
+            XMFLOAT2 pos = obj->transform.GetPosition();
+            if (pos.x < -scene.halfExtent) pos.x += size;
+            if (pos.x > scene.halfExtent) pos.x -= size;
+            if (pos.y < -scene.halfExtent) pos.y += size;
+            if (pos.y > scene.halfExtent) pos.y -= size;
+            obj->transform.SetPosition(pos.x, pos.y);
+        }
+    }
+
+    double RunMode(BroadphaseMode mode, int bodyCount, int stepCount)
+    {
+        CrowdScene scene;
+        BuildCrowd(scene, bodyCount, 1234u);
+
+        PhysicsSystem physics;
+        physics.broadphaseMode = mode;
+        physics.worldWidth = scene.halfExtent * 2.0f;
+        physics.worldHeight = scene.halfExtent * 2.0f;
+
+        for (GameObject* obj : scene.objects)
+            physics.AddGameObject(obj);
+
+        const float fixedDelta = 1.0f / 60.0f;
+
+        // 워밍업 (트리 구축, 캐시)
+        for (int i = 0; i < 10; i++)
+        {
+            physics.Step(fixedDelta);
+            WrapCrowd(scene);
+        }
+
+        auto begin = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < stepCount; i++)
+        {
+            physics.Step(fixedDelta);
+            WrapCrowd(scene);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        double totalMs = std::chrono::duration<double, std::milli>(end - begin).count();
+        physics.Clear();
+        return totalMs / stepCount;
+    }
+
+    // 총알 씬 레이어
+    const int SceneryLayer = 0;
+    const int BulletLayer = 1;
+    const int PickupLayer = 2;
+
+    // 좁은 영역에 몰린 총알(트리거) + 정적 지형 + 아이템(트리거)
+    void BuildBulletScene(CrowdScene& scene, int bulletCount, unsigned int seed)
+    {
+        std::mt19937 rng(seed);
+
+        scene.halfExtent = 600.0f;
+
+        std::uniform_real_distribution<float> position(-scene.halfExtent, scene.halfExtent);
+        std::uniform_real_distribution<float> spawn(-150.0f, 150.0f);
+        std::uniform_real_distribution<float> velocity(-400.0f, 400.0f);
+
+        for (int i = 0; i < bulletCount; i++)
+        {
+            GameObject* obj = new GameObject();
+            obj->transform.SetPosition(spawn(rng), spawn(rng));
+
+            auto* circle = obj->AddComponent<CircleCollider>();
+            circle->radius = 3.0f;
+            circle->SetTrigger(true);
+            circle->SetLayer(BulletLayer);
+
+            auto* rb = obj->AddComponent<Rigidbody2D>();
+            rb->useGravity = false;
+            rb->freezeRotation = true;
+            rb->SetVelocity({ velocity(rng), velocity(rng) });
+
+            scene.objects.push_back(obj);
+        }
+
+        for (int i = 0; i < bulletCount / 10; i++)
+        {
+            GameObject* obj = new GameObject();
+            obj->transform.SetPosition(position(rng), position(rng));
+
+            auto* box = obj->AddComponent<BoxCollider2D>();
+            box->halfSize = { 24.0f, 24.0f };
+            box->SetLayer(SceneryLayer);
+
+            scene.objects.push_back(obj);
+        }
+
+        for (int i = 0; i < bulletCount / 10; i++)
+        {
+            GameObject* obj = new GameObject();
+            obj->transform.SetPosition(spawn(rng), spawn(rng));
+
+            auto* circle = obj->AddComponent<CircleCollider>();
+            circle->radius = 6.0f;
+            circle->SetTrigger(true);
+            circle->SetLayer(PickupLayer);
+
+            scene.objects.push_back(obj);
+        }
+    }
+
+    // 총알 씬 스텝 시간 (outPairs = 스텝당 평균 내로우페이즈 판정 수, outTriggerPairs = 그중 트리거 겹침 판정 수)
+    double RunBulletScene(bool useLayerMatrix, int bulletCount, int stepCount, double& outPairs, double& outTriggerPairs)
+    {
+        CrowdScene scene;
+        BuildBulletScene(scene, bulletCount, 77u);
+
+        PhysicsSystem physics;
+        physics.broadphaseMode = BroadphaseMode::DynamicTree;
+
+        // 총알은 지형에만, 아이템은 지형/총알과 무관
+        if (useLayerMatrix)
+        {
+            physics.SetLayerCollision(BulletLayer, BulletLayer, false);
+            physics.SetLayerCollision(BulletLayer, PickupLayer, false);
+            physics.SetLayerCollision(PickupLayer, PickupLayer, false);
+            physics.SetLayerCollision(PickupLayer, SceneryLayer, false);
+        }
+
+        for (GameObject* obj : scene.objects)
+            physics.AddGameObject(obj);
+
+        const float fixedDelta = 1.0f / 60.0f;
+        long long totalPairs = 0;
+        long long totalTriggerPairs = 0;
+
+        auto begin = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < stepCount; i++)
+        {
+            physics.Step(fixedDelta);
+            WrapCrowd(scene);
+            totalPairs += physics.GetCandidatePairCount();
+            totalTriggerPairs += physics.GetTriggerPairCount();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        double totalMs = std::chrono::duration<double, std::milli>(end - begin).count();
+        outPairs = static_cast<double>(totalPairs + totalTriggerPairs) / stepCount;
+        outTriggerPairs = static_cast<double>(totalTriggerPairs) / stepCount;
+        physics.Clear();
+        return totalMs / stepCount;
+    }
+
+    // 격자 지형 타일(전체의 80%) + 그 위로 떨어지는 바디
+    // kinematicTiles = true면 타일마다 Kinematic Rigidbody2D를 붙여 동적 브로드페이즈로 처리
+    void BuildLevelScene(CrowdScene& scene, int colliderCount, bool kinematicTiles, unsigned int seed)
+    {
+        std::mt19937 rng(seed);
+
+        int tileCount = colliderCount * 4 / 5;
+        int columns = static_cast<int>(sqrtf(static_cast<float>(tileCount)));
+        scene.halfExtent = columns * 20.0f;
+
+        // 32x32 타일을 40픽셀 간격으로 (인접 타일끼리 AABB가 겹치지 않음)
+        for (int i = 0; i < tileCount; i++)
+        {
+            GameObject* obj = new GameObject();
+            obj->transform.SetPosition(-scene.halfExtent + (i % columns) * 40.0f, -scene.halfExtent + (i / columns) * 40.0f);
+
+            auto* box = obj->AddComponent<BoxCollider2D>();
+            box->halfSize = { 16.0f, 16.0f };
+
+            if (kinematicTiles)
+            {
+                auto* rb = obj->AddComponent<Rigidbody2D>();
+                rb->isKinematic = true;
+                rb->useGravity = false;
+            }
+
+            scene.objects.push_back(obj);
+        }
+
+        std::uniform_real_distribution<float> position(-scene.halfExtent, scene.halfExtent);
+
+        for (int i = tileCount; i < colliderCount; i++)
+        {
+            GameObject* obj = new GameObject();
+            obj->transform.SetPosition(position(rng), position(rng));
+
+            auto* circle = obj->AddComponent<CircleCollider>();
+            circle->radius = 4.0f;
+
+            auto* rb = obj->AddComponent<Rigidbody2D>();
+            rb->freezeRotation = true;
+
+            scene.objects.push_back(obj);
+        }
+    }
+
+    // 지형 씬 스텝 시간 (outPairs = 스텝당 평균 내로우페이즈 판정 수)
+    double RunLevelScene(BroadphaseMode mode, bool kinematicTiles, int colliderCount, int stepCount, double& outPairs)
+    {
+        CrowdScene scene;
+        BuildLevelScene(scene, colliderCount, kinematicTiles, 99u);
+
+        PhysicsSystem physics;
+        physics.broadphaseMode = mode;
+        physics.worldWidth = scene.halfExtent * 2.0f;
+        physics.worldHeight = scene.halfExtent * 2.0f;
+
+        for (GameObject* obj : scene.objects)
+            physics.AddGameObject(obj);
+
+        const float fixedDelta = 1.0f / 60.0f;
+        long long totalPairs = 0;
+
+        auto begin = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < stepCount; i++)
+        {
+            physics.Step(fixedDelta);
+            totalPairs += physics.GetCandidatePairCount();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        double totalMs = std::chrono::duration<double, std::milli>(end - begin).count();
+        outPairs = static_cast<double>(totalPairs) / stepCount;
+        physics.Clear();
+        return totalMs / stepCount;
+    }
+
+    const char* ModeName(BroadphaseMode mode)
+    {
+        switch (mode)
+        {
+        case BroadphaseMode::BruteForce:  return "BruteForce";
+        case BroadphaseMode::Quadtree:    return "Quadtree";
+        case BroadphaseMode::DynamicTree: return "DynamicTree";
+        case BroadphaseMode::SweepAndPrune: return "SweepAndPrune";
+        case BroadphaseMode::SpatialHash: return "SpatialHash";
+        }
+        return "Unknown";
+    }
+}
+
+int main()
+{
+    const int bodyCounts[] = { 250, 500, 1000, 2000 };
+    const BroadphaseMode modes[] = {
+        BroadphaseMode::BruteForce,
+        BroadphaseMode::Quadtree,
+        BroadphaseMode::DynamicTree,
+        BroadphaseMode::SweepAndPrune,
+        BroadphaseMode::SpatialHash
+    };
+
+    printf("%-8s %-14s %12s\n", "bodies", "mode", "ms/step");
+
+    for (int bodyCount : bodyCounts)
+    {
+        for (BroadphaseMode mode : modes)
+        {
+            // Brute Force는 큰 씬에서 너무 느리므로 스텝 수를 줄임
+            int stepCount = (mode == BroadphaseMode::BruteForce && bodyCount > 500) ? 10 : 30;
+
+            double msPerStep = RunMode(mode, bodyCount, stepCount);
+            printf("%-8d %-14s %12.3f\n", bodyCount, ModeName(mode), msPerStep);
+        }
+    }
+
+    // 레이어 충돌 행렬 (총알끼리/아이템 쌍 제외)
+    printf("\n%-8s %-14s %12s %16s %16s\n", "bullets", "layers", "ms/step", "narrow/step", "trigger/step");
+
+    for (bool useLayerMatrix : { false, true })
+    {
+        double pairsPerStep = 0.0;
+        double triggerPairsPerStep = 0.0;
+        double msPerStep = RunBulletScene(useLayerMatrix, 2000, 30, pairsPerStep, triggerPairsPerStep);
+        printf("%-8d %-14s %12.3f %16.0f %16.0f\n", 2000, useLayerMatrix ? "matrix" : "all", msPerStep,
+               pairsPerStep, triggerPairsPerStep);
+    }
+
+    // 정적 지형 분리 (같은 타일을 Kinematic 강체로 두면 매 스텝 동적 브로드페이즈에 포함)
+    printf("\n%-10s %-14s %-10s %12s %16s\n", "colliders", "mode", "tiles", "ms/step", "narrow/step");
+
+    for (BroadphaseMode mode : { BroadphaseMode::Quadtree, BroadphaseMode::DynamicTree })
+    {
+        for (bool kinematicTiles : { true, false })
+        {
+            double pairsPerStep = 0.0;
+            double msPerStep = RunLevelScene(mode, kinematicTiles, 10000, 30, pairsPerStep);
+            printf("%-10d %-14s %-10s %12.3f %16.0f\n", 10000, ModeName(mode),
+                   kinematicTiles ? "kinematic" : "static", msPerStep, pairsPerStep);
+        }
+    }
+
+    return 0;
+}
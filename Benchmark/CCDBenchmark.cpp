@@ -0,0 +1,142 @@
+// CCD 벤치마크 (콘솔)
+// 두께 20픽셀 벽을 향해 빠른 총알(원/회전 박스)을 쏘아 useCCD 여부별로 벽을 통과한 수와 스텝 시간을 비교한다.
+// CCD를 켠 총알이 하나라도 벽을 통과하면 1을 반환한다.
+// Engine/Core (GameObject, Transform)와 Engine/Physics 소스를 함께 빌드한다.
+#include "Core/GameObject.h"
+#include "Physics/PhysicsSystem.h"
+#include "Physics/BoxCollider2D.h"
+#include "Physics/CircleCollider.h"
+#include "Physics/Rigidbody2D.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    const float WallHalfHeight = 4000.0f;
+
+    struct BulletScene
+    {
+        std::vector<GameObject*> objects;
+        std::vector<GameObject*> bullets;
+
+        ~BulletScene()
+        {
+            for (GameObject* obj : objects)
+                delete obj;
+        }
+    };
+
+    // x = 0에 정적 벽, 왼쪽에서 오른쪽으로 날아가는 총알
+    void BuildScene(BulletScene& scene, int bulletCount, float speed, bool useCCD, unsigned int seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> height(-1500.0f, 1500.0f);
+        std::uniform_real_distribution<float> start(-3000.0f, -600.0f);
+        std::uniform_real_distribution<float> aim(-0.2f, 0.2f);
+        std::uniform_real_distribution<float> spin(-20.0f, 20.0f);
+
+        GameObject* wall = new GameObject();
+        wall->transform.SetPosition(0.0f, 0.0f);
+        auto* wallBox = wall->AddComponent<BoxCollider2D>();
+        wallBox->halfSize = { 10.0f, WallHalfHeight };
+        scene.objects.push_back(wall);
+
+        for (int i = 0; i < bulletCount; i++)
+        {
+            GameObject* obj = new GameObject();
+            obj->transform.SetPosition(start(rng), height(rng));
+
+            if (i % 2 == 0)
+            {
+                auto* circle = obj->AddComponent<CircleCollider>();
+                circle->radius = 3.0f;
+            }
+            else
+            {
+                auto* box = obj->AddComponent<BoxCollider2D>();
+                box->halfSize = { 6.0f, 2.0f };
+            }
+
+            auto* rb = obj->AddComponent<Rigidbody2D>();
+            rb->useGravity = false;
+            rb->useCCD = useCCD;
+            rb->restitution = 0.0f;
+            rb->angularDrag = 0.0f;
+
+            float angle = aim(rng);
+            rb->SetVelocity({ cosf(angle) * speed, sinf(angle) * speed });
+            if (i % 2 != 0)
+                rb->SetAngularVelocity(spin(rng));
+
+            scene.objects.push_back(obj);
+            scene.bullets.push_back(obj);
+        }
+    }
+
+    // 벽 중심을 넘어간 총알 수 (벽을 따라 미끄러져 끝을 돌아간 총알은 제외)
+    int CountTunneled(const BulletScene& scene)
+    {
+        int count = 0;
+        for (GameObject* bullet : scene.bullets)
+        {
+            XMFLOAT2 position = bullet->transform.GetPosition();
+            if (position.x > 0.0f && fabsf(position.y) < WallHalfHeight)
+                count++;
+        }
+        return count;
+    }
+}
+
+int main()
+{
+    const float fixedDelta = 1.0f / 60.0f;
+    const int StepCount = 120;
+    const int bulletCounts[] = { 100, 1000 };
+    const float speeds[] = { 3000.0f, 30000.0f };
+
+    bool allPassed = true;
+
+    printf("%-8s %-8s %-6s %12s %10s %10s %s\n", "bullets", "speed", "ccd", "ms/step", "tunneled", "ccd hits", "check");
+
+    for (int bulletCount : bulletCounts)
+    {
+        for (float speed : speeds)
+        {
+            for (bool useCCD : { false, true })
+            {
+                BulletScene scene;
+                BuildScene(scene, bulletCount, speed, useCCD, 42u);
+
+                PhysicsSystem physics;
+                physics.broadphaseMode = BroadphaseMode::DynamicTree;
+                for (GameObject* obj : scene.objects)
+                    physics.AddGameObject(obj);
+
+                int ccdHits = 0;
+                auto begin = std::chrono::high_resolution_clock::now();
+                for (int step = 0; step < StepCount; step++)
+                {
+                    physics.Step(fixedDelta);
+                    ccdHits += physics.GetCCDHitCount();
+                }
+                auto end = std::chrono::high_resolution_clock::now();
+
+                int tunneled = CountTunneled(scene);
+                bool passed = !useCCD || tunneled == 0;
+                allPassed = allPassed && passed;
+
+                double ms = std::chrono::duration<double, std::milli>(end - begin).count() / StepCount;
+                printf("%-8d %-8.0f %-6s %12.3f %10d %10d %s\n",
+                       bulletCount, speed, useCCD ? "on" : "off", ms, tunneled, ccdHits,
+                       useCCD ? (passed ? "OK" : "TUNNELED") : "-");
+
+                physics.Clear();
+            }
+        }
+    }
+
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,223 @@
+// 결정적 실행 벤치마크 (콘솔)
+// 같은 씬을 두 번 만들어(두 번째는 오브젝트를 역순으로 할당해 포인터 주소 순서가 다름) 같은 순서로 등록하고,
+// 스레드 수/SIMD 설정을 달리해 스텝마다 PhysicsSystem::ComputeStateChecksum을 비교한다.
+// 중간에 오브젝트를 제거/추가하고 CCD 강체도 섞어, 어긋난 프레임이 있으면 첫 프레임을 출력하고 1을 반환한다.
+// Engine/Core (GameObject, Transform)와 Engine/Physics 소스를 함께 빌드한다.
+#include "Core/GameObject.h"
+#include "Physics/PhysicsSystem.h"
+#include "Physics/BoxCollider2D.h"
+#include "Physics/CircleCollider.h"
+#include "Physics/Rigidbody2D.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    const int BodyCount = 3000;
+    const int LateBodyCount = 200;
+    const int StepCount = 300;
+    const int RemoveStep = 100;
+    const int AddStep = 150;
+
+    struct SceneObjects
+    {
+        std::vector<GameObject*> objects;   // 등록 순서 (할당 순서와 다를 수 있음)
+        std::vector<void*> padding;         // 할당 주소를 흩뜨리는 더미 블록
+
+        ~SceneObjects()
+        {
+            for (GameObject* obj : objects)
+                delete obj;
+            for (void* block : padding)
+                operator delete(block);
+        }
+    };
+
+    // 오브젝트 하나 설정 (index로만 결정, 할당 순서와 무관)
+    void SetupObject(GameObject* obj, int index, unsigned int seed)
+    {
+        std::mt19937 rng(seed + index * 7919u);
+        std::uniform_real_distribution<float> positionX(-900.0f, 900.0f);
+        std::uniform_real_distribution<float> positionY(-1500.0f, -20.0f);
+        std::uniform_real_distribution<float> size(3.0f, 8.0f);
+
+        obj->transform.SetPosition(positionX(rng), positionY(rng));
+        obj->transform.SetRotation(size(rng));
+
+        if (index % 2 == 0)
+        {
+            auto* box = obj->AddComponent<BoxCollider2D>();
+            box->halfSize = { size(rng), size(rng) };
+        }
+        else
+        {
+            auto* circle = obj->AddComponent<CircleCollider>();
+            circle->radius = size(rng);
+        }
+
+        auto* rb = obj->AddComponent<Rigidbody2D>();
+        rb->restitution = 0.2f;
+
+        // 일부는 빠른 CCD 총알
+        if (index % 97 == 0)
+        {
+            rb->useCCD = true;
+            rb->SetVelocity({ (index % 2 == 0) ? 2500.0f : -2500.0f, 1500.0f });
+        }
+    }
+
+    void AddWall(SceneObjects& scene, float x, float y, float halfWidth, float halfHeight)
+    {
+        GameObject* wall = new GameObject();
+        wall->transform.SetPosition(x, y);
+        auto* box = wall->AddComponent<BoxCollider2D>();
+        box->halfSize = { halfWidth, halfHeight };
+        scene.objects.push_back(wall);
+    }
+
+    // reverseAllocation = 뒤쪽 오브젝트부터 할당하고 사이사이 더미 블록 할당 (등록 순서는 같음)
+    void BuildObjects(SceneObjects& scene, std::vector<GameObject*>& outBodies, int firstIndex, int count,
+                      bool reverseAllocation)
+    {
+        std::vector<GameObject*> created(count, nullptr);
+        for (int n = 0; n < count; n++)
+        {
+            int i = reverseAllocation ? count - 1 - n : n;
+            if (reverseAllocation)
+                scene.padding.push_back(operator new(16 + (n % 7) * 24));
+            created[i] = new GameObject();
+            SetupObject(created[i], firstIndex + i, 11u);
+        }
+
+        for (GameObject* obj : created)
+        {
+            scene.objects.push_back(obj);
+            outBodies.push_back(obj);
+        }
+    }
+
+    struct RunResult
+    {
+        std::vector<uint64_t> checksums;
+        double msPerStep = 0.0;
+        double checksumUs = 0.0;
+    };
+
+    RunResult Run(bool reverseAllocation, int threadCount, bool useSIMD)
+    {
+        SceneObjects scene;
+        AddWall(scene, 0.0f, 20.0f, 1000.0f, 20.0f);
+        AddWall(scene, -1020.0f, -1000.0f, 20.0f, 1000.0f);
+        AddWall(scene, 1020.0f, -1000.0f, 20.0f, 1000.0f);
+
+        std::vector<GameObject*> bodies;
+        BuildObjects(scene, bodies, 0, BodyCount, reverseAllocation);
+
+        PhysicsSystem physics;
+        physics.broadphaseMode = BroadphaseMode::DynamicTree;
+        physics.threadCount = threadCount;
+        physics.useSIMDIntegration = useSIMD;
+        for (GameObject* obj : scene.objects)
+            physics.AddGameObject(obj);
+
+        RunResult result;
+        const float fixedDelta = 1.0f / 60.0f;
+        double stepMs = 0.0;
+        double checksumUs = 0.0;
+
+        for (int step = 0; step < StepCount; step++)
+        {
+            // 등록 변경 (두 실행 모두 같은 순서)
+            if (step == RemoveStep)
+            {
+                for (int i = 0; i < BodyCount; i += 5)
+                    physics.RemoveGameObject(bodies[i]);
+            }
+            else if (step == AddStep)
+            {
+                std::vector<GameObject*> lateBodies;
+                BuildObjects(scene, lateBodies, BodyCount, LateBodyCount, reverseAllocation);
+                for (GameObject* obj : lateBodies)
+                    physics.AddGameObject(obj);
+            }
+
+            auto begin = std::chrono::high_resolution_clock::now();
+            physics.Step(fixedDelta);
+            auto middle = std::chrono::high_resolution_clock::now();
+            result.checksums.push_back(physics.ComputeStateChecksum());
+            auto end = std::chrono::high_resolution_clock::now();
+
+            stepMs += std::chrono::duration<double, std::milli>(middle - begin).count();
+            checksumUs += std::chrono::duration<double, std::micro>(end - middle).count();
+        }
+
+        result.msPerStep = stepMs / StepCount;
+        result.checksumUs = checksumUs / StepCount;
+
+        physics.Clear();
+        return result;
+    }
+
+    // 처음 어긋난 스텝 (-1 = 모두 같음)
+    int FirstMismatch(const RunResult& a, const RunResult& b)
+    {
+        for (size_t i = 0; i < a.checksums.size() && i < b.checksums.size(); i++)
+        {
+            if (a.checksums[i] != b.checksums[i])
+                return static_cast<int>(i);
+        }
+        return a.checksums.size() == b.checksums.size() ? -1 : static_cast<int>(a.checksums.size());
+    }
+}
+
+int main()
+{
+    PhysicsSystem::SetStrictMath(true);
+
+    struct Variant
+    {
+        const char* name;
+        bool reverseAllocation;
+        int threadCount;
+        bool useSIMD;
+    };
+
+    const Variant variants[] =
+    {
+        { "reference",        false, 0, true },
+        { "reverse alloc",    true,  0, true },
+        { "1 thread",         true,  1, true },
+        { "scalar integrate", false, 4, false },
+    };
+
+    printf("%d bodies (+%d at step %d, -%d at step %d), %d steps\n",
+           BodyCount, LateBodyCount, AddStep, BodyCount / 5, RemoveStep, StepCount);
+    printf("%-18s %10s %14s %18s %s\n", "run", "ms/step", "checksum us", "final checksum", "check");
+
+    RunResult reference;
+    bool allPassed = true;
+
+    for (const Variant& variant : variants)
+    {
+        RunResult result = Run(variant.reverseAllocation, variant.threadCount, variant.useSIMD);
+        if (&variant == &variants[0])
+            reference = result;
+
+        int mismatch = FirstMismatch(reference, result);
+        allPassed = allPassed && mismatch < 0;
+
+        char check[32];
+        if (mismatch < 0)
+            snprintf(check, sizeof(check), "OK");
+        else
+            snprintf(check, sizeof(check), "DIVERGED at step %d", mismatch);
+
+        printf("%-18s %10.3f %14.2f %18llx %s\n", variant.name, result.msPerStep, result.checksumUs,
+               static_cast<unsigned long long>(result.checksums.back()), check);
+    }
+
+    PhysicsSystem::SetStrictMath(false);
+    return allPassed ? 0 : 1;
+}
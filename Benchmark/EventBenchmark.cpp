@@ -0,0 +1,205 @@
+// 충돌 이벤트 전달 벤치마크 (콘솔)
+// 서로 겹친 Trigger 격자(대부분 Stay 이벤트, 일부 열은 움직여 Enter/Exit)에서 콜백을 재정의한 컴포넌트에만 전달할 때와
+// 모든 컴포넌트를 리스너로 둘 때(이전 방식: 모든 컴포넌트 가상 호출)의 스텝 시간과 이벤트 수를 비교한다.
+// Trigger는 솔버를 거치지 않아 두 방식의 접촉이 같으므로, 콜백 호출 수가 다르거나
+// 콜백 안에서 자기 콜라이더를 제거한 오브젝트가 이벤트를 더 받으면 1을 반환한다.
+// Engine/Core (GameObject, Transform)와 Engine/Physics 소스를 함께 빌드한다.
+#include "Core/GameObject.h"
+#include "Physics/PhysicsSystem.h"
+#include "Physics/BoxCollider2D.h"
+#include "Physics/Rigidbody2D.h"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+    // 충돌 콜백이 없는 컴포넌트 (렌더러, 애니메이터 등 자리)
+    class PlainComponent : public Component
+    {
+    };
+
+    // 트리거 콜백 횟수 기록
+    class ContactCounter : public Component
+    {
+    public:
+        void OnTriggerEnter(BaseCollider* other) override { enterCount++; }
+        void OnTriggerStay(BaseCollider* other) override { stayCount++; }
+        void OnTriggerExit(BaseCollider* other) override { exitCount++; }
+
+        long long enterCount = 0;
+        long long stayCount = 0;
+        long long exitCount = 0;
+    };
+
+    // 처음 닿으면 자기 콜라이더를 제거 (이벤트 전달 중 제거)
+    class RemoveOnTouch : public Component
+    {
+    public:
+        void OnTriggerEnter(BaseCollider* other) override
+        {
+            enterCount++;
+            gameObject->RemoveComponent<BoxCollider2D>();
+        }
+
+        int enterCount = 0;
+    };
+
+    struct TriggerScene
+    {
+        std::vector<GameObject*> objects;
+        std::vector<ContactCounter*> counters;
+        std::vector<RemoveOnTouch*> removers;
+
+        ~TriggerScene()
+        {
+            for (GameObject* obj : objects)
+                delete obj;
+        }
+    };
+
+    // 이웃과 겹치는 Trigger 격자 (listenerEvery번째마다 ContactCounter, 8번째 열마다 가로로 이동)
+    // + 위에서 떨어지며 처음 닿을 때 콜라이더를 제거하는 오브젝트 (높이를 조금씩 달리해 여러 스텝에 걸쳐 닿음)
+    void BuildScene(TriggerScene& scene, int columnCount, int rowCount, int listenerEvery, int removerCount)
+    {
+        int index = 0;
+        for (int column = 0; column < columnCount; column++)
+        {
+            for (int row = 0; row < rowCount; row++, index++)
+            {
+                GameObject* obj = new GameObject();
+                obj->transform.SetPosition(column * 16.0f, row * 16.0f);
+
+                auto* box = obj->AddComponent<BoxCollider2D>();
+                box->halfSize = { 10.0f, 10.0f };
+                box->SetTrigger(true);
+
+                auto* rb = obj->AddComponent<Rigidbody2D>();
+                rb->useGravity = false;
+                rb->freezeRotation = true;
+                if (column % 8 == 0)
+                    rb->SetVelocity({ (row % 2 == 0) ? 60.0f : -60.0f, 0.0f });
+
+                for (int i = 0; i < 3; i++)
+                    obj->AddComponent<PlainComponent>();
+
+                if (index % listenerEvery == 0)
+                    scene.counters.push_back(obj->AddComponent<ContactCounter>());
+
+                scene.objects.push_back(obj);
+            }
+        }
+
+        // 제거 오브젝트는 격자 왼쪽의 정적 Trigger 바닥으로 (격자 카운터에 영향 없음)
+        GameObject* pad = new GameObject();
+        pad->transform.SetPosition(-1000.0f, 0.0f);
+        auto* padBox = pad->AddComponent<BoxCollider2D>();
+        padBox->halfSize = { removerCount * 20.0f + 20.0f, 10.0f };
+        padBox->SetTrigger(true);
+        scene.objects.push_back(pad);
+
+        for (int i = 0; i < removerCount; i++)
+        {
+            GameObject* obj = new GameObject();
+            obj->transform.SetPosition(-1000.0f + (i - removerCount * 0.5f) * 40.0f, -200.0f - i * 7.0f);
+
+            auto* box = obj->AddComponent<BoxCollider2D>();
+            box->halfSize = { 4.0f, 4.0f };
+            auto* rb = obj->AddComponent<Rigidbody2D>();
+            rb->useGravity = false;
+            rb->SetVelocity({ 0.0f, 400.0f });
+            obj->AddComponent<PlainComponent>();
+            scene.removers.push_back(obj->AddComponent<RemoveOnTouch>());
+            scene.objects.push_back(obj);
+        }
+    }
+
+    // 모든 컴포넌트가 모든 콜백을 받도록 (이전 방식과 같은 호출 대상)
+    void ListenEverywhere(TriggerScene& scene)
+    {
+        for (GameObject* obj : scene.objects)
+        {
+            for (Component* component : obj->GetComponents())
+                component->SetCollisionCallbacks(CollisionCallback_All);
+            obj->UpdateCollisionListeners();
+        }
+    }
+
+    struct RunResult
+    {
+        double msPerStep = 0.0;
+        long long events = 0;
+        long long enters = 0;
+        long long stays = 0;
+        long long exits = 0;
+        bool removersPassed = true;
+    };
+
+    RunResult Run(bool filtered, int columnCount, int rowCount, int stepCount)
+    {
+        TriggerScene scene;
+        BuildScene(scene, columnCount, rowCount, 10, 16);
+        if (!filtered)
+            ListenEverywhere(scene);
+
+        PhysicsSystem physics;
+        physics.broadphaseMode = BroadphaseMode::DynamicTree;
+        physics.allowSleeping = false;
+        for (GameObject* obj : scene.objects)
+            physics.AddGameObject(obj);
+
+        RunResult result;
+        const float fixedDelta = 1.0f / 60.0f;
+
+        auto begin = std::chrono::high_resolution_clock::now();
+        for (int step = 0; step < stepCount; step++)
+        {
+            physics.Step(fixedDelta);
+            result.events += physics.GetContactEventCount();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        result.msPerStep = std::chrono::duration<double, std::milli>(end - begin).count() / stepCount;
+
+        for (ContactCounter* counter : scene.counters)
+        {
+            result.enters += counter->enterCount;
+            result.stays += counter->stayCount;
+            result.exits += counter->exitCount;
+        }
+
+        // 제거 오브젝트는 정확히 한 번 Enter를 받고 콜라이더가 없어야 함
+        for (RemoveOnTouch* remover : scene.removers)
+        {
+            if (remover->enterCount != 1 || remover->GetGameObject()->GetComponent<BoxCollider2D>() != nullptr)
+                result.removersPassed = false;
+        }
+
+        physics.Clear();
+        return result;
+    }
+}
+
+int main()
+{
+    const int ColumnCount = 100;
+    const int RowCount = 20;
+    const int StepCount = 180;
+
+    RunResult filtered = Run(true, ColumnCount, RowCount, StepCount);
+    RunResult everyone = Run(false, ColumnCount, RowCount, StepCount);
+
+    bool callbacksMatch = filtered.enters == everyone.enters && filtered.stays == everyone.stays &&
+                          filtered.exits == everyone.exits;
+    bool removersPassed = filtered.removersPassed && everyone.removersPassed;
+
+    printf("%d trigger bodies, %d steps, 1 in 10 bodies listening\n", ColumnCount * RowCount, StepCount);
+    printf("%-14s %10s %14s %12s %12s\n", "listeners", "ms/step", "events/step", "enter", "stay");
+    printf("%-14s %10.3f %14.1f %12lld %12lld\n", "overridden",
+           filtered.msPerStep, static_cast<double>(filtered.events) / StepCount, filtered.enters, filtered.stays);
+    printf("%-14s %10.3f %14.1f %12lld %12lld\n", "all",
+           everyone.msPerStep, static_cast<double>(everyone.events) / StepCount, everyone.enters, everyone.stays);
+    printf("callbacks %s, remove-in-callback %s\n",
+           callbacksMatch ? "OK" : "MISMATCH", removersPassed ? "OK" : "FAILED");
+
+    return (callbacksMatch && removersPassed) ? 0 : 1;
+}
@@ -0,0 +1,146 @@
+// 강체 적분 벤치마크 (콘솔)
+// BodyIntegrator의 스칼라/SIMD 경로를 같은 입력으로 실행해 결과를 비교하고
+// 처리량(bodies/us)을 출력한다. 결과가 다르면 1을 반환한다.
+// Engine/Physics/BodyStore.cpp, BodyIntegrator.cpp를 함께 빌드한다.
+#include "Physics/BodyStore.h"
+#include "Physics/BodyIntegrator.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+namespace
+{
+    // 무작위 강체 상태 (플래그/물성 조합을 섞어서 모든 분기 포함)
+    void BuildBodies(BodyStore& bodies, int bodyCount, unsigned int seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(-2000.0f, 2000.0f);
+        std::uniform_real_distribution<float> velocity(-1200.0f, 1200.0f);
+        std::uniform_real_distribution<float> force(-5000.0f, 5000.0f);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        std::uniform_int_distribution<int> flagBits(0, 255);
+
+        for (int i = 0; i < bodyCount; i++)
+        {
+            int index = bodies.Add(nullptr);
+
+            bodies.positionX[index] = position(rng);
+            bodies.positionY[index] = position(rng);
+            bodies.rotation[index] = unit(rng) * 6.28f;
+            bodies.velocityX[index] = velocity(rng);
+            bodies.velocityY[index] = velocity(rng);
+            bodies.angularVelocity[index] = velocity(rng) * 0.01f;
+            bodies.forceX[index] = force(rng);
+            bodies.forceY[index] = force(rng);
+
+            // 대부분 활성 (정지 강체 약 1/8)
+            uint32_t flags = static_cast<uint32_t>(flagBits(rng));
+            if (unit(rng) < 0.875f) flags |= BodyFlag_Active;
+            bodies.flags[index] = flags;
+
+            bodies.inverseMass[index] = (unit(rng) < 0.1f) ? 0.0f : 1.0f / (0.5f + unit(rng) * 4.0f);
+            bodies.gravityScale[index] = unit(rng) * 2.0f;
+            bodies.drag[index] = (unit(rng) < 0.5f) ? 0.0f : unit(rng) * 2.0f;
+            bodies.angularDrag[index] = (unit(rng) < 0.5f) ? 0.0f : unit(rng);
+        }
+    }
+
+    // 두 저장소의 모든 필드 비교 (허용 오차 = 상대 1e-5)
+    bool Compare(const BodyStore& a, const BodyStore& b, float& outMaxError)
+    {
+        const std::vector<float> BodyStore::* fields[] = {
+            &BodyStore::positionX, &BodyStore::positionY, &BodyStore::rotation,
+            &BodyStore::previousX, &BodyStore::previousY,
+            &BodyStore::velocityX, &BodyStore::velocityY, &BodyStore::angularVelocity,
+            &BodyStore::forceX, &BodyStore::forceY, &BodyStore::torque
+        };
+
+        outMaxError = 0.0f;
+        bool same = true;
+
+        for (auto field : fields)
+        {
+            const std::vector<float>& valuesA = a.*field;
+            const std::vector<float>& valuesB = b.*field;
+
+            for (size_t i = 0; i < valuesA.size(); i++)
+            {
+                float error = fabsf(valuesA[i] - valuesB[i]);
+                float tolerance = 1e-5f * (std::max)(1.0f, fabsf(valuesA[i]));
+
+                if (error > outMaxError) outMaxError = error;
+                if (error > tolerance) same = false;
+            }
+        }
+
+        return same;
+    }
+
+    double MeasureBodiesPerMicrosecond(bool useSIMD, const BodyStore& source, int iterations, const IntegrationSettings& settings)
+    {
+        BodyStore bodies = source;
+
+        auto begin = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; i++)
+        {
+            if (useSIMD)
+                BodyIntegrator::IntegrateSIMD(bodies, settings);
+            else
+                BodyIntegrator::IntegrateScalar(bodies, settings);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        double totalUs = std::chrono::duration<double, std::micro>(end - begin).count();
+        return static_cast<double>(source.GetCount()) * iterations / totalUs;
+    }
+}
+
+int main()
+{
+    IntegrationSettings settings;
+    settings.deltaTime = 1.0f / 60.0f;
+
+    // 1. 정확성: 같은 입력으로 여러 스텝 진행 후 비교 (나머지 처리 포함 크기)
+    const int checkCounts[] = { 1, 3, 4, 7, 1001 };
+    bool allPassed = true;
+
+    for (int bodyCount : checkCounts)
+    {
+        BodyStore scalarBodies;
+        BuildBodies(scalarBodies, bodyCount, 42u);
+        BodyStore simdBodies = scalarBodies;
+
+        for (int step = 0; step < 120; step++)
+        {
+            BodyIntegrator::IntegrateScalar(scalarBodies, settings);
+            BodyIntegrator::IntegrateSIMD(simdBodies, settings);
+        }
+
+        float maxError = 0.0f;
+        bool passed = Compare(scalarBodies, simdBodies, maxError);
+        allPassed = allPassed && passed;
+
+        printf("check %-6d %s (max error %g)\n", bodyCount, passed ? "OK" : "MISMATCH", maxError);
+    }
+
+    // 2. 처리량
+    printf("\nSIMD %s\n", BodyIntegrator::IsSIMDAvailable() ? "SSE2" : "unavailable (scalar fallback)");
+    printf("%-8s %16s %16s %8s\n", "bodies", "scalar b/us", "simd b/us", "speedup");
+
+    const int bodyCounts[] = { 1000, 10000, 100000 };
+    for (int bodyCount : bodyCounts)
+    {
+        BodyStore bodies;
+        BuildBodies(bodies, bodyCount, 7u);
+
+        int iterations = (std::max)(10, 2000000 / bodyCount);
+        double scalar = MeasureBodiesPerMicrosecond(false, bodies, iterations, settings);
+        double simd = MeasureBodiesPerMicrosecond(true, bodies, iterations, settings);
+
+        printf("%-8d %16.1f %16.1f %7.2fx\n", bodyCount, scalar, simd, simd / scalar);
+    }
+
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,164 @@
+// 렌더 보간 벤치마크 (콘솔)
+// Application::run과 같은 누적기 루프로 물리를 30/60Hz 고정 스텝, 렌더를 144Hz로 돌리며
+// 일정 속도로 움직이는 강체의 프레임당 화면 이동량 편차(떨림)를 보간 유무별로 비교한다.
+// 보간했는데 이동량이 일정하지 않거나, 순간이동/수면 후에도 이전 자세를 그리면 1을 반환한다.
+// Engine/Core (GameObject, Transform)와 Engine/Physics 소스를 함께 빌드한다.
+#include "Core/GameObject.h"
+#include "Physics/PhysicsSystem.h"
+#include "Physics/CircleCollider.h"
+#include "Physics/Rigidbody2D.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+    const float RenderDelta = 1.0f / 144.0f;
+    const int FrameCount = 1440;
+    const float Speed = 300.0f;  // 픽셀/s
+
+    struct JudderResult
+    {
+        double meanMove = 0.0;     // 프레임당 평균 이동량 (픽셀)
+        double maxDeviation = 0.0; // 평균과 가장 먼 프레임 이동량 차이
+        double frameUs = 0.0;      // 프레임당 보간 조회 시간
+        int steps = 0;
+    };
+
+    JudderResult MeasureJudder(float fixedDelta, bool interpolate)
+    {
+        GameObject body;
+        body.transform.SetPosition(0.0f, 0.0f);
+        body.AddComponent<CircleCollider>()->radius = 4.0f;
+        auto* rb = body.AddComponent<Rigidbody2D>();
+        rb->useGravity = false;
+        rb->angularDrag = 0.0f;
+        rb->interpolate = interpolate;
+        rb->SetVelocity({ Speed, 0.0f });
+
+        // 자식 스프라이트도 부모 보간을 따라가야 함
+        GameObject* child = new GameObject();
+        child->transform.SetPosition(10.0f, 0.0f);
+        body.AddChild(child);
+
+        PhysicsSystem physics;
+        physics.allowSleeping = false;
+        physics.AddGameObject(&body);
+
+        JudderResult result;
+        std::vector<double> moves;
+        moves.reserve(FrameCount);
+
+        float accumulator = 0.0f;
+        float lastX = 0.0f;
+        int lastSteps = 0;
+        double queryUs = 0.0;
+
+        for (int frame = 0; frame < FrameCount; frame++)
+        {
+            accumulator += RenderDelta;
+            while (accumulator >= fixedDelta)
+            {
+                physics.Step(fixedDelta);
+                accumulator -= fixedDelta;
+                result.steps++;
+            }
+
+            float alpha = accumulator / fixedDelta;
+
+            auto begin = std::chrono::high_resolution_clock::now();
+            float x = child->transform.GetInterpolatedWorldPosition(alpha).x;
+            auto end = std::chrono::high_resolution_clock::now();
+            queryUs += std::chrono::duration<double, std::micro>(end - begin).count();
+
+            // 첫 스텝 이후부터 측정 (그 전에는 아무것도 움직이지 않음)
+            if (lastSteps > 0)
+                moves.push_back(x - lastX);
+            lastX = x;
+            lastSteps = result.steps;
+        }
+
+        double total = 0.0;
+        for (double move : moves)
+            total += move;
+        result.meanMove = total / moves.size();
+
+        for (double move : moves)
+            result.maxDeviation = (std::max)(result.maxDeviation, fabs(move - result.meanMove));
+
+        result.frameUs = queryUs / FrameCount;
+
+        physics.Clear();
+        return result;
+    }
+
+    // 순간이동 직후 / 잠든 뒤에는 보간하지 않고 현재 자세를 그리는지
+    bool CheckSnapping()
+    {
+        GameObject body;
+        body.AddComponent<CircleCollider>()->radius = 4.0f;
+        auto* rb = body.AddComponent<Rigidbody2D>();
+        rb->useGravity = false;
+        rb->SetVelocity({ Speed, 0.0f });
+
+        PhysicsSystem physics;
+        physics.AddGameObject(&body);
+
+        const float fixedDelta = 1.0f / 30.0f;
+        physics.Step(fixedDelta);
+
+        // 스텝 직후 alpha = 0이면 스텝 직전 자세
+        bool interpolates = body.transform.GetInterpolatedWorldPosition(0.0f).x < body.transform.GetPosition().x;
+
+        // 스크립트 순간이동 → 현재 자세
+        body.transform.SetPosition(1000.0f, 0.0f);
+        bool snapsOnTeleport = body.transform.GetInterpolatedWorldPosition(0.0f).x == 1000.0f;
+
+        // 멈춰서 잠들면 → 현재 자세 (마지막 이동 스텝 보간이 남지 않음)
+        rb->SetVelocity({ 0.0f, 0.0f });
+        for (int i = 0; i < 120 && !rb->IsSleeping(); i++)
+            physics.Step(fixedDelta);
+        physics.Step(fixedDelta);
+
+        XMFLOAT2 position = body.transform.GetPosition();
+        bool stillWhenSleeping = rb->IsSleeping() &&
+                                 body.transform.GetInterpolatedWorldPosition(0.0f).x == position.x;
+
+        printf("interpolates after step: %s, snaps on teleport: %s, still when sleeping: %s\n",
+               interpolates ? "yes" : "NO", snapsOnTeleport ? "yes" : "NO", stillWhenSleeping ? "yes" : "NO");
+
+        physics.Clear();
+        return interpolates && snapsOnTeleport && stillWhenSleeping;
+    }
+}
+
+int main()
+{
+    const float fixedDeltas[] = { 1.0f / 60.0f, 1.0f / 30.0f };
+    bool allPassed = true;
+
+    printf("render %.0f Hz, %d frames, body speed %.0f px/s\n", 1.0f / RenderDelta, FrameCount, Speed);
+    printf("%-8s %-12s %8s %14s %16s %10s %s\n",
+           "physics", "interpolate", "steps", "mean px/frame", "max deviation", "query us", "check");
+
+    for (float fixedDelta : fixedDeltas)
+    {
+        for (bool interpolate : { false, true })
+        {
+            JudderResult result = MeasureJudder(fixedDelta, interpolate);
+
+            // 보간하면 프레임당 이동량이 일정해야 함 (부동소수 오차 범위)
+            bool passed = !interpolate || result.maxDeviation < 0.01;
+            allPassed = allPassed && passed;
+
+            printf("%-8.0f %-12s %8d %14.3f %16.3f %10.3f %s\n",
+                   1.0f / fixedDelta, interpolate ? "on" : "off", result.steps, result.meanMove,
+                   result.maxDeviation, result.frameUs, interpolate ? (passed ? "OK" : "JUDDER") : "-");
+        }
+    }
+
+    allPassed = CheckSnapping() && allPassed;
+    return allPassed ? 0 : 1;
+}
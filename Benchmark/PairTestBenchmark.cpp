@@ -0,0 +1,250 @@
+// 쌍 판정 처리량 벤치마크 (콘솔)
+// 박스/원 콜라이더 쌍 200000개에 대해 dynamic_cast 분기(이전 방식)와 CollisionDispatch 테이블을
+// 겹침 판정(Intersects)과 접촉 생성(Collide)으로 비교한다.
+// 두 방식의 결과(겹침 여부, 법선, 접촉점)가 다르거나 테이블의 겹침 판정과 접촉 생성이 엇갈리면 1을 반환한다.
+// Engine/Core (GameObject, Transform)와 Engine/Physics 소스를 함께 빌드한다.
+#include "Core/GameObject.h"
+#include "Physics/BoxCollider2D.h"
+#include "Physics/CircleCollider.h"
+#include "Physics/CollisionDispatch.h"
+#include "Physics/ContactSolver.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    struct PairScene
+    {
+        std::vector<GameObject*> objects;
+        std::vector<BaseCollider*> colliders;
+        std::vector<std::pair<BaseCollider*, BaseCollider*>> pairs;
+
+        ~PairScene()
+        {
+            for (GameObject* obj : objects)
+                delete obj;
+        }
+    };
+
+    // 회전한 박스/원을 섞어 배치
+    void BuildScene(PairScene& scene, int colliderCount, int pairCount, unsigned int seed)
+    {
+        std::mt19937 rng(seed);
+
+        const float halfExtent = 200.0f;
+        std::uniform_real_distribution<float> position(-halfExtent, halfExtent);
+        std::uniform_real_distribution<float> size(4.0f, 16.0f);
+        std::uniform_real_distribution<float> angle(0.0f, 6.28f);
+        std::uniform_real_distribution<float> near(-24.0f, 24.0f);
+
+        for (int i = 0; i < colliderCount; i++)
+        {
+            GameObject* obj = new GameObject();
+            obj->transform.SetPosition(position(rng), position(rng));
+            obj->transform.SetRotation(angle(rng));
+
+            BaseCollider* collider;
+            if (rng() % 2 == 0)
+            {
+                auto* box = obj->AddComponent<BoxCollider2D>();
+                box->halfSize = { size(rng), size(rng) };
+                collider = box;
+            }
+            else
+            {
+                auto* circle = obj->AddComponent<CircleCollider>();
+                circle->radius = size(rng);
+                collider = circle;
+            }
+
+            scene.objects.push_back(obj);
+            scene.colliders.push_back(collider);
+        }
+
+        // 짝수 번째 콜라이더 근처로 다음 콜라이더를 옮겨 가까운 쌍을 만듦
+        for (int i = 0; i + 1 < colliderCount; i += 2)
+        {
+            XMFLOAT2 anchor = scene.objects[i]->transform.GetPosition();
+            scene.objects[i + 1]->transform.SetPosition(anchor.x + near(rng), anchor.y + near(rng));
+        }
+
+        // 쌍은 가까운 짝과 임의의 콜라이더를 섞음 (A/B 순서도 섞어 (B, A) 뒤집기 경로 포함)
+        std::uniform_int_distribution<int> pick(0, colliderCount - 1);
+        for (int i = 0; i < pairCount; i++)
+        {
+            int a = pick(rng) & ~1;
+            int b = (rng() % 4 != 0) ? a + 1 : pick(rng);
+            if (a == b || b >= colliderCount)
+                b = (a + 1) % colliderCount;
+            if (rng() % 2 == 0)
+                std::swap(a, b);
+
+            scene.pairs.push_back({ scene.colliders[a], scene.colliders[b] });
+        }
+
+        // 월드 형태 캐시는 측정에서 제외
+        for (BaseCollider* collider : scene.colliders)
+            collider->GetWorldShape();
+    }
+
+    // ========== 이전 방식 (dynamic_cast 분기, 기준값) ==========
+
+    bool IntersectsReference(BaseCollider* colliderA, BaseCollider* colliderB)
+    {
+        BoxCollider2D* boxA = dynamic_cast<BoxCollider2D*>(colliderA);
+        BoxCollider2D* boxB = dynamic_cast<BoxCollider2D*>(colliderB);
+        CircleCollider* circleA = dynamic_cast<CircleCollider*>(colliderA);
+        CircleCollider* circleB = dynamic_cast<CircleCollider*>(colliderB);
+
+        if (boxA && boxB)
+            return boxA->IntersectsOBB(boxB);
+        if (circleA && circleB)
+            return circleA->IntersectsCircle(circleB);
+        if (boxA && circleB)
+            return boxA->IntersectsCircle(circleB);
+        if (circleA && boxB)
+            return boxB->IntersectsCircle(circleA);
+        return false;
+    }
+
+    bool CollideReference(BaseCollider* colliderA, BaseCollider* colliderB, ContactManifold& outManifold)
+    {
+        outManifold.colliderA = colliderA;
+        outManifold.colliderB = colliderB;
+        outManifold.pointCount = 0;
+
+        BoxCollider2D* boxA = dynamic_cast<BoxCollider2D*>(colliderA);
+        BoxCollider2D* boxB = dynamic_cast<BoxCollider2D*>(colliderB);
+        CircleCollider* circleA = dynamic_cast<CircleCollider*>(colliderA);
+        CircleCollider* circleB = dynamic_cast<CircleCollider*>(colliderB);
+
+        if (boxA && boxB)
+            return ContactSolver::CollideBoxBox(boxA, boxB, outManifold);
+        if (circleA && circleB)
+            return ContactSolver::CollideCircleCircle(circleA, circleB, outManifold);
+
+        BoxCollider2D* box = boxA ? boxA : boxB;
+        CircleCollider* circle = circleA ? circleA : circleB;
+        if (!box || !circle)
+            return false;
+
+        if (!ContactSolver::CollideBoxCircle(box, circle, outManifold))
+            return false;
+
+        outManifold.colliderA = colliderA;
+        outManifold.colliderB = colliderB;
+        if (box == boxB)
+            outManifold.normal = { -outManifold.normal.x, -outManifold.normal.y };
+        return true;
+    }
+
+    bool SameManifold(const ContactManifold& a, const ContactManifold& b)
+    {
+        if (a.colliderA != b.colliderA || a.colliderB != b.colliderB || a.pointCount != b.pointCount)
+            return false;
+
+        if (a.normal.x != b.normal.x || a.normal.y != b.normal.y)
+            return false;
+
+        for (int i = 0; i < a.pointCount; i++)
+        {
+            if (a.points[i].position.x != b.points[i].position.x ||
+                a.points[i].position.y != b.points[i].position.y ||
+                a.points[i].separation != b.points[i].separation ||
+                a.points[i].featureId != b.points[i].featureId)
+                return false;
+        }
+
+        return true;
+    }
+}
+
+int main()
+{
+    const int ColliderCount = 2000;
+    const int PairCount = 200000;
+    const int Rounds = 10;
+
+    PairScene scene;
+    BuildScene(scene, ColliderCount, PairCount, 17u);
+
+    bool allPassed = true;
+
+    // 겹침 판정
+    std::vector<char> referenceHits(PairCount), dispatchHits(PairCount);
+    int hitCount = 0;
+
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < Rounds; round++)
+        for (int i = 0; i < PairCount; i++)
+            referenceHits[i] = IntersectsReference(scene.pairs[i].first, scene.pairs[i].second);
+    auto middle = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < Rounds; round++)
+        for (int i = 0; i < PairCount; i++)
+            dispatchHits[i] = CollisionDispatch::Intersects(scene.pairs[i].first, scene.pairs[i].second);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    bool intersectPassed = true;
+    for (int i = 0; i < PairCount; i++)
+    {
+        hitCount += dispatchHits[i];
+        if (referenceHits[i] != dispatchHits[i])
+            intersectPassed = false;
+    }
+    allPassed = allPassed && intersectPassed;
+
+    double totalPairs = static_cast<double>(PairCount) * Rounds;
+    double referenceRate = totalPairs / std::chrono::duration<double, std::micro>(middle - begin).count();
+    double dispatchRate = totalPairs / std::chrono::duration<double, std::micro>(end - middle).count();
+
+    printf("%d pairs x %d rounds (%d overlapping)\n", PairCount, Rounds, hitCount);
+    printf("%-10s %16s %16s %8s %s\n", "test", "cast pairs/us", "table pairs/us", "speedup", "check");
+    printf("%-10s %16.2f %16.2f %7.2fx %s\n", "Intersects",
+           referenceRate, dispatchRate, dispatchRate / referenceRate, intersectPassed ? "OK" : "MISMATCH");
+
+    // 접촉 생성
+    std::vector<ContactManifold> referenceManifolds(PairCount), dispatchManifolds(PairCount);
+    std::vector<char> referenceFound(PairCount), dispatchFound(PairCount);
+
+    begin = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < Rounds; round++)
+        for (int i = 0; i < PairCount; i++)
+            referenceFound[i] = CollideReference(scene.pairs[i].first, scene.pairs[i].second, referenceManifolds[i]);
+    middle = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < Rounds; round++)
+        for (int i = 0; i < PairCount; i++)
+            dispatchFound[i] = CollisionDispatch::Collide(scene.pairs[i].first, scene.pairs[i].second, dispatchManifolds[i]);
+    end = std::chrono::high_resolution_clock::now();
+
+    bool collidePassed = true;
+    for (int i = 0; i < PairCount; i++)
+    {
+        if (referenceFound[i] != dispatchFound[i] ||
+            (dispatchFound[i] && !SameManifold(referenceManifolds[i], dispatchManifolds[i])))
+            collidePassed = false;
+    }
+    allPassed = allPassed && collidePassed;
+
+    referenceRate = totalPairs / std::chrono::duration<double, std::micro>(middle - begin).count();
+    dispatchRate = totalPairs / std::chrono::duration<double, std::micro>(end - middle).count();
+
+    printf("%-10s %16.2f %16.2f %7.2fx %s\n", "Collide",
+           referenceRate, dispatchRate, dispatchRate / referenceRate, collidePassed ? "OK" : "MISMATCH");
+
+    // 겹침 판정과 접촉 생성이 같은 쌍을 겹침으로 보는지 (회전 박스 ↔ 원 포함)
+    int disagreeCount = 0;
+    for (int i = 0; i < PairCount; i++)
+    {
+        if (dispatchHits[i] != dispatchFound[i])
+            disagreeCount++;
+    }
+    allPassed = allPassed && disagreeCount == 0;
+
+    printf("Intersects vs Collide: %d disagreeing pairs %s\n", disagreeCount, disagreeCount == 0 ? "OK" : "MISMATCH");
+
+    return allPassed ? 0 : 1;
+}
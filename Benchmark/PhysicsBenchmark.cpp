@@ -0,0 +1,480 @@
+// 물리 스텝 벤치마크 모음 (콘솔, 창/D3D/XAudio 없이 실행)
+// 표준 스트레스 씬(강체 더미, 입자 비, 박스 피라미드, 정적 지형을 향한 CCD 총알, 트리거 경기장)을
+// 브로드페이즈 방식별로 고정 스텝 실행하고 스텝 시간(평균/p50/p99/최대 ns), 후보 쌍/트리거 쌍/접촉/이벤트 수,
+// 프로파일러 구간별 평균 시간, 마지막 상태 체크섬을 JSON으로 출력한다. 체크섬이 같은 커밋끼리는 같은 시뮬레이션이므로 시간을 바로 비교할 수 있다.
+// 브로드페이즈 방식은 후보 쌍만 다르고 접촉은 같아야 하므로, 한 씬에서 방식별 체크섬이 다르면 1을 반환한다.
+// 사용법: PhysicsBenchmark [--steps N] [--threads N] [--scene 이름] [--mode 이름]
+// 빌드 (Linux 예): g++ -std=c++17 -O2 -msse2 -pthread -DENGINE_HEADLESS -I Engine -I <DirectXMath Inc>
+//                  Benchmark/PhysicsBenchmark.cpp Engine/Physics/*.cpp Engine/Core/GameObject.cpp Engine/Core/Transform.cpp
+// ENGINE_HEADLESS는 콜라이더/GameObject의 렌더링 코드(DebugRenderer, D3D 텍스처, UI)를 빼고 빌드한다.
+#include "Core/GameObject.h"
+#include "Physics/PhysicsSystem.h"
+#include "Physics/BoxCollider2D.h"
+#include "Physics/CircleCollider.h"
+#include "Physics/Rigidbody2D.h"
+#include "Physics/TilemapCollider.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // Brute Force는 모든 쌍을 내로우페이즈로 넘기므로 콜라이더가 이보다 많은 씬에서는 건너뜀
+    const int BruteForceMaxColliders = 500;
+
+    struct Scene
+    {
+        std::vector<GameObject*> objects;
+        int bodyCount = 0;
+
+        ~Scene()
+        {
+            for (GameObject* obj : objects)
+                delete obj;
+        }
+    };
+
+    // 트리거 출입 횟수 (트리거 경기장 리스너)
+    class TriggerCounter : public Component
+    {
+    public:
+        void OnTriggerEnter(BaseCollider* other) override { enterCount++; }
+        void OnTriggerExit(BaseCollider* other) override { exitCount++; }
+
+        long long enterCount = 0;
+        long long exitCount = 0;
+    };
+
+    void AddStaticBox(Scene& scene, float x, float y, float halfWidth, float halfHeight, bool trigger = false)
+    {
+        GameObject* obj = new GameObject();
+        obj->transform.SetPosition(x, y);
+        auto* box = obj->AddComponent<BoxCollider2D>();
+        box->halfSize = { halfWidth, halfHeight };
+        box->SetTrigger(trigger);
+        scene.objects.push_back(obj);
+    }
+
+    GameObject* AddBody(Scene& scene, float x, float y, bool circle, float sizeX, float sizeY)
+    {
+        GameObject* obj = new GameObject();
+        obj->transform.SetPosition(x, y);
+
+        if (circle)
+        {
+            auto* collider = obj->AddComponent<CircleCollider>();
+            collider->radius = sizeX;
+        }
+        else
+        {
+            auto* collider = obj->AddComponent<BoxCollider2D>();
+            collider->halfSize = { sizeX, sizeY };
+        }
+
+        obj->AddComponent<Rigidbody2D>();
+        scene.objects.push_back(obj);
+        scene.bodyCount++;
+        return obj;
+    }
+
+    // ========== 씬 (중력은 +y, 바닥은 y = 0 아래쪽) ==========
+
+    // 상자 안으로 떨어져 쌓이는 박스/원 1000개 (접촉 많은 더미, 수면)
+    void BuildPile(Scene& scene)
+    {
+        AddStaticBox(scene, 0.0f, 20.0f, 320.0f, 20.0f);
+        AddStaticBox(scene, -340.0f, -600.0f, 20.0f, 600.0f);
+        AddStaticBox(scene, 340.0f, -600.0f, 20.0f, 600.0f);
+
+        std::mt19937 rng(1u);
+        std::uniform_real_distribution<float> positionX(-300.0f, 300.0f);
+        std::uniform_real_distribution<float> positionY(-1600.0f, -20.0f);
+        std::uniform_real_distribution<float> size(4.0f, 8.0f);
+        std::uniform_real_distribution<float> angle(0.0f, 6.28f);
+
+        for (int i = 0; i < 1000; i++)
+        {
+            float x = positionX(rng);
+            float y = positionY(rng);
+            GameObject* obj = AddBody(scene, x, y, i % 2 == 1, size(rng), size(rng));
+            obj->transform.SetRotation(angle(rng));
+            obj->GetComponent<Rigidbody2D>()->restitution = 0.1f;
+        }
+    }
+
+    // 넓은 바닥으로 떨어지는 작은 원 10000개 (대부분 서로 떨어져 있는 많은 강체)
+    void BuildRain(Scene& scene)
+    {
+        AddStaticBox(scene, 0.0f, 20.0f, 2000.0f, 20.0f);
+
+        std::mt19937 rng(2u);
+        std::uniform_real_distribution<float> positionX(-1950.0f, 1950.0f);
+        std::uniform_real_distribution<float> positionY(-6000.0f, -20.0f);
+        std::uniform_real_distribution<float> radius(2.0f, 3.0f);
+
+        for (int i = 0; i < 10000; i++)
+        {
+            float x = positionX(rng);
+            float y = positionY(rng);
+            GameObject* obj = AddBody(scene, x, y, true, radius(rng), 0.0f);
+            obj->GetComponent<Rigidbody2D>()->restitution = 0.3f;
+        }
+    }
+
+    // 20층 박스 피라미드 (210개, 깊은 접촉 섬과 솔버 수렴)
+    void BuildPyramid(Scene& scene)
+    {
+        const int Rows = 20;
+        const float HalfSize = 10.0f;
+
+        AddStaticBox(scene, 0.0f, 20.0f, 400.0f, 20.0f);
+
+        for (int row = 0; row < Rows; row++)
+        {
+            int count = Rows - row;
+            float y = -HalfSize - row * HalfSize * 2.0f;
+            float startX = -(count - 1) * HalfSize;
+
+            for (int i = 0; i < count; i++)
+            {
+                GameObject* obj = AddBody(scene, startX + i * HalfSize * 2.0f, y, false, HalfSize, HalfSize);
+                obj->GetComponent<Rigidbody2D>()->restitution = 0.0f;
+            }
+        }
+    }
+
+    // 타일맵 지형을 향해 아래로 쏘는 CCD 총알 5000개 (정적 트리 + CCD 서브스텝, 중력 없이 튕겨 나감)
+    void BuildBullets(Scene& scene)
+    {
+        const int Width = 256;
+        const int Height = 24;
+        const float TileSize = 16.0f;
+
+        std::mt19937 rng(3u);
+        std::vector<uint8_t> tiles(Width * Height, 0);
+        int groundHeight = 12;
+        for (int x = 0; x < Width; x++)
+        {
+            if (x % 4 == 0)
+                groundHeight = std::clamp(groundHeight + static_cast<int>(rng() % 5) - 2, 4, Height);
+            for (int y = Height - groundHeight; y < Height; y++)
+                tiles[y * Width + x] = 1;
+        }
+
+        GameObject* terrain = new GameObject();
+        auto* tilemap = terrain->AddComponent<TilemapCollider>();
+        tilemap->SetTileSize({ TileSize, TileSize });
+        tilemap->SetOrigin({ -Width * TileSize * 0.5f, -Height * TileSize });
+        tilemap->SetGridSize(Width, Height);
+        tilemap->SetTiles(tiles);
+        scene.objects.push_back(terrain);
+
+        std::uniform_real_distribution<float> positionX(-1900.0f, 1900.0f);
+        std::uniform_real_distribution<float> positionY(-3000.0f, -500.0f);
+        std::uniform_real_distribution<float> speedX(-800.0f, 800.0f);
+        std::uniform_real_distribution<float> speedY(2500.0f, 6000.0f);
+
+        for (int i = 0; i < 5000; i++)
+        {
+            float x = positionX(rng);
+            float y = positionY(rng);
+            bool circle = i % 2 == 0;
+            GameObject* obj = AddBody(scene, x, y, circle, circle ? 2.0f : 4.0f, 1.5f);
+
+            auto* rb = obj->GetComponent<Rigidbody2D>();
+            rb->useCCD = true;
+            rb->useGravity = false;
+            rb->restitution = 0.3f;
+            float vx = speedX(rng);
+            float vy = speedY(rng);
+            rb->SetVelocity({ vx, vy });
+        }
+    }
+
+    // 벽으로 막힌 경기장: 정적 트리거 구역 100개 + 움직이는 트리거 센서 400개 + 튀어 다니는 원 2000개 (이벤트 위주)
+    void BuildArena(Scene& scene)
+    {
+        const float HalfSize = 1000.0f;
+
+        AddStaticBox(scene, 0.0f, HalfSize + 20.0f, HalfSize + 40.0f, 20.0f);
+        AddStaticBox(scene, 0.0f, -HalfSize - 20.0f, HalfSize + 40.0f, 20.0f);
+        AddStaticBox(scene, -HalfSize - 20.0f, 0.0f, 20.0f, HalfSize);
+        AddStaticBox(scene, HalfSize + 20.0f, 0.0f, 20.0f, HalfSize);
+
+        for (int row = 0; row < 10; row++)
+        {
+            for (int column = 0; column < 10; column++)
+                AddStaticBox(scene, -900.0f + column * 200.0f, -900.0f + row * 200.0f, 60.0f, 60.0f, true);
+        }
+
+        std::mt19937 rng(4u);
+        std::uniform_real_distribution<float> position(-HalfSize + 20.0f, HalfSize - 20.0f);
+        std::uniform_real_distribution<float> speed(-200.0f, 200.0f);
+
+        for (int i = 0; i < 2400; i++)
+        {
+            float x = position(rng);
+            float y = position(rng);
+            bool sensor = i % 6 == 0;
+            GameObject* obj = AddBody(scene, x, y, !sensor, sensor ? 20.0f : 5.0f, 20.0f);
+
+            auto* rb = obj->GetComponent<Rigidbody2D>();
+            rb->useGravity = false;
+            rb->restitution = 1.0f;
+            rb->friction = 0.0f;
+            rb->angularDrag = 0.0f;
+            float vx = speed(rng);
+            float vy = speed(rng);
+            rb->SetVelocity({ vx, vy });
+
+            if (sensor)
+                obj->GetComponent<BoxCollider2D>()->SetTrigger(true);
+            else
+                obj->AddComponent<TriggerCounter>();
+        }
+    }
+
+    struct SceneEntry
+    {
+        const char* name;
+        void (*build)(Scene&);
+    };
+
+    const SceneEntry Scenes[] =
+    {
+        { "pile", BuildPile },
+        { "rain", BuildRain },
+        { "pyramid", BuildPyramid },
+        { "bullets", BuildBullets },
+        { "arena", BuildArena },
+    };
+
+    struct ModeEntry
+    {
+        const char* name;
+        BroadphaseMode mode;
+    };
+
+    const ModeEntry Modes[] =
+    {
+        { "BruteForce", BroadphaseMode::BruteForce },
+        { "Quadtree", BroadphaseMode::Quadtree },
+        { "DynamicTree", BroadphaseMode::DynamicTree },
+        { "SweepAndPrune", BroadphaseMode::SweepAndPrune },
+        { "SpatialHash", BroadphaseMode::SpatialHash },
+    };
+
+    struct Options
+    {
+        int steps = 300;
+        int threads = 1;            // 기본 단일 스레드 (머신 코어 수와 무관하게 커밋 간 비교)
+        const char* scene = nullptr;
+        const char* mode = nullptr;
+    };
+
+    struct RunResult
+    {
+        int bodies = 0;
+        int colliders = 0;
+        long long firstStepNs = 0;
+        double meanNs = 0.0;
+        long long p50Ns = 0;
+        long long p99Ns = 0;
+        long long maxNs = 0;
+        double candidatePairs = 0.0;  // 스텝 평균
+        double triggerPairs = 0.0;
+        double contacts = 0.0;
+        double events = 0.0;
+        long long ccdHits = 0;        // 전체
+        PhysicsStepStats average;     // 프로파일러 평균 (첫 스텝 제외)
+        uint64_t checksum = 0;
+    };
+
+    // 정렬된 값의 백분위수 (nearest-rank)
+    long long Percentile(const std::vector<long long>& sorted, double percent)
+    {
+        size_t rank = static_cast<size_t>(percent / 100.0 * sorted.size() + 0.999999);
+        rank = std::clamp<size_t>(rank, 1, sorted.size());
+        return sorted[rank - 1];
+    }
+
+    RunResult Run(const SceneEntry& sceneEntry, BroadphaseMode mode, const Options& options)
+    {
+        Scene scene;
+        sceneEntry.build(scene);
+
+        PhysicsSystem physics;
+        physics.broadphaseMode = mode;
+        physics.threadCount = options.threads;
+        physics.profileSteps = true;
+        physics.SetProfileHistorySize(options.steps);
+        for (GameObject* obj : scene.objects)
+            physics.AddGameObject(obj);
+
+        RunResult result;
+        result.bodies = physics.GetBodyCount();
+        result.colliders = physics.GetColliderCount();
+
+        const float fixedDelta = 1.0f / 60.0f;
+        std::vector<long long> stepNs;
+        stepNs.reserve(options.steps);
+
+        long long candidatePairs = 0;
+        long long triggerPairs = 0;
+        long long contacts = 0;
+        long long events = 0;
+
+        for (int step = 0; step < options.steps; step++)
+        {
+            auto begin = std::chrono::steady_clock::now();
+            physics.Step(fixedDelta);
+            auto end = std::chrono::steady_clock::now();
+
+            long long ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+
+            // 첫 스텝은 트리/프록시 생성이 들어가므로 따로 기록
+            if (step == 0)
+                result.firstStepNs = ns;
+            else
+                stepNs.push_back(ns);
+
+            candidatePairs += physics.GetCandidatePairCount();
+            triggerPairs += physics.GetTriggerPairCount();
+            contacts += static_cast<long long>(physics.GetContactManifolds().size());
+            events += physics.GetContactEventCount();
+            result.ccdHits += physics.GetCCDHitCount();
+        }
+
+        if (!stepNs.empty())
+        {
+            long long total = 0;
+            for (long long ns : stepNs)
+                total += ns;
+
+            std::sort(stepNs.begin(), stepNs.end());
+            result.meanNs = static_cast<double>(total) / stepNs.size();
+            result.p50Ns = Percentile(stepNs, 50.0);
+            result.p99Ns = Percentile(stepNs, 99.0);
+            result.maxNs = stepNs.back();
+        }
+
+        result.candidatePairs = static_cast<double>(candidatePairs) / options.steps;
+        result.triggerPairs = static_cast<double>(triggerPairs) / options.steps;
+        result.contacts = static_cast<double>(contacts) / options.steps;
+        result.events = static_cast<double>(events) / options.steps;
+        result.average = physics.GetProfiler().ComputeAverage(options.steps - 1);
+        result.checksum = physics.ComputeStateChecksum();
+
+        physics.Clear();
+        return result;
+    }
+
+    bool ParseOptions(int argc, char** argv, Options& outOptions)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            bool hasValue = i + 1 < argc;
+            if (strcmp(argv[i], "--steps") == 0 && hasValue)
+                outOptions.steps = atoi(argv[++i]);
+            else if (strcmp(argv[i], "--threads") == 0 && hasValue)
+                outOptions.threads = atoi(argv[++i]);
+            else if (strcmp(argv[i], "--scene") == 0 && hasValue)
+                outOptions.scene = argv[++i];
+            else if (strcmp(argv[i], "--mode") == 0 && hasValue)
+                outOptions.mode = argv[++i];
+            else
+                return false;
+        }
+        return outOptions.steps > 1 && outOptions.threads >= 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        fprintf(stderr, "usage: PhysicsBenchmark [--steps N] [--threads N] [--scene name] [--mode name]\n");
+        return 1;
+    }
+
+    printf("{\n");
+    printf("  \"benchmark\": \"physics_step\",\n");
+    printf("  \"steps\": %d,\n", options.steps);
+    printf("  \"fixed_delta\": %.6f,\n", 1.0f / 60.0f);
+    printf("  \"threads\": %d,\n", options.threads);
+    printf("  \"results\": [");
+
+    bool first = true;
+    bool checksumsMatch = true;
+
+    for (const SceneEntry& sceneEntry : Scenes)
+    {
+        if (options.scene && strcmp(options.scene, sceneEntry.name) != 0)
+            continue;
+
+        bool hasChecksum = false;
+        uint64_t sceneChecksum = 0;
+
+        for (const ModeEntry& modeEntry : Modes)
+        {
+            if (options.mode && strcmp(options.mode, modeEntry.name) != 0)
+                continue;
+
+            printf("%s\n    { \"scene\": \"%s\", \"mode\": \"%s\", ", first ? "" : ",", sceneEntry.name, modeEntry.name);
+            first = false;
+
+            // Brute Force는 작은 씬에서만 (씬을 만들어 콜라이더 수 확인)
+            if (modeEntry.mode == BroadphaseMode::BruteForce)
+            {
+                PhysicsSystem probe;
+                Scene scene;
+                sceneEntry.build(scene);
+                for (GameObject* obj : scene.objects)
+                    probe.AddGameObject(obj);
+                int colliderCount = probe.GetColliderCount();
+                probe.Clear();
+
+                if (colliderCount > BruteForceMaxColliders)
+                {
+                    printf("\"skipped\": \"more than %d colliders\" }", BruteForceMaxColliders);
+                    fflush(stdout);
+                    continue;
+                }
+            }
+
+            RunResult result = Run(sceneEntry, modeEntry.mode, options);
+            if (hasChecksum && result.checksum != sceneChecksum)
+                checksumsMatch = false;
+            hasChecksum = true;
+            sceneChecksum = result.checksum;
+
+            printf("\"bodies\": %d, \"colliders\": %d, \"first_step_ns\": %lld, \"mean_ns\": %.0f, "
+                   "\"p50_ns\": %lld, \"p99_ns\": %lld, \"max_ns\": %lld, "
+                   "\"candidate_pairs\": %.1f, \"trigger_pairs\": %.1f, \"contacts\": %.1f, \"events\": %.1f, "
+                   "\"ccd_hits\": %lld, \"quadtree_nodes\": %d, \"phases_ns\": {",
+                   result.bodies, result.colliders, result.firstStepNs, result.meanNs,
+                   result.p50Ns, result.p99Ns, result.maxNs,
+                   result.candidatePairs, result.triggerPairs, result.contacts, result.events, result.ccdHits,
+                   result.average.quadtreeNodeCount);
+
+            for (int phase = 0; phase < static_cast<int>(PhysicsPhase::Count); phase++)
+            {
+                printf("%s\"%s\": %lld", phase == 0 ? " " : ", ",
+                       PhysicsProfiler::GetPhaseName(static_cast<PhysicsPhase>(phase)),
+                       static_cast<long long>(result.average.phaseNs[phase]));
+            }
+
+            printf(" }, \"checksum\": \"%016llx\" }", static_cast<unsigned long long>(result.checksum));
+            fflush(stdout);
+        }
+    }
+
+    printf("\n  ],\n");
+    printf("  \"checksums_match\": %s\n}\n", checksumsMatch ? "true" : "false");
+    return checksumsMatch ? 0 : 1;
+}
@@ -0,0 +1,197 @@
+// 공간 쿼리 벤치마크 (콘솔)
+// 정적 콜라이더 5000개에 레이 10000개를 쏘아 트리 가속 Raycast와 전수 검사를 비교한다.
+// 가장 가까운 히트가 다르면 1을 반환한다.
+// Engine/Core (GameObject, Transform)와 Engine/Physics 소스를 함께 빌드한다.
+#include "Core/GameObject.h"
+#include "Physics/PhysicsSystem.h"
+#include "Physics/BoxCollider2D.h"
+#include "Physics/CircleCollider.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct QueryScene
+    {
+        std::vector<GameObject*> objects;
+        std::vector<BaseCollider*> colliders;
+        float halfExtent = 0.0f;
+
+        ~QueryScene()
+        {
+            for (GameObject* obj : objects)
+                delete obj;
+        }
+    };
+
+    struct Ray
+    {
+        XMFLOAT2 origin;
+        XMFLOAT2 direction;
+    };
+
+    // 회전한 박스/원을 섞어 배치 (Rigidbody 없음 = 정적)
+    void BuildScene(QueryScene& scene, int colliderCount, unsigned int seed)
+    {
+        std::mt19937 rng(seed);
+
+        scene.halfExtent = sqrtf(static_cast<float>(colliderCount)) * 40.0f;
+
+        std::uniform_real_distribution<float> position(-scene.halfExtent, scene.halfExtent);
+        std::uniform_real_distribution<float> size(4.0f, 16.0f);
+        std::uniform_real_distribution<float> angle(0.0f, 6.28f);
+
+        for (int i = 0; i < colliderCount; i++)
+        {
+            GameObject* obj = new GameObject();
+            obj->transform.SetPosition(position(rng), position(rng));
+            obj->transform.SetRotation(angle(rng));
+
+            BaseCollider* collider;
+            if (i % 2 == 0)
+            {
+                auto* box = obj->AddComponent<BoxCollider2D>();
+                box->halfSize = { size(rng), size(rng) };
+                collider = box;
+            }
+            else
+            {
+                auto* circle = obj->AddComponent<CircleCollider>();
+                circle->radius = size(rng);
+                collider = circle;
+            }
+
+            scene.objects.push_back(obj);
+            scene.colliders.push_back(collider);
+        }
+    }
+
+    void BuildRays(std::vector<Ray>& rays, int rayCount, float halfExtent, unsigned int seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(-halfExtent, halfExtent);
+        std::uniform_real_distribution<float> angle(0.0f, 6.28f);
+
+        rays.resize(rayCount);
+        for (Ray& ray : rays)
+        {
+            float a = angle(rng);
+            ray.origin = { position(rng), position(rng) };
+            ray.direction = { cosf(a), sinf(a) };
+        }
+    }
+
+    // 전수 검사 (기준값)
+    bool RaycastBruteForce(const std::vector<BaseCollider*>& colliders, const Ray& ray, float maxDistance,
+                           RaycastHit& outHit)
+    {
+        bool found = false;
+        RaycastHit hit;
+        QueryShape shape;
+
+        for (BaseCollider* collider : colliders)
+        {
+            if (!QueryShape::FromCollider(collider, shape))
+                continue;
+
+            if (ShapeQuery::Raycast(shape, ray.origin, ray.direction, maxDistance, hit) &&
+                (!found || hit.distance < outHit.distance))
+            {
+                outHit = hit;
+                outHit.collider = collider;
+                found = true;
+            }
+        }
+
+        return found;
+    }
+}
+
+int main()
+{
+    const int ColliderCount = 5000;
+    const int RayCount = 10000;
+
+    QueryScene scene;
+    BuildScene(scene, ColliderCount, 99u);
+
+    std::vector<Ray> rays;
+    BuildRays(rays, RayCount, scene.halfExtent, 5u);
+
+    PhysicsSystem physics;
+    for (GameObject* obj : scene.objects)
+        physics.AddGameObject(obj);
+
+    // 트리 구축은 첫 쿼리에서 (측정에서 제외)
+    physics.SyncTransforms();
+
+    const float maxDistances[] = { 100.0f, 1000.0f, scene.halfExtent * 2.0f };
+    bool allPassed = true;
+
+    printf("%d colliders, %d rays\n", ColliderCount, RayCount);
+    printf("%-10s %8s %14s %14s %8s %s\n", "distance", "hits", "tree us/ray", "brute us/ray", "speedup", "check");
+
+    for (float maxDistance : maxDistances)
+    {
+        std::vector<RaycastHit> treeHits(RayCount);
+        std::vector<RaycastHit> bruteHits(RayCount);
+        std::vector<char> treeFound(RayCount), bruteFound(RayCount);
+
+        auto begin = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < RayCount; i++)
+            treeFound[i] = physics.Raycast(rays[i].origin, rays[i].direction, maxDistance, treeHits[i]);
+        auto middle = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < RayCount; i++)
+            bruteFound[i] = RaycastBruteForce(scene.colliders, rays[i], maxDistance, bruteHits[i]);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        // 같은 콜라이더거나 같은 거리면 일치 (같은 거리에 여러 콜라이더가 닿을 수 있고,
+        // 원을 스치는 레이는 방향 정규화 오차가 거리 차이로 커짐)
+        int hitCount = 0;
+        bool passed = true;
+        for (int i = 0; i < RayCount; i++)
+        {
+            if (treeFound[i] != bruteFound[i])
+            {
+                passed = false;
+                continue;
+            }
+
+            if (treeFound[i])
+            {
+                hitCount++;
+                float tolerance = 1e-5f * (std::max)(1.0f, bruteHits[i].distance);
+                if (treeHits[i].collider != bruteHits[i].collider &&
+                    fabsf(treeHits[i].distance - bruteHits[i].distance) > tolerance)
+                    passed = false;
+            }
+        }
+        allPassed = allPassed && passed;
+
+        double treeUs = std::chrono::duration<double, std::micro>(middle - begin).count() / RayCount;
+        double bruteUs = std::chrono::duration<double, std::micro>(end - middle).count() / RayCount;
+
+        printf("%-10.0f %8d %14.3f %14.3f %7.1fx %s\n",
+               maxDistance, hitCount, treeUs, bruteUs, bruteUs / treeUs, passed ? "OK" : "MISMATCH");
+    }
+
+    // 겹침 쿼리 처리량 (반경 64 원)
+    BaseCollider* results[64];
+    long long totalFound = 0;
+
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (const Ray& ray : rays)
+        totalFound += physics.OverlapCircle(ray.origin, 64.0f, results, 64);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double overlapUs = std::chrono::duration<double, std::micro>(end - begin).count() / RayCount;
+    printf("\nOverlapCircle r=64: %.3f us/query (avg %.2f colliders)\n",
+           overlapUs, static_cast<double>(totalFound) / RayCount);
+
+    physics.Clear();
+    return allPassed ? 0 : 1;
+}
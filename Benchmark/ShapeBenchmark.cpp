@@ -0,0 +1,487 @@
+// 볼록 다각형/캡슐 콜라이더 벤치마크 (콘솔)
+// 1. 같은 배치의 박스 쌍을 BoxCollider2D와 박스 모양 PolygonCollider2D로 만들어 겹침/접촉 결과를 비교하고
+//    쌍당 시간(박스는 매번 변 법선을 계산, 다각형은 캐시된 법선을 회전만)을 출력한다.
+// 2. 육각형/캡슐 쌍 처리량과 레이/겹침 쿼리 정확도를 확인한다.
+// 3. 캡슐/육각형/삼각형/원을 상자 안에 쏟아 관통과 깊은 침투가 없는지, 빠른 캡슐/삼각형이 CCD로 벽에 막히는지,
+//    세운 캡슐이 똑바로 서는지 확인한다.
+// 결과가 박스와 다르거나 쿼리/시뮬레이션 검사가 하나라도 실패하면 1을 반환한다.
+// Engine/Core (GameObject, Transform)와 Engine/Physics 소스를 함께 빌드한다.
+#include "Core/GameObject.h"
+#include "Physics/PhysicsSystem.h"
+#include "Physics/BoxCollider2D.h"
+#include "Physics/CapsuleCollider2D.h"
+#include "Physics/CircleCollider.h"
+#include "Physics/CollisionDispatch.h"
+#include "Physics/ContactSolver.h"
+#include "Physics/PolygonCollider2D.h"
+#include "Physics/Rigidbody2D.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct ObjectList
+    {
+        std::vector<GameObject*> objects;
+
+        ~ObjectList()
+        {
+            for (GameObject* obj : objects)
+                delete obj;
+        }
+
+        GameObject* Create(float x, float y, float rotation = 0.0f)
+        {
+            GameObject* obj = new GameObject();
+            obj->transform.SetPosition(x, y);
+            obj->transform.SetRotation(rotation);
+            objects.push_back(obj);
+            return obj;
+        }
+    };
+
+    std::vector<XMFLOAT2> MakeRegularPolygon(int sides, float radius)
+    {
+        std::vector<XMFLOAT2> points;
+        for (int i = 0; i < sides; i++)
+        {
+            float angle = 6.2831853f * i / sides;
+            points.push_back({ cosf(angle) * radius, sinf(angle) * radius });
+        }
+        return points;
+    }
+
+    template <typename Func>
+    double MeasureNs(int rounds, int pairCount, Func&& func)
+    {
+        auto begin = std::chrono::high_resolution_clock::now();
+        for (int round = 0; round < rounds; round++)
+            func();
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::nano>(end - begin).count() / (static_cast<double>(rounds) * pairCount);
+    }
+
+    bool NearlyEqual(float a, float b, float tolerance) { return fabsf(a - b) <= tolerance; }
+
+    // ========== 1. 박스 ↔ 박스 모양 다각형 ==========
+
+    bool CompareWithBoxes()
+    {
+        const int PairCount = 100000;
+        const int Rounds = 10;
+
+        std::mt19937 rng(23u);
+        std::uniform_real_distribution<float> position(-200.0f, 200.0f);
+        std::uniform_real_distribution<float> size(4.0f, 16.0f);
+        std::uniform_real_distribution<float> angle(0.0f, 6.28f);
+        std::uniform_real_distribution<float> near(-24.0f, 24.0f);
+
+        ObjectList list;
+        std::vector<std::pair<BaseCollider*, BaseCollider*>> boxPairs;
+        std::vector<std::pair<BaseCollider*, BaseCollider*>> polygonPairs;
+
+        for (int i = 0; i < PairCount; i++)
+        {
+            BaseCollider* boxes[2];
+            BaseCollider* polygons[2];
+            float x = position(rng), y = position(rng);
+
+            for (int side = 0; side < 2; side++)
+            {
+                float px = x + (side ? near(rng) : 0.0f);
+                float py = y + (side ? near(rng) : 0.0f);
+                float rotation = angle(rng);
+                XMFLOAT2 half = { size(rng), size(rng) };
+
+                auto* box = list.Create(px, py, rotation)->AddComponent<BoxCollider2D>();
+                box->halfSize = half;
+                auto* polygon = list.Create(px, py, rotation)->AddComponent<PolygonCollider2D>();
+                polygon->SetAsBox(half.x, half.y);
+
+                boxes[side] = box;
+                polygons[side] = polygon;
+            }
+
+            boxPairs.push_back({ boxes[0], boxes[1] });
+            polygonPairs.push_back({ polygons[0], polygons[1] });
+        }
+
+        // 월드 형태 캐시는 측정에서 제외
+        for (GameObject* obj : list.objects)
+            obj->GetComponent<BaseCollider>()->GetWorldShape();
+
+        std::vector<char> boxHits(PairCount), polygonHits(PairCount);
+        double boxIntersectNs = MeasureNs(Rounds, PairCount, [&]()
+        {
+            for (int i = 0; i < PairCount; i++)
+                boxHits[i] = CollisionDispatch::Intersects(boxPairs[i].first, boxPairs[i].second);
+        });
+        double polygonIntersectNs = MeasureNs(Rounds, PairCount, [&]()
+        {
+            for (int i = 0; i < PairCount; i++)
+                polygonHits[i] = CollisionDispatch::Intersects(polygonPairs[i].first, polygonPairs[i].second);
+        });
+
+        std::vector<ContactManifold> boxManifolds(PairCount), polygonManifolds(PairCount);
+        std::vector<char> boxContacts(PairCount), polygonContacts(PairCount);
+        double boxCollideNs = MeasureNs(Rounds, PairCount, [&]()
+        {
+            for (int i = 0; i < PairCount; i++)
+                boxContacts[i] = CollisionDispatch::Collide(boxPairs[i].first, boxPairs[i].second, boxManifolds[i]);
+        });
+        double polygonCollideNs = MeasureNs(Rounds, PairCount, [&]()
+        {
+            for (int i = 0; i < PairCount; i++)
+                polygonContacts[i] = CollisionDispatch::Collide(polygonPairs[i].first, polygonPairs[i].second, polygonManifolds[i]);
+        });
+
+        // 회전 계산 순서만 다르므로 작은 오차 허용 (경계에 걸친 쌍은 판정이 갈릴 수 있음)
+        int hitCount = 0, contactCount = 0, mismatches = 0;
+        for (int i = 0; i < PairCount; i++)
+        {
+            hitCount += boxHits[i];
+            contactCount += boxContacts[i];
+
+            bool same = boxHits[i] == polygonHits[i] && boxContacts[i] == polygonContacts[i];
+            if (same && boxContacts[i])
+            {
+                const ContactManifold& a = boxManifolds[i];
+                const ContactManifold& b = polygonManifolds[i];
+                same = a.pointCount == b.pointCount &&
+                       NearlyEqual(a.normal.x, b.normal.x, 1e-3f) && NearlyEqual(a.normal.y, b.normal.y, 1e-3f);
+                for (int p = 0; same && p < a.pointCount; p++)
+                    same = NearlyEqual(a.points[p].separation, b.points[p].separation, 1e-2f);
+            }
+
+            if (!same)
+                mismatches++;
+        }
+
+        bool passed = mismatches <= PairCount / 10000;
+        printf("box vs polygon-as-box: %d pairs, %d overlapping, %d contacts, %d mismatches %s\n",
+               PairCount, hitCount, contactCount, mismatches, passed ? "OK" : "FAILED");
+        printf("  intersect ns/pair: box %.1f, polygon %.1f\n", boxIntersectNs, polygonIntersectNs);
+        printf("  collide   ns/pair: box %.1f (normals from edges), polygon %.1f (cached normals)\n",
+               boxCollideNs, polygonCollideNs);
+        return passed;
+    }
+
+    // ========== 2. 육각형/캡슐 처리량 ==========
+
+    void MeasureRoundedPairs()
+    {
+        const int PairCount = 100000;
+        const int Rounds = 10;
+
+        std::mt19937 rng(29u);
+        std::uniform_real_distribution<float> position(-200.0f, 200.0f);
+        std::uniform_real_distribution<float> angle(0.0f, 6.28f);
+        std::uniform_real_distribution<float> near(-24.0f, 24.0f);
+
+        ObjectList list;
+        std::vector<std::pair<BaseCollider*, BaseCollider*>> pairs[3];  // 육각형-육각형, 캡슐-캡슐, 캡슐-육각형
+        const std::vector<XMFLOAT2> hexagon = MakeRegularPolygon(6, 10.0f);
+
+        auto makeHexagon = [&](float x, float y) -> BaseCollider*
+        {
+            auto* polygon = list.Create(x, y, angle(rng))->AddComponent<PolygonCollider2D>();
+            polygon->SetPoints(hexagon);
+            return polygon;
+        };
+        auto makeCapsule = [&](float x, float y) -> BaseCollider*
+        {
+            auto* capsule = list.Create(x, y, angle(rng))->AddComponent<CapsuleCollider2D>();
+            capsule->radius = 5.0f;
+            capsule->height = 24.0f;
+            return capsule;
+        };
+
+        for (int i = 0; i < PairCount; i++)
+        {
+            float x = position(rng), y = position(rng);
+            pairs[0].push_back({ makeHexagon(x, y), makeHexagon(x + near(rng), y + near(rng)) });
+            pairs[1].push_back({ makeCapsule(x, y), makeCapsule(x + near(rng), y + near(rng)) });
+            pairs[2].push_back({ makeCapsule(x, y), makeHexagon(x + near(rng), y + near(rng)) });
+        }
+
+        for (GameObject* obj : list.objects)
+            obj->GetComponent<BaseCollider>()->GetWorldShape();
+
+        const char* names[3] = { "hexagon-hexagon", "capsule-capsule", "capsule-hexagon" };
+        for (int kind = 0; kind < 3; kind++)
+        {
+            int contacts = 0;
+            ContactManifold manifold;
+            double collideNs = MeasureNs(Rounds, PairCount, [&]()
+            {
+                contacts = 0;
+                for (const auto& pair : pairs[kind])
+                    contacts += CollisionDispatch::Collide(pair.first, pair.second, manifold);
+            });
+
+            printf("%-16s collide ns/pair %.1f (%d contacts)\n", names[kind], collideNs, contacts);
+        }
+    }
+
+    // ========== 쿼리 ==========
+
+    bool CheckQueries()
+    {
+        ObjectList list;
+        PhysicsSystem physics;
+
+        // 세운 캡슐 (반지름 10, 높이 60 → 위 끝 y = 70) / 육각형 (꼭짓점 반지름 20, x축 꼭짓점)
+        auto* capsule = list.Create(0.0f, 100.0f)->AddComponent<CapsuleCollider2D>();
+        capsule->radius = 10.0f;
+        capsule->height = 60.0f;
+
+        auto* hexagon = list.Create(200.0f, 100.0f)->AddComponent<PolygonCollider2D>();
+        hexagon->SetPoints(MakeRegularPolygon(6, 20.0f));
+
+        for (GameObject* obj : list.objects)
+            physics.AddGameObject(obj);
+        physics.SyncTransforms();
+
+        bool passed = true;
+        RaycastHit hit;
+
+        // 캡슐 위 끝으로 수직 레이 (y = 0 → 70)
+        bool capsuleTop = physics.Raycast({ 0.0f, 0.0f }, { 0.0f, 1.0f }, 500.0f, hit) &&
+                          hit.collider == capsule && NearlyEqual(hit.distance, 70.0f, 0.05f) &&
+                          NearlyEqual(hit.normal.y, -1.0f, 1e-3f);
+        // 캡슐 옆면으로 수평 레이 (x = -100 → -10)
+        bool capsuleSide = physics.Raycast({ -100.0f, 110.0f }, { 1.0f, 0.0f }, 500.0f, hit) &&
+                           hit.collider == capsule && NearlyEqual(hit.distance, 90.0f, 0.05f);
+        // 육각형 꼭짓점으로 (x = 300 → 220)
+        bool hexagonVertex = physics.Raycast({ 300.0f, 100.0f }, { -1.0f, 0.0f }, 500.0f, hit) &&
+                             hit.collider == hexagon && NearlyEqual(hit.distance, 80.0f, 0.05f);
+        // 육각형 아래 변으로 (변까지 거리 = 20 x sin 60)
+        bool hexagonFace = physics.Raycast({ 200.0f, 0.0f }, { 0.0f, 1.0f }, 500.0f, hit) &&
+                           hit.collider == hexagon && NearlyEqual(hit.distance, 100.0f - 20.0f * 0.8660254f, 0.05f);
+        // 반지름 5 원 캐스트 → 캡슐 위 끝
+        bool circleCast = physics.CircleCast({ 0.0f, 0.0f }, 5.0f, { 0.0f, 1.0f }, 500.0f, hit) &&
+                          hit.collider == capsule && NearlyEqual(hit.distance, 65.0f, 0.05f);
+        // 박스 캐스트 → 육각형 아래 변
+        bool boxCast = physics.BoxCast({ 200.0f, 0.0f }, { 5.0f, 5.0f }, 0.0f, { 0.0f, 1.0f }, 500.0f, hit) &&
+                       hit.collider == hexagon && NearlyEqual(hit.distance, 95.0f - 20.0f * 0.8660254f, 0.05f);
+
+        BaseCollider* found[4];
+        bool overlapInside = physics.OverlapPoint({ 0.0f, 125.0f }, found, 4) == 1;     // 아래 반원 안
+        bool overlapCorner = physics.OverlapPoint({ 9.0f, 128.0f }, found, 4) == 0;     // 반원 바깥 (AABB 안)
+        bool overlapHexagon = physics.OverlapPoint({ 218.0f, 100.0f }, found, 4) == 1 &&
+                              physics.OverlapPoint({ 215.0f, 117.0f }, found, 4) == 0;
+
+        passed = capsuleTop && capsuleSide && hexagonVertex && hexagonFace && circleCast && boxCast &&
+                 overlapInside && overlapCorner && overlapHexagon;
+
+        printf("queries: capsule top %s, side %s, hexagon vertex %s, face %s, circle cast %s, box cast %s, overlap %s\n",
+               capsuleTop ? "OK" : "FAILED", capsuleSide ? "OK" : "FAILED", hexagonVertex ? "OK" : "FAILED",
+               hexagonFace ? "OK" : "FAILED", circleCast ? "OK" : "FAILED", boxCast ? "OK" : "FAILED",
+               (overlapInside && overlapCorner && overlapHexagon) ? "OK" : "FAILED");
+
+        physics.Clear();
+        return passed;
+    }
+
+    // ========== 3. 시뮬레이션 ==========
+
+    bool CheckPile()
+    {
+        const float GroundTop = 400.0f;
+        const int ShapeCount = 120;
+        const float DeltaTime = 1.0f / 60.0f;
+
+        ObjectList list;
+        PhysicsSystem physics;
+
+        // 바닥 + 양쪽 벽 (정적)
+        auto* ground = list.Create(0.0f, GroundTop + 20.0f)->AddComponent<BoxCollider2D>();
+        ground->halfSize = { 300.0f, 20.0f };
+        auto* leftWall = list.Create(-300.0f, 0.0f)->AddComponent<BoxCollider2D>();
+        leftWall->halfSize = { 20.0f, 420.0f };
+        auto* rightWall = list.Create(300.0f, 0.0f)->AddComponent<BoxCollider2D>();
+        rightWall->halfSize = { 20.0f, 420.0f };
+
+        std::mt19937 rng(31u);
+        std::uniform_real_distribution<float> jitter(-4.0f, 4.0f);
+        std::uniform_real_distribution<float> angle(0.0f, 6.28f);
+        const std::vector<XMFLOAT2> hexagon = MakeRegularPolygon(6, 10.0f);
+        const std::vector<XMFLOAT2> triangle = MakeRegularPolygon(3, 12.0f);
+
+        std::vector<GameObject*> shapes;
+        for (int i = 0; i < ShapeCount; i++)
+        {
+            float x = -250.0f + 42.0f * (i % 12) + jitter(rng);
+            float y = 300.0f - 36.0f * (i / 12);
+            GameObject* obj = list.Create(x, y, angle(rng));
+
+            switch (i % 5)
+            {
+            case 0:
+            case 1:
+            {
+                auto* capsule = obj->AddComponent<CapsuleCollider2D>();
+                capsule->radius = 6.0f;
+                capsule->height = 28.0f;
+                break;
+            }
+            case 2:
+                obj->AddComponent<PolygonCollider2D>()->SetPoints(hexagon);
+                break;
+            case 3:
+                obj->AddComponent<PolygonCollider2D>()->SetPoints(triangle);
+                break;
+            default:
+                obj->AddComponent<CircleCollider>()->radius = 8.0f;
+                break;
+            }
+
+            obj->AddComponent<Rigidbody2D>();
+            shapes.push_back(obj);
+        }
+
+        for (GameObject* obj : list.objects)
+            physics.AddGameObject(obj);
+
+        auto begin = std::chrono::high_resolution_clock::now();
+        float maxPenetration = 0.0f;
+        const int StepCount = 900;
+        for (int step = 0; step < StepCount; step++)
+        {
+            physics.Step(DeltaTime);
+
+            // 마지막 1/3 동안 최대 침투 (쌓인 뒤)
+            if (step >= StepCount * 2 / 3)
+            {
+                for (const ContactManifold& manifold : physics.GetContactManifolds())
+                    for (int p = 0; p < manifold.pointCount; p++)
+                        maxPenetration = (std::max)(maxPenetration, -manifold.points[p].separation);
+            }
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        double stepUs = std::chrono::duration<double, std::micro>(end - begin).count() / StepCount;
+
+        int escaped = 0;
+        int sleeping = 0;
+        for (GameObject* obj : shapes)
+        {
+            XMFLOAT2 position = obj->transform.GetPosition();
+            if (position.y > GroundTop || fabsf(position.x) > 280.0f)
+                escaped++;
+            if (obj->GetComponent<Rigidbody2D>()->IsSleeping())
+                sleeping++;
+        }
+
+        bool passed = escaped == 0 && maxPenetration < 3.0f;
+        printf("pile: %d shapes, %.1f us/step, escaped %d, max penetration %.2f px, sleeping %d %s\n",
+               ShapeCount, stepUs, escaped, maxPenetration, sleeping, passed ? "OK" : "FAILED");
+
+        physics.Clear();
+        return passed;
+    }
+
+    // CCD: 얇은 벽으로 빠르게 회전하며 날아가는 캡슐/삼각형이 벽을 통과하지 않아야 함
+    bool CheckContinuous()
+    {
+        ObjectList list;
+        PhysicsSystem physics;
+
+        auto* wall = list.Create(0.0f, 0.0f)->AddComponent<BoxCollider2D>();
+        wall->halfSize = { 10.0f, 2000.0f };
+
+        std::vector<GameObject*> bullets;
+        for (int i = 0; i < 40; i++)
+        {
+            GameObject* obj = list.Create(-600.0f - 20.0f * i, -800.0f + 40.0f * i);
+            if (i % 2 == 0)
+            {
+                auto* capsule = obj->AddComponent<CapsuleCollider2D>();
+                capsule->radius = 2.0f;
+                capsule->height = 12.0f;
+            }
+            else
+            {
+                obj->AddComponent<PolygonCollider2D>()->SetPoints(MakeRegularPolygon(3, 4.0f));
+            }
+
+            auto* rb = obj->AddComponent<Rigidbody2D>();
+            rb->useGravity = false;
+            rb->useCCD = true;
+            rb->restitution = 0.0f;
+            rb->SetVelocity({ 9000.0f, 0.0f });
+            rb->SetAngularVelocity(15.0f);
+            bullets.push_back(obj);
+        }
+
+        for (GameObject* obj : list.objects)
+            physics.AddGameObject(obj);
+
+        for (int step = 0; step < 60; step++)
+            physics.Step(1.0f / 60.0f);
+
+        int tunneled = 0;
+        for (GameObject* obj : bullets)
+        {
+            if (obj->transform.GetPosition().x > 0.0f)
+                tunneled++;
+        }
+
+        printf("ccd: %d fast capsules/triangles, tunneled %d %s\n", static_cast<int>(bullets.size()), tunneled,
+               tunneled == 0 ? "OK" : "FAILED");
+
+        physics.Clear();
+        return tunneled == 0;
+    }
+
+    // 세운 캡슐은 바닥에 반원으로 닿아 똑바로 서 있어야 함 (둥근 끝 ↔ 면 접촉)
+    bool CheckStandingCapsule()
+    {
+        const float GroundTop = 100.0f;
+
+        ObjectList list;
+        PhysicsSystem physics;
+
+        auto* ground = list.Create(0.0f, GroundTop + 10.0f)->AddComponent<BoxCollider2D>();
+        ground->halfSize = { 200.0f, 10.0f };
+
+        GameObject* obj = list.Create(0.0f, 0.0f);
+        auto* capsule = obj->AddComponent<CapsuleCollider2D>();
+        capsule->radius = 8.0f;
+        capsule->height = 40.0f;
+        obj->AddComponent<Rigidbody2D>();
+
+        for (GameObject* item : list.objects)
+            physics.AddGameObject(item);
+
+        for (int step = 0; step < 300; step++)
+            physics.Step(1.0f / 60.0f);
+
+        float bottom = obj->transform.GetPosition().y + 20.0f;
+        float tilt = obj->transform.GetRotation();
+        bool passed = fabsf(bottom - GroundTop) < 1.0f && fabsf(tilt) < 0.01f;
+
+        printf("standing capsule: bottom %.2f (ground %.0f), tilt %.4f rad %s\n",
+               bottom, GroundTop, tilt, passed ? "OK" : "FAILED");
+
+        physics.Clear();
+        return passed;
+    }
+}
+
+int main()
+{
+    bool allPassed = true;
+
+    allPassed = CompareWithBoxes() && allPassed;
+    MeasureRoundedPairs();
+    allPassed = CheckQueries() && allPassed;
+    allPassed = CheckPile() && allPassed;
+    allPassed = CheckContinuous() && allPassed;
+    allPassed = CheckStandingCapsule() && allPassed;
+
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,214 @@
+// 물리 스냅샷 벤치마크 (콘솔)
+// 상자 안에 쌓이는 강체 10000개 씬에서 PhysicsSystem::SaveSnapshot/RestoreSnapshot 시간과 크기를 재고,
+// 저장 → N 스텝 → 복원 → N 스텝 결과가 처음 N 스텝과 비트 단위로 같은지 확인한다.
+// 접촉이 많은 상태와, 대부분 잠든 상태에서 한 강체를 쳐서 섬을 깨우는 경우를 모두 확인한다.
+// 결과가 다르거나 등록이 바뀐 월드에 복원이 성공하면 1을 반환한다.
+// Engine/Core (GameObject, Transform)와 Engine/Physics 소스를 함께 빌드한다.
+#include "Core/GameObject.h"
+#include "Physics/PhysicsSystem.h"
+#include "Physics/BoxCollider2D.h"
+#include "Physics/CircleCollider.h"
+#include "Physics/Rigidbody2D.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct PileScene
+    {
+        std::vector<GameObject*> objects;
+        std::vector<GameObject*> bodies;
+
+        ~PileScene()
+        {
+            for (GameObject* obj : objects)
+                delete obj;
+        }
+    };
+
+    GameObject* AddWall(PileScene& scene, float x, float y, float halfWidth, float halfHeight)
+    {
+        GameObject* wall = new GameObject();
+        wall->transform.SetPosition(x, y);
+        auto* box = wall->AddComponent<BoxCollider2D>();
+        box->halfSize = { halfWidth, halfHeight };
+        scene.objects.push_back(wall);
+        return wall;
+    }
+
+    // 바닥과 양쪽 벽으로 된 상자 위에서 박스/원을 떨어뜨림 (회전 포함)
+    void BuildScene(PileScene& scene, int bodyCount, unsigned int seed)
+    {
+        const float halfWidth = 1600.0f;
+        AddWall(scene, 0.0f, 20.0f, halfWidth, 20.0f);
+        AddWall(scene, -halfWidth - 20.0f, -1000.0f, 20.0f, 1000.0f);
+        AddWall(scene, halfWidth + 20.0f, -1000.0f, 20.0f, 1000.0f);
+
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> positionX(-halfWidth + 10.0f, halfWidth - 10.0f);
+        std::uniform_real_distribution<float> positionY(-1200.0f, -10.0f);
+        std::uniform_real_distribution<float> size(3.0f, 7.0f);
+        std::uniform_real_distribution<float> angle(0.0f, 6.28f);
+
+        for (int i = 0; i < bodyCount; i++)
+        {
+            GameObject* obj = new GameObject();
+            obj->transform.SetPosition(positionX(rng), positionY(rng));
+            obj->transform.SetRotation(angle(rng));
+
+            if (i % 2 == 0)
+            {
+                auto* box = obj->AddComponent<BoxCollider2D>();
+                box->halfSize = { size(rng), size(rng) };
+            }
+            else
+            {
+                auto* circle = obj->AddComponent<CircleCollider>();
+                circle->radius = size(rng);
+            }
+
+            auto* rb = obj->AddComponent<Rigidbody2D>();
+            rb->restitution = 0.1f;
+
+            scene.objects.push_back(obj);
+            scene.bodies.push_back(obj);
+        }
+    }
+
+    // 강체별 위치, 회전, 속도, 회전 속도 기록 (비트 비교용)
+    void Record(const PileScene& scene, std::vector<float>& outState)
+    {
+        outState.clear();
+        for (GameObject* obj : scene.bodies)
+        {
+            XMFLOAT2 position = obj->transform.GetPosition();
+            Rigidbody2D* rb = obj->GetComponent<Rigidbody2D>();
+            XMFLOAT2 velocity = rb->GetVelocity();
+
+            outState.push_back(position.x);
+            outState.push_back(position.y);
+            outState.push_back(obj->transform.GetRotation());
+            outState.push_back(velocity.x);
+            outState.push_back(velocity.y);
+            outState.push_back(rb->GetAngularVelocity());
+        }
+    }
+
+    bool SameBits(const std::vector<float>& a, const std::vector<float>& b)
+    {
+        return a.size() == b.size() && memcmp(a.data(), b.data(), sizeof(float) * a.size()) == 0;
+    }
+
+    // 저장 → steps 스텝 → 복원 → steps 스텝 결과 비교 (poke가 있으면 두 번 모두 5번째 스텝 전에 쳐서 깨움)
+    bool ReplayMatches(PhysicsSystem& physics, const PileScene& scene, int steps, GameObject* poke)
+    {
+        const float fixedDelta = 1.0f / 60.0f;
+
+        PhysicsSnapshot snapshot;
+        physics.SaveSnapshot(snapshot);
+
+        std::vector<float> firstRun, replayRun;
+        for (int run = 0; run < 2; run++)
+        {
+            if (run == 1 && !physics.RestoreSnapshot(snapshot))
+                return false;
+
+            for (int step = 0; step < steps; step++)
+            {
+                if (poke && step == 5)
+                    poke->GetComponent<Rigidbody2D>()->SetVelocity({ 0.0f, -300.0f });
+                physics.Step(fixedDelta);
+            }
+
+            Record(scene, run == 0 ? firstRun : replayRun);
+        }
+
+        return SameBits(firstRun, replayRun);
+    }
+}
+
+int main()
+{
+    const int BodyCount = 10000;
+    const int SettleSteps = 120;
+    const int ReplaySteps = 60;
+    const int SleepBodyCount = 500;
+    const int SleepSteps = 900;
+    const int Rounds = 50;
+    const float fixedDelta = 1.0f / 60.0f;
+
+    PileScene scene;
+    BuildScene(scene, BodyCount, 5u);
+
+    PhysicsSystem physics;
+    physics.broadphaseMode = BroadphaseMode::DynamicTree;
+    for (GameObject* obj : scene.objects)
+        physics.AddGameObject(obj);
+
+    // 접촉과 잠든 강체가 생길 때까지 진행
+    for (int step = 0; step < SettleSteps; step++)
+        physics.Step(fixedDelta);
+
+    // 저장/복원 시간 (같은 스냅샷 객체 재사용)
+    PhysicsSnapshot snapshot;
+    physics.SaveSnapshot(snapshot);
+
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < Rounds; round++)
+        physics.SaveSnapshot(snapshot);
+    auto middle = std::chrono::high_resolution_clock::now();
+    bool restored = true;
+    for (int round = 0; round < Rounds; round++)
+        restored = physics.RestoreSnapshot(snapshot) && restored;
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double saveMs = std::chrono::duration<double, std::milli>(middle - begin).count() / Rounds;
+    double restoreMs = std::chrono::duration<double, std::milli>(end - middle).count() / Rounds;
+
+    printf("%d bodies, %d contacts, %d sleeping: snapshot %.1f KB, save %.3f ms, restore %.3f ms\n",
+           BodyCount, static_cast<int>(physics.GetContactManifolds().size()), physics.GetSleepingBodyCount(),
+           snapshot.data.size() / 1024.0, saveMs, restoreMs);
+
+    // 접촉이 많은 상태에서 재생
+    bool identical = restored && ReplayMatches(physics, scene, ReplaySteps, nullptr);
+    printf("replay %d steps after restore: %s\n", ReplaySteps, identical ? "bit-identical" : "DIFFERENT");
+
+    // 잠든 더미 (복원 직후 잠든 쌍 접촉점을 다시 계산) + 한 강체를 쳐서 섬 깨우기
+    {
+        PileScene sleepScene;
+        BuildScene(sleepScene, SleepBodyCount, 7u);
+
+        PhysicsSystem sleepPhysics;
+        sleepPhysics.broadphaseMode = BroadphaseMode::DynamicTree;
+        for (GameObject* obj : sleepScene.objects)
+            sleepPhysics.AddGameObject(obj);
+
+        for (int step = 0; step < SleepSteps; step++)
+            sleepPhysics.Step(fixedDelta);
+
+        int sleeping = sleepPhysics.GetSleepingBodyCount();
+        bool sleepingIdentical = sleeping > 0 &&
+            ReplayMatches(sleepPhysics, sleepScene, ReplaySteps, sleepScene.bodies[SleepBodyCount / 2]);
+        printf("%d bodies, %d sleeping: replay with wake-up %s\n", SleepBodyCount, sleeping,
+               sleepingIdentical ? "bit-identical" : "DIFFERENT");
+        identical = identical && sleepingIdentical;
+
+        sleepPhysics.Clear();
+    }
+
+    // 등록이 바뀐 월드에는 복원하지 않음
+    GameObject* extra = new GameObject();
+    extra->AddComponent<CircleCollider>();
+    extra->AddComponent<Rigidbody2D>();
+    scene.objects.push_back(extra);
+    physics.AddGameObject(extra);
+
+    bool rejected = !physics.RestoreSnapshot(snapshot);
+    printf("restore after adding a body: %s\n", rejected ? "rejected (OK)" : "ACCEPTED");
+
+    physics.Clear();
+    return (identical && rejected) ? 0 : 1;
+}
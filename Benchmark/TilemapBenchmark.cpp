@@ -0,0 +1,288 @@
+// 타일맵 콜라이더 벤치마크 (콘솔)
+// 512x64 플랫포머 지형을 타일마다 BoxCollider2D 하나로 둘 때와 TilemapCollider(탐욕적 사각형 합치기)로 둘 때
+// 콜라이더 수, 생성 시간, 한 타일 변경 갱신 시간, 공이 떨어지는 씬의 스텝 시간을 비교한다.
+// 무작위 타일 변경 후 모든 채워진 타일이 정확히 한 사각형에 속하지 않거나 공이 지형을 통과하면 1을 반환한다.
+// Engine/Core (GameObject, Transform)와 Engine/Physics 소스를 함께 빌드한다.
+#include "Core/GameObject.h"
+#include "Physics/PhysicsSystem.h"
+#include "Physics/BoxCollider2D.h"
+#include "Physics/CircleCollider.h"
+#include "Physics/Rigidbody2D.h"
+#include "Physics/TilemapCollider.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    const int LevelWidth = 512;
+    const int LevelHeight = 64;
+    const float TileSize = 16.0f;
+
+    // 플랫포머 지형 (행 0 = 위쪽, 중력은 +y)
+    // 언덕 지면 + 떠 있는 발판 + 지면 속 동굴, 맨 아래 두 줄은 항상 채움
+    std::vector<uint8_t> BuildLevel(unsigned int seed)
+    {
+        std::mt19937 rng(seed);
+        std::vector<uint8_t> tiles(LevelWidth * LevelHeight, 0);
+        auto set = [&](int x, int y, uint8_t value)
+        {
+            if (x >= 0 && y >= 0 && x < LevelWidth && y < LevelHeight)
+                tiles[y * LevelWidth + x] = value;
+        };
+
+        // 지면 높이 (무작위 걸음, 몇 칸씩 같은 높이 유지)
+        int groundHeight = 44;
+        for (int x = 0; x < LevelWidth; x++)
+        {
+            if (x % 4 == 0)
+                groundHeight = std::clamp(groundHeight + static_cast<int>(rng() % 5) - 2, 32, 54);
+
+            for (int y = LevelHeight - groundHeight; y < LevelHeight; y++)
+                set(x, y, 1);
+        }
+
+        // 동굴
+        for (int i = 0; i < 40; i++)
+        {
+            int caveX = rng() % LevelWidth;
+            int caveY = LevelHeight - 4 - static_cast<int>(rng() % 16);
+            int caveWidth = 4 + rng() % 12;
+            int caveHeight = 2 + rng() % 3;
+            for (int y = caveY; y < caveY + caveHeight && y < LevelHeight - 2; y++)
+                for (int x = caveX; x < caveX + caveWidth; x++)
+                    set(x, y, 0);
+        }
+
+        // 떠 있는 발판
+        for (int i = 0; i < 60; i++)
+        {
+            int platformX = rng() % LevelWidth;
+            int platformY = 4 + rng() % 20;
+            int platformWidth = 3 + rng() % 10;
+            for (int x = platformX; x < platformX + platformWidth; x++)
+                set(x, platformY, 1);
+        }
+
+        return tiles;
+    }
+
+    int CountSolid(const std::vector<uint8_t>& tiles)
+    {
+        int count = 0;
+        for (uint8_t tile : tiles)
+            count += tile ? 1 : 0;
+        return count;
+    }
+
+    // 모든 채워진 타일이 정확히 한 사각형에 속하고, 사각형 안에 빈 타일이 없는지
+    bool CheckCoverage(const TilemapCollider& tilemap)
+    {
+        const int width = tilemap.GetWidth();
+        const int height = tilemap.GetHeight();
+        std::vector<int> cover(width * height, 0);
+        int liveRects = 0;
+
+        for (const TilemapCollider::TileRect& rect : tilemap.GetRects())
+        {
+            if (rect.width <= 0)
+                continue;
+
+            liveRects++;
+            for (int y = rect.y; y < rect.y + rect.height; y++)
+            {
+                for (int x = rect.x; x < rect.x + rect.width; x++)
+                {
+                    if (!tilemap.IsSolid(x, y))
+                        return false;
+                    cover[y * width + x]++;
+                }
+            }
+        }
+
+        if (liveRects != tilemap.GetRectCount())
+            return false;
+
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                if (cover[y * width + x] != (tilemap.IsSolid(x, y) ? 1 : 0))
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    struct LevelScene
+    {
+        std::vector<GameObject*> objects;
+        std::vector<GameObject*> balls;
+
+        ~LevelScene()
+        {
+            for (GameObject* obj : objects)
+                delete obj;
+        }
+    };
+
+    // 지형 (타일별 박스 또는 타일맵) 위로 공을 떨어뜨림
+    void BuildScene(LevelScene& scene, const std::vector<uint8_t>& tiles, bool useTilemap, int ballCount, unsigned int seed)
+    {
+        if (useTilemap)
+        {
+            GameObject* level = new GameObject();
+            auto* tilemap = level->AddComponent<TilemapCollider>();
+            tilemap->SetTileSize({ TileSize, TileSize });
+            tilemap->SetGridSize(LevelWidth, LevelHeight);
+            tilemap->SetTiles(tiles);
+            scene.objects.push_back(level);
+        }
+        else
+        {
+            for (int y = 0; y < LevelHeight; y++)
+            {
+                for (int x = 0; x < LevelWidth; x++)
+                {
+                    if (!tiles[y * LevelWidth + x])
+                        continue;
+
+                    GameObject* tile = new GameObject();
+                    tile->transform.SetPosition((x + 0.5f) * TileSize, (y + 0.5f) * TileSize);
+                    auto* box = tile->AddComponent<BoxCollider2D>();
+                    box->halfSize = { TileSize * 0.5f, TileSize * 0.5f };
+                    scene.objects.push_back(tile);
+                }
+            }
+        }
+
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> positionX(TileSize, (LevelWidth - 1) * TileSize);
+        std::uniform_real_distribution<float> positionY(-400.0f, -20.0f);
+
+        for (int i = 0; i < ballCount; i++)
+        {
+            GameObject* ball = new GameObject();
+            ball->transform.SetPosition(positionX(rng), positionY(rng));
+            auto* circle = ball->AddComponent<CircleCollider>();
+            circle->radius = 6.0f;
+            auto* rb = ball->AddComponent<Rigidbody2D>();
+            rb->restitution = 0.0f;
+            scene.objects.push_back(ball);
+            scene.balls.push_back(ball);
+        }
+    }
+
+    // 지형 바닥 아래로 빠진 공 수
+    int CountFallenThrough(const LevelScene& scene)
+    {
+        int count = 0;
+        for (GameObject* ball : scene.balls)
+        {
+            if (ball->transform.GetPosition().y > LevelHeight * TileSize)
+                count++;
+        }
+        return count;
+    }
+}
+
+int main()
+{
+    bool allPassed = true;
+
+    std::vector<uint8_t> tiles = BuildLevel(7u);
+    const int solidCount = CountSolid(tiles);
+
+    // ========== 합치기 ==========
+
+    GameObject level;
+    auto* tilemap = level.AddComponent<TilemapCollider>();
+    tilemap->SetTileSize({ TileSize, TileSize });
+    tilemap->SetGridSize(LevelWidth, LevelHeight);
+
+    const int BuildRounds = 20;
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < BuildRounds; round++)
+        tilemap->SetTiles(tiles);
+    auto end = std::chrono::high_resolution_clock::now();
+    double buildMs = std::chrono::duration<double, std::milli>(end - begin).count() / BuildRounds;
+
+    bool coveragePassed = CheckCoverage(*tilemap);
+    allPassed = allPassed && coveragePassed;
+
+    printf("%dx%d level: %d solid tiles -> %d rects (%.1fx fewer colliders), full merge %.3f ms %s\n",
+           LevelWidth, LevelHeight, solidCount, tilemap->GetRectCount(),
+           static_cast<double>(solidCount) / tilemap->GetRectCount(), buildMs, coveragePassed ? "OK" : "MISMATCH");
+
+    // ========== 한 타일 변경 ==========
+
+    const int EditCount = 5000;
+    std::mt19937 rng(99u);
+    std::uniform_int_distribution<int> editX(0, LevelWidth - 1);
+    std::uniform_int_distribution<int> editY(0, LevelHeight - 1);
+
+    begin = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < EditCount; i++)
+    {
+        int x = editX(rng);
+        int y = editY(rng);
+        tilemap->SetTile(x, y, !tilemap->IsSolid(x, y));
+        tilemap->ApplyChanges();
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double editUs = std::chrono::duration<double, std::micro>(end - begin).count() / EditCount;
+
+    bool editPassed = CheckCoverage(*tilemap);
+    int incrementalRects = tilemap->GetRectCount();
+    tilemap->Rebuild();
+    editPassed = editPassed && CheckCoverage(*tilemap);
+    allPassed = allPassed && editPassed;
+
+    printf("%d single-tile edits: %.2f us/edit, %d rects (full rebuild %d) %s\n",
+           EditCount, editUs, incrementalRects, tilemap->GetRectCount(), editPassed ? "OK" : "MISMATCH");
+
+    // ========== 스텝 ==========
+
+    const float fixedDelta = 1.0f / 60.0f;
+    const int StepCount = 180;
+    const int BallCount = 500;
+
+    printf("%-10s %10s %12s %12s %10s %s\n", "terrain", "colliders", "setup ms", "ms/step", "fell", "check");
+
+    for (bool useTilemap : { false, true })
+    {
+        begin = std::chrono::high_resolution_clock::now();
+        LevelScene scene;
+        BuildScene(scene, tiles, useTilemap, BallCount, 3u);
+
+        PhysicsSystem physics;
+        physics.broadphaseMode = BroadphaseMode::DynamicTree;
+        for (GameObject* obj : scene.objects)
+            physics.AddGameObject(obj);
+        physics.Step(fixedDelta);
+        auto middle = std::chrono::high_resolution_clock::now();
+
+        for (int step = 1; step < StepCount; step++)
+            physics.Step(fixedDelta);
+        end = std::chrono::high_resolution_clock::now();
+
+        int colliderCount = useTilemap
+            ? scene.objects[0]->GetComponent<TilemapCollider>()->GetRectCount() + BallCount
+            : static_cast<int>(scene.objects.size());
+
+        int fell = CountFallenThrough(scene);
+        bool passed = fell == 0;
+        allPassed = allPassed && passed;
+
+        double setupMs = std::chrono::duration<double, std::milli>(middle - begin).count();
+        double stepMs = std::chrono::duration<double, std::milli>(end - middle).count() / (StepCount - 1);
+        printf("%-10s %10d %12.3f %12.3f %10d %s\n",
+               useTilemap ? "tilemap" : "per-tile", colliderCount, setupMs, stepMs, fell, passed ? "OK" : "FELL");
+
+        physics.Clear();
+    }
+
+    return allPassed ? 0 : 1;
+}
@@ -11,7 +11,7 @@ void Animator::Play(std::shared_ptr<AnimationClip> clip, bool loop)
     if (!clip)
         return;
 
-    // AnimatorController  ̸ 
+    // AnimatorController 사용 중이면 끔
     animatorController = nullptr;
 
     currentClip = clip;
@@ -30,14 +30,14 @@ void Animator::SetController(std::shared_ptr<AnimatorController> controller)
 {
     animatorController = controller;
     
-    // Controller     Ŭ Ȱȭ
+    // Controller 설정 후 현재 재생 클립 비활성화
     if (animatorController)
     {
         currentClip = nullptr;
         accumulatedTimeSeconds = 0.0f;
         currentFrameIndex = 0;
         
-        //  ӽ ʱȭ - ⺻ · 
+        // 상태 머신 초기화 - 기본 상태로 진입
         auto* stateMachine = animatorController->GetStateMachine();
         if (stateMachine)
         {
@@ -48,37 +48,37 @@ void Animator::SetController(std::shared_ptr<AnimatorController> controller)
 
 void Animator::LoadController(const std::wstring& controllerPath)
 {
-    // Resources ĳõ Ʈѷ 
-    // controllerPath "Assets/Controllers/PlayerController.controller" 
-    // Ǵ ܼ "PlayerController"  
+    // Resources에서 캐시된 컨트롤러 가져오기
+    // controllerPath는 "Assets/Controllers/PlayerController.controller" 형식
+    // 또는 단순히 "PlayerController"와 같은 형식
     
     std::wstring baseKey = controllerPath;
     std::wstring fullPath = controllerPath;
     
-    // ü ΰ ־  ϸ 
+    // 전체 경로가 주어진 경우 파일명만 추출
     size_t lastSlash = baseKey.find_last_of(L"/\\");
     if (lastSlash != std::wstring::npos)
     {
         baseKey = baseKey.substr(lastSlash + 1);
     }
     
-    // Ȯ 
+    // 확장자 제거
     size_t lastDot = baseKey.find_last_of(L'.');
     if (lastDot != std::wstring::npos)
     {
         baseKey = baseKey.substr(0, lastDot);
     }
     
-    // ü   (Ȯڰ  ߰)
+    // 전체 경로 구성 (확장자가 없으면 추가)
     if (fullPath.find(L".controller") == std::wstring::npos)
     {
         fullPath = L"Assets/Controllers/" + baseKey + L".controller";
     }
     
-    // Resources ĳÿ  õ
+    // Resources 캐시에서 가져오기 시도
     auto controller = Resources::Get<AnimatorController>(baseKey);
     
-    // ĳÿ   ε
+    // 캐시에 없으면 직접 로드
     if (!controller)
     {
         controller = Resources::Load<AnimatorController>(baseKey, fullPath);
@@ -156,14 +156,14 @@ void Animator::UpdateWithController(float deltaTime)
     if (!stateMachine)
         return;
 
-    // SpriteRenderer   üũ ()
+    // SpriteRenderer 매 프레임 체크 (안전성)
     if (!spriteRenderer)
         spriteRenderer = gameObject->GetComponent<SpriteRenderer>();
 
-    //  ӽ Ʈ
+    // 상태 머신 업데이트
     stateMachine->Update(deltaTime, animatorController.get());
 
-    //   ִϸ̼ Ŭ 
+    // 현재 상태의 애니메이션 클립을 가져옴
     auto* currentState = stateMachine->GetCurrentState();
     if (currentState)
     {
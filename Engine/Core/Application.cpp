@@ -235,7 +235,6 @@ void Application::run()
 
     MSG msg = {};
 
-    const float fixedDelta = 1.0f / 60.0f; // 60Hz
     const float maxDelta = 0.1f; // 최대 deltaTime (100ms)
     float fixedAccumulator = 0.0f; // 고정값 누적기
 
@@ -320,7 +319,8 @@ void Application::run()
         // 게임이 플레이 중일 때만 업데이트
         if (isGamePlaying && hasActiveScene)
         {
-            // FixedUpdate — 고정 주기 호출
+            // FixedUpdate — 고정 주기 호출 (프레임 중 바뀐 간격은 다음 프레임부터)
+            const float fixedDelta = fixedDeltaTime;
             while (fixedAccumulator >= fixedDelta)
             {
                 sceneManager.FixedUpdate(fixedDelta);
@@ -332,13 +332,21 @@ void Application::run()
 
             // LateUpdate — Update 후 처리
             sceneManager.LateUpdate(deltaTime);
+
+            // 남은 누적 시간만큼 마지막 스텝 직전↔결과 자세 보간
+            interpolationAlpha = fixedAccumulator / fixedDelta;
         }
         else
         {
             // 에디터 모드 또는 일시정지: 업데이트 안 함, 누적기만 리셋
             fixedAccumulator = 0.0f;
+
+            // 멈춘 동안은 마지막 스텝 결과 그대로
+            interpolationAlpha = 1.0f;
         }
 
+        RenderManager::Instance().SetInterpolationAlpha(interpolationAlpha);
+
         // 입력 상태 업데이트
         input.Update();
 
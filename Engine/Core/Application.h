@@ -25,6 +25,14 @@ public:
     int GetWindowWidth() const { return windowWidth; }
     int GetWindowHeight() const { return windowHeight; }
 
+    // 고정 스텝 간격 (FixedUpdate/물리, 기본 60Hz)
+    // 렌더링은 물리 자세를 보간하므로 30Hz 등으로 낮춰도 움직임이 끊겨 보이지 않음
+    void SetFixedDeltaTime(float deltaTime) { fixedDeltaTime = deltaTime; }
+    float GetFixedDeltaTime() const { return fixedDeltaTime; }
+
+    // 이번 프레임 렌더 보간 비율 (fixedAccumulator / fixedDeltaTime, 플레이 중이 아니면 1)
+    float GetInterpolationAlpha() const { return interpolationAlpha; }
+
 private:
     HWND windowHandle = nullptr;
 
@@ -38,6 +46,9 @@ private:
 
     float clearColor[4] = { 0.1f, 0.1f, 0.3f, 1.f };
 
+    float fixedDeltaTime = 1.0f / 60.0f;
+    float interpolationAlpha = 1.0f;
+
     bool imguiInitialized;
 
     void InitializeImGui();
@@ -1,10 +1,24 @@
 #pragma once
 #include "Core/Entity.h"
+#include <cstdint>
+#include <type_traits>
 
 class GameObject;
 class Application;
 class BaseCollider;
 
+// 충돌/트리거 콜백 비트 (컴포넌트가 재정의한 콜백, GameObject 리스너 마스크)
+enum CollisionCallback : uint32_t
+{
+    CollisionCallback_CollisionEnter = 1u << 0,
+    CollisionCallback_CollisionStay  = 1u << 1,
+    CollisionCallback_CollisionExit  = 1u << 2,
+    CollisionCallback_TriggerEnter   = 1u << 3,
+    CollisionCallback_TriggerStay    = 1u << 4,
+    CollisionCallback_TriggerExit    = 1u << 5,
+    CollisionCallback_All            = (1u << 6) - 1
+};
+
 class Component : public Entity
 {
 public:
@@ -15,14 +29,14 @@ public:
     
     GameObject* GetGameObject() const { return gameObject; }
 
-    virtual void Awake() {}  // AddComponent  ȣ (ʱȭ)
+    virtual void Awake() {}  // AddComponent 직후 호출 (초기화)
     virtual void FixedUpdate(float fixedDelta) {}
     virtual void Update(float delta) {}
     virtual void LateUpdate(float delta) {}
     virtual void Render() {}
     virtual void RenderUI() {}
 
-	// Ȱȭ
+	// 활성화
     void SetEnabled(bool enable)
     {
         if (enabled == enable) return;
@@ -36,20 +50,26 @@ public:
 
     virtual void DebugDraw() {}
     
-    // OnCollision:  ȿ O, ̺Ʈ X, 浹 ó (Rigidbody ʿ  ݹ߷ )
+    // OnCollision: 물리 효과 O, 이벤트 X, 충돌 처리 (Rigidbody 필요 시 반발력 적용)
     virtual void OnCollisionEnter(BaseCollider* other) {}
     virtual void OnCollisionStay(BaseCollider* other) {}
     virtual void OnCollisionExit(BaseCollider* other) {}
 
-    // OnTrigger:  ȿ X, ̺Ʈ O,  ۵ (̺Ʈ ߻,  ȹ)
+    // OnTrigger: 물리 효과 X, 이벤트 O, 센서로 작동 (이벤트 발생용, 아이템 획득)
     virtual void OnTriggerEnter(BaseCollider* other) {}
     virtual void OnTriggerStay(BaseCollider* other) {}
     virtual void OnTriggerExit(BaseCollider* other) {}
     
-    virtual void OnDestroy() {}  // Component   ȣ ()
+    virtual void OnDestroy() {}  // Component 삭제 시 호출 (정리)
+
+    // 이 컴포넌트가 받는 충돌/트리거 콜백 (CollisionCallback 비트)
+    // AddComponent<T>와 스크립트 팩토리가 재정의 여부로 설정, 타입을 모르는 경우 전체
+    // 추가 후 바꾸면 GameObject::UpdateCollisionListeners 호출 필요
+    void SetCollisionCallbacks(uint32_t callbacks) { collisionCallbacks = callbacks; }
+    uint32_t GetCollisionCallbacks() const { return collisionCallbacks; }
 
 protected:
-    // Ʈ Ȱȭ/Ȱȭ ̺Ʈ
+    // 컴포넌트 활성화/비활성화 이벤트
     virtual void OnEnable() {}
     virtual void OnDisable() {}
 
@@ -57,4 +77,25 @@ protected:
     Application* application = nullptr;
     
     bool enabled = true;
-};
\ No newline at end of file
+
+private:
+    uint32_t collisionCallbacks = CollisionCallback_All;
+};
+
+// T(또는 T와 Component 사이 부모)가 재정의한 충돌/트리거 콜백 비트
+// 재정의하지 않은 멤버 함수 포인터는 Component 멤버 타입으로 남는 것을 이용 (컴파일 타임)
+template<typename T>
+constexpr uint32_t GetOverriddenCollisionCallbacks()
+{
+    static_assert(std::is_base_of<Component, T>::value, "T must inherit from Component.");
+    using Callback = void (Component::*)(BaseCollider*);
+
+    uint32_t callbacks = 0;
+    if (!std::is_same<decltype(&T::OnCollisionEnter), Callback>::value) callbacks |= CollisionCallback_CollisionEnter;
+    if (!std::is_same<decltype(&T::OnCollisionStay), Callback>::value)  callbacks |= CollisionCallback_CollisionStay;
+    if (!std::is_same<decltype(&T::OnCollisionExit), Callback>::value)  callbacks |= CollisionCallback_CollisionExit;
+    if (!std::is_same<decltype(&T::OnTriggerEnter), Callback>::value)   callbacks |= CollisionCallback_TriggerEnter;
+    if (!std::is_same<decltype(&T::OnTriggerStay), Callback>::value)    callbacks |= CollisionCallback_TriggerStay;
+    if (!std::is_same<decltype(&T::OnTriggerExit), Callback>::value)    callbacks |= CollisionCallback_TriggerExit;
+    return callbacks;
+}
\ No newline at end of file
@@ -1,6 +1,6 @@
 #pragma once
 
-//   ¸ ϴ ̱
+// 에디터의 현재 상태를 관리하는 싱글톤
 class EditorState
 {
 public:
@@ -13,15 +13,15 @@ public:
     EditorState(const EditorState&) = delete;
     EditorState& operator=(const EditorState&) = delete;
 
-    //   
+    // 에디터 모드 여부
     bool IsEditorMode() const { return isEditorMode; }
     void SetEditorMode(bool enabled) { isEditorMode = enabled; }
 
-    //  õ 
+    // 현재 선택된 씬
     int GetSelectedSceneIndex() const { return selectedSceneIndex; }
     void SetSelectedSceneIndex(int index) { selectedSceneIndex = index; }
 
-    //  ÷ 
+    // 게임 플레이 상태
     bool IsGamePlaying() const { return isGamePlaying; }
     void SetGamePlaying(bool playing) { isGamePlaying = playing; }
 
@@ -14,10 +14,10 @@ namespace Graphics
             std::wstring error = _com_error(hr).ErrorMessage();
 
             std::wstringstream ss;
-            ss << std::hex //  ڸ 16 ؼ
-                << std::uppercase // 16 ½ 빮ڷ ǥ
-                << std::setfill(L'0') //   ߱   L'0' ä
-                << std::setw(8) //  ּ  8ĭ 
+            ss << std::hex // 출력할 숫자를 16진수로 해석
+                << std::uppercase // 16진수 출력시 대문자로 표시
+                << std::setfill(L'0') // 출력 폭을 맞추기위해 남는 공간을 L'0'으로 채워라
+                << std::setw(8) // 출력 최소 폭을 8칸으로 설정
                 << hr;
 
             auto hrHex = ss.str();
@@ -37,14 +37,14 @@ namespace Graphics
         std::wstring log;
     };
 
-// ũο ڵ ڿ ȯ
+// 매크로용 유니코드 문자열 변환
 #define WIDE_STR_STEP2(x) L##x
 #define WIDE_STR_STEP1(x) WIDE_STR_STEP2(x)
 
 #define WFILE WIDE_STR_STEP1(__FILE__)
 #define WFUNC WIDE_STR_STEP1(__FUNCTION__)
 
-// COM  ˻ ũ
+// COM 에러 검사 매크로
 #define COM_ERROR_IF_FAILED(hr, msg) \
         if (FAILED(hr)) throw Graphics::Exception(hr, msg, WFILE, WFUNC, __LINE__);
 }
\ No newline at end of file
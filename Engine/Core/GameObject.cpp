@@ -1,5 +1,8 @@
 ﻿#include "Core/GameObject.h"
+#include "Physics/PhysicsSystem.h"
+#ifndef ENGINE_HEADLESS
 #include "UI/UIBase.h"
+#endif
 #include <algorithm>
 
 GameObject::~GameObject()
@@ -24,7 +27,11 @@ GameObject::~GameObject()
         parent = nullptr;
     }
 
-    // 3. 컴포넌트 삭제
+    // 3. 물리 월드에서 해제 (컴포넌트 삭제 전 일괄)
+    if (physicsWorld)
+        physicsWorld->RemoveGameObject(this);
+
+    // 4. 컴포넌트 삭제
     for (auto* comp : components)
     {
         comp->OnDestroy();
@@ -39,6 +46,18 @@ GameObject::GameObject()
     transform.SetOwner(this);
 }
 
+void GameObject::OnComponentAdded(Component* comp)
+{
+    if (physicsWorld)
+        physicsWorld->RegisterComponent(comp);
+}
+
+void GameObject::OnComponentRemoved(Component* comp)
+{
+    if (physicsWorld)
+        physicsWorld->UnregisterComponent(comp);
+}
+
 void GameObject::SetParent(GameObject* newParent)
 {
     // 기존 부모에서 제거
@@ -151,6 +170,7 @@ void GameObject::LateUpdate(float deltaTime)
 
 void GameObject::Render()
 {
+#ifndef ENGINE_HEADLESS
     // World 컴포넌트만 렌더링 (UIBase가 아닌 것)
     for (auto* comp : components)
     {
@@ -162,10 +182,12 @@ void GameObject::Render()
             comp->Render();
         }
     }
+#endif
 }
 
 void GameObject::RenderUI()
 {
+#ifndef ENGINE_HEADLESS
     // UI 컴포넌트만 렌더링 (UIBase 계열)
     for (auto* comp : components)
     {
@@ -177,6 +199,7 @@ void GameObject::RenderUI()
             comp->RenderUI();
         }
     }
+#endif
 }
 
 void GameObject::DebugRender()
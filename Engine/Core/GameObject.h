@@ -6,6 +6,7 @@
 #include "Core/Transform.h"
 
 class Application;
+class PhysicsSystem;
 
 class GameObject : public Component
 {
@@ -16,18 +17,22 @@ public:
     void FixedUpdate(float fixedDelta);
     void Update(float deltaTime);
     void LateUpdate(float deltaTime);
-    void Render();              // World 
-    void RenderUI();            // UI 
+    void Render();              // World 렌더링
+    void RenderUI();            // UI 렌더링
     void DebugRender();
 
     void SetApplication(Application* app) { application = app; }
     Application* GetApplication() const { return application; }
 
-    // ̸ /
+    // 물리 월드 (씬에 추가될 때 설정, 이후 추가/제거되는 컴포넌트는 자동 등록/해제)
+    void SetPhysicsWorld(PhysicsSystem* world) { physicsWorld = world; }
+    PhysicsSystem* GetPhysicsWorld() const { return physicsWorld; }
+
+    // 이름 설정/가져오기
     void SetName(const std::wstring& newName) { name = newName; }
     const std::wstring& GetName() const { return name; }
 
-    // θ-ڽ 
+    // 부모-자식 관계
     void SetParent(GameObject* parent);
     GameObject* GetParent() const { return parent; }
     
@@ -35,19 +40,22 @@ public:
     void RemoveChild(GameObject* child);
     const std::vector<GameObject*>& GetChildren() const { return children; }
     
-    // ڽ  
+    // 자식 순서 변경
     bool MoveChildBefore(GameObject* child, GameObject* target);
     bool MoveChildAfter(GameObject* child, GameObject* target);
 
-    // AddComponent ø
+    // AddComponent 템플릿
     template<typename T>
     T* AddComponent()
     {
         T* comp = new T();
+        comp->SetCollisionCallbacks(GetOverriddenCollisionCallbacks<T>());
         components.push_back(comp);
+        collisionListeners |= comp->GetCollisionCallbacks();
         comp->SetOwner(this);
         comp->SetApplication(application);
         comp->Awake();
+        OnComponentAdded(comp);
         
         return comp;
     }
@@ -58,10 +66,12 @@ public:
         if (comp)
         {
             components.push_back(comp);
+            collisionListeners |= comp->GetCollisionCallbacks();
+            OnComponentAdded(comp);
         }
     }
 
-    // GetComponent ø
+    // GetComponent 템플릿
     template<typename T>
     T* GetComponent()
     {
@@ -76,7 +86,7 @@ public:
         return nullptr;
     }
 
-    // RemoveComponent ø
+    // RemoveComponent 템플릿
     template<typename T>
     void RemoveComponent()
     {
@@ -87,9 +97,11 @@ public:
             T* casted = dynamic_cast<T*>(*it);
             if (casted != nullptr)
             {
+                OnComponentRemoved(casted);
                 casted->OnDestroy();
                 delete *it;
                 components.erase(it);
+                UpdateCollisionListeners();
                 return;
             }
         }
@@ -105,9 +117,11 @@ public:
         {
             if (*it == comp)
             {
+                OnComponentRemoved(comp);
                 comp->OnDestroy();
                 delete *it;
                 components.erase(it);
+                UpdateCollisionListeners();
                 return true;
             }
         }
@@ -119,15 +133,33 @@ public:
         return components;
     }
 
+    // 충돌/트리거 콜백을 재정의한 컴포넌트 비트 합 (CollisionCallback, 없는 이벤트는 전달 생략)
+    uint32_t GetCollisionListeners() const { return collisionListeners; }
+
+    // 컴포넌트 콜백 비트를 바꾼 뒤 다시 계산 (AddComponent/RemoveComponent는 자동)
+    void UpdateCollisionListeners()
+    {
+        collisionListeners = 0;
+        for (Component* comp : components)
+            collisionListeners |= comp->GetCollisionCallbacks();
+    }
+
 public:
     Transform transform;
 
 private:
-    std::wstring name;  // GameObject ̸
+    // 물리 월드 등록/해제 (Rigidbody2D, Collider)
+    void OnComponentAdded(Component* comp);
+    void OnComponentRemoved(Component* comp);
+
+private:
+    std::wstring name;  // GameObject 이름
     Application* application = nullptr;
+    PhysicsSystem* physicsWorld = nullptr;
     std::vector<Component*> components;
+    uint32_t collisionListeners = 0;  // 컴포넌트 콜백 비트 합
     
-    // θ-ڽ  (Transform )
+    // 부모-자식 관계 (Transform 계층)
     GameObject* parent = nullptr;
     std::vector<GameObject*> children;
 };
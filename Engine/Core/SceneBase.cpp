@@ -8,11 +8,11 @@ void SceneBase::AddGameObject(GameObject* object)
     if (!object)
         return;
     
-    // Canvas Ʈ ִ Ȯ
+    // Canvas 컴포넌트가 있는지 확인
     Canvas* canvas = object->GetComponent<Canvas>();
     if (canvas)
     {
-        // Canvas canvasGroups ߰
+        // Canvas는 canvasGroups에만 추가
         CanvasGroup group;
         group.canvas = canvas;
         group.canvasObject = object;
@@ -20,20 +20,20 @@ void SceneBase::AddGameObject(GameObject* object)
     }
     else
     {
-        // θ Canvas Ȯ
+        // 부모가 Canvas인지 확인
         GameObject* parent = object->GetParent();
         Canvas* parentCanvas = parent ? parent->GetComponent<Canvas>() : nullptr;
         
         if (parentCanvas)
         {
-            // Canvas ڽ UI ü  canvasGroups uiObjects ߰
+            // Canvas의 자식 UI 객체 → canvasGroups의 uiObjects에 추가
             for (auto& group : canvasGroups)
             {
                 if (group.canvasObject == parent)
                 {
                     group.uiObjects.push_back(object);
                     
-                    //  ڼյ uiObjects ߰ (ȭ)
+                    // 모든 자손도 uiObjects에 추가 (평면화)
                     CollectChildrenRecursive(object, group.uiObjects);
                     break;
                 }
@@ -41,11 +41,18 @@ void SceneBase::AddGameObject(GameObject* object)
         }
         else
         {
-            // Ϲ GameObject worldObjects ߰ (ڽ +  ڼ)
+            // 일반 GameObject는 worldObjects에 추가 (자신 + 모든 자손)
+            size_t firstIndex = worldObjects.size();
             worldObjects.push_back(object);
             
-            //  ڼյ  Ʈ ߰
+            // 모든 자손도 평면 리스트에 추가
             CollectChildrenRecursive(object, worldObjects);
+
+            // 물리 월드 등록 (Rigidbody2D/Collider는 이후 Step에서 스캔하지 않음)
+            for (size_t i = firstIndex; i < worldObjects.size(); i++)
+            {
+                physicsSystem.AddGameObject(worldObjects[i]);
+            }
         }
     }
 }
@@ -55,11 +62,11 @@ void SceneBase::AddUIObject(GameObject* object, GameObject* canvasObj)
     if (!object || !canvasObj)
         return;
     
-    // Canvas Ʈ  GameObject Ȯ
+    // Canvas 컴포넌트를 가진 GameObject인지 확인
     Canvas* canvas = object->GetComponent<Canvas>();
     if (canvas)
     {
-        // Canvas ü ߰
+        // Canvas 자체를 추가
         CanvasGroup group;
         group.canvas = canvas;
         group.canvasObject = object;
@@ -67,16 +74,16 @@ void SceneBase::AddUIObject(GameObject* object, GameObject* canvasObj)
     }
     else
     {
-        // Ϲ UI GameObject  Canvas ׷쿡 ߰
+        // 일반 UI GameObject는 지정된 Canvas 그룹에 추가
         for (auto& group : canvasGroups)
         {
             if (group.canvasObject == canvasObj)
             {
-                // UI ü  ڽ  Ʈ ߰
+                // UI 객체와 모든 자식을 평면 리스트에 추가
                 group.uiObjects.push_back(object);
-                object->SetParent(canvasObj);  // UI Canvas ڽ 
+                object->SetParent(canvasObj);  // UI는 Canvas의 자식으로 설정
                 
-                //  ڼյ uiObjects ߰ (ȭ)
+                // 모든 자손도 uiObjects에 추가 (평면화)
                 CollectChildrenRecursive(object, group.uiObjects);
                 break;
             }
@@ -89,15 +96,15 @@ void SceneBase::RebuildCanvasUIObjectsList(GameObject* canvasObj)
     if (!canvasObj)
         return;
     
-    // ش Canvas CanvasGroup ã
+    // 해당 Canvas의 CanvasGroup 찾기
     for (auto& group : canvasGroups)
     {
         if (group.canvasObject == canvasObj)
         {
-            //  uiObjects Ŭ
+            // 기존 uiObjects 클리어
             group.uiObjects.clear();
             
-            // Canvas  ڽ  Ʈ 
+            // Canvas의 모든 자식을 평면 리스트로 수집
             CollectChildrenRecursive(canvasObj, group.uiObjects);
             break;
         }
@@ -111,14 +118,14 @@ void SceneBase::MoveGameObjectBetweenArrays(GameObject* obj, GameObject* newPare
     
     GameObject* oldParent = obj->GetParent();
     
-    // 1.  迭 
+    // 1. 기존 배열에서 제거
     if (oldParent)
     {
-        //  θ Canvas Ȯ
+        // 기존 부모가 Canvas인지 확인
         Canvas* oldParentCanvas = oldParent->GetComponent<Canvas>();
         if (oldParentCanvas)
         {
-            // canvasGroups uiObjects 
+            // canvasGroups의 uiObjects에서 제거
             for (auto& group : canvasGroups)
             {
                 if (group.canvasObject == oldParent)
@@ -132,15 +139,15 @@ void SceneBase::MoveGameObjectBetweenArrays(GameObject* obj, GameObject* newPare
                 }
             }
         }
-        //  θ Ϲ GameObject Ư ó ʿ (θ-ڽ 踸 )
+        // 기존 부모가 일반 GameObject면 특별한 처리 불필요 (부모-자식 관계만 있음)
     }
     else
     {
-        // Ʈ ̾ - worldObjects Ǵ canvasGroups 
+        // 루트 레벨이었음 - worldObjects 또는 canvasGroups에서 제거
         Canvas* objCanvas = obj->GetComponent<Canvas>();
         if (objCanvas)
         {
-            // canvasGroups 
+            // canvasGroups에서 제거
             for (auto it = canvasGroups.begin(); it != canvasGroups.end(); ++it)
             {
                 if (it->canvasObject == obj)
@@ -152,23 +159,24 @@ void SceneBase::MoveGameObjectBetweenArrays(GameObject* obj, GameObject* newPare
         }
         else
         {
-            // worldObjects 
+            // worldObjects에서 제거
             auto it = std::find(worldObjects.begin(), worldObjects.end(), obj);
             if (it != worldObjects.end())
             {
                 worldObjects.erase(it);
+                physicsSystem.RemoveGameObject(obj);
             }
         }
     }
     
-    // 2.  迭 ߰
+    // 2. 새 배열에 추가
     if (newParent)
     {
-        //  θ Canvas Ȯ
+        // 새 부모가 Canvas인지 확인
         Canvas* newParentCanvas = newParent->GetComponent<Canvas>();
         if (newParentCanvas)
         {
-            // canvasGroups uiObjects ߰
+            // canvasGroups의 uiObjects에 추가
             for (auto& group : canvasGroups)
             {
                 if (group.canvasObject == newParent)
@@ -178,15 +186,15 @@ void SceneBase::MoveGameObjectBetweenArrays(GameObject* obj, GameObject* newPare
                 }
             }
         }
-        // Ϲ GameObject ڽ Ǹ 迭 ߰  (θ-ڽ θ )
+        // 일반 GameObject의 자식이 되면 배열에 추가하지 않음 (부모-자식 관계로만 관리)
     }
     else
     {
-        // Ʈ  ̵
+        // 루트 레벨로 이동
         Canvas* objCanvas = obj->GetComponent<Canvas>();
         if (objCanvas)
         {
-            // canvasGroups ߰
+            // canvasGroups에 추가
             CanvasGroup group;
             group.canvas = objCanvas;
             group.canvasObject = obj;
@@ -194,19 +202,20 @@ void SceneBase::MoveGameObjectBetweenArrays(GameObject* obj, GameObject* newPare
         }
         else
         {
-            // worldObjects ߰
+            // worldObjects에 추가
             worldObjects.push_back(obj);
+            physicsSystem.AddGameObject(obj);
         }
     }
 }
 
 void SceneBase::OnExit()
 {
-    // PhysicsSystem collider   
+    // PhysicsSystem의 collider 참조를 먼저 정리 (GameObject의 물리 월드 등록도 해제)
     physicsSystem.Clear();
     
-    // worldObjects Ʈ ü ãƼ 
-    // (ڽĵ worldObjects  θ Ҹڰ ڵ )
+    // worldObjects에서 루트 객체만 찾아서 삭제
+    // (자식들은 worldObjects에 있지만 부모 소멸자가 자동으로 삭제함)
     std::vector<GameObject*> rootObjects;
     for (auto* obj : worldObjects)
     {
@@ -216,17 +225,17 @@ void SceneBase::OnExit()
         }
     }
     
-    // Ʈ ü  ( Ҹڰ ڽĵ  )
+    // 루트 객체만 삭제 (각 소멸자가 자식들을 재귀적으로 삭제)
     for (auto* obj : rootObjects)
     {
         delete obj;
     }
     worldObjects.clear();
     
-    // Canvas UI 
+    // Canvas와 UI 삭제
     for (auto& group : canvasGroups)
     {
-        // Canvas Ʈ  (ڽĵ鵵  )
+        // Canvas 오브젝트 삭제 (자식들도 재귀적으로 삭제됨)
         if (group.canvasObject)
         {
             delete group.canvasObject;
@@ -237,21 +246,21 @@ void SceneBase::OnExit()
 
 void SceneBase::FixedUpdate(float fixedDelta)
 {
-    // worldObjects FixedUpdate ( ȸ)
+    // worldObjects FixedUpdate (평면 순회)
     for (auto* obj : worldObjects)
     {
         if (obj)
             obj->FixedUpdate(fixedDelta);
     }
     
-    // Canvas UI FixedUpdate ( ȸ)
+    // Canvas와 UI FixedUpdate (평면 순회)
     for (auto& group : canvasGroups)
     {
-        // Canvas ü Ʈ
+        // Canvas 자체 업데이트
         if (group.canvasObject)
             group.canvasObject->FixedUpdate(fixedDelta);
         
-        // ϵ  UI ü Ʈ
+        // 등록된 모든 UI 객체 업데이트
         for (auto* uiObj : group.uiObjects)
         {
             if (uiObj)
@@ -259,27 +268,27 @@ void SceneBase::FixedUpdate(float fixedDelta)
         }
     }
 
-    // PhysicsSystem Ʈ (Ʈ )
-    physicsSystem.Step(worldObjects, fixedDelta);
+    // PhysicsSystem 업데이트 (등록된 강체/콜라이더만 순회)
+    physicsSystem.Step(fixedDelta);
 }
 
 void SceneBase::Update(float deltaTime)
 {
-    // worldObjects Update ( ȸ)
+    // worldObjects Update (평면 순회)
     for (auto* obj : worldObjects)
     {
         if (obj)
             obj->Update(deltaTime);
     }
     
-    // Canvas UI Update ( ȸ)
+    // Canvas와 UI Update (평면 순회)
     for (auto& group : canvasGroups)
     {
-        // Canvas ü Ʈ
+        // Canvas 자체 업데이트
         if (group.canvasObject)
             group.canvasObject->Update(deltaTime);
         
-        // ϵ  UI ü Ʈ
+        // 등록된 모든 UI 객체 업데이트
         for (auto* uiObj : group.uiObjects)
         {
             if (uiObj)
@@ -290,21 +299,21 @@ void SceneBase::Update(float deltaTime)
 
 void SceneBase::LateUpdate(float deltaTime)
 {
-    // worldObjects LateUpdate ( ȸ)
+    // worldObjects LateUpdate (평면 순회)
     for (auto* obj : worldObjects)
     {
         if (obj)
             obj->LateUpdate(deltaTime);
     }
     
-    // Canvas UI LateUpdate ( ȸ)
+    // Canvas와 UI LateUpdate (평면 순회)
     for (auto& group : canvasGroups)
     {
-        // Canvas ü Ʈ
+        // Canvas 자체 업데이트
         if (group.canvasObject)
             group.canvasObject->LateUpdate(deltaTime);
         
-        // ϵ  UI ü Ʈ
+        // 등록된 모든 UI 객체 업데이트
         for (auto* uiObj : group.uiObjects)
         {
             if (uiObj)
@@ -315,7 +324,7 @@ void SceneBase::LateUpdate(float deltaTime)
 
 void SceneBase::Render()
 {
-    // worldObjects  ( ȸ)
+    // worldObjects 렌더링 (평면 순회)
     for (auto* obj : worldObjects)
     {
         if (obj)
@@ -325,23 +334,23 @@ void SceneBase::Render()
 
 void SceneBase::RenderUI()
 {
-    // canvasGroups  Canvas UI 
+    // canvasGroups를 통해 Canvas와 UI 렌더링
     if (canvasGroups.empty())
         return;
     
-    //  Canvas  ( ȸ)
+    // 각 Canvas별로 렌더링 (평면 순회)
     for (const auto& group : canvasGroups)
     {
         if (!group.canvas || !group.canvas->IsEnabled())
             continue;
         
-        // Canvas GameObject ü 
+        // Canvas GameObject 자체 렌더링
         if (group.canvasObject)
         {
             group.canvasObject->RenderUI();
         }
         
-        // ϵ  UI ü 
+        // 등록된 모든 UI 객체 렌더링
         for (auto* uiObj : group.uiObjects)
         {
             if (uiObj)
@@ -354,21 +363,21 @@ void SceneBase::RenderUI()
 
 void SceneBase::DebugRender()
 {
-    // worldObjects   ( ȸ)
+    // worldObjects 디버그 렌더 (평면 순회)
     for (auto* obj : worldObjects)
     {
         if (obj)
             obj->DebugRender();
     }
     
-    // Canvas UI   ( ȸ)
+    // Canvas와 UI 디버그 렌더 (평면 순회)
     for (auto& group : canvasGroups)
     {
-        // Canvas ü  
+        // Canvas 자체 디버그 렌더
         if (group.canvasObject)
             group.canvasObject->DebugRender();
         
-        // ϵ  UI ü  
+        // 등록된 모든 UI 객체 디버그 렌더
         for (auto* uiObj : group.uiObjects)
         {
             if (uiObj)
@@ -377,7 +386,7 @@ void SceneBase::DebugRender()
     }
 }
 
-//  ڽ  Ʈ  ()
+// 모든 자식을 평면 리스트에 수집 (재귀적)
 void SceneBase::CollectChildrenRecursive(GameObject* parent, std::vector<GameObject*>& outList) const
 {
     if (!parent) return;
@@ -388,7 +397,7 @@ void SceneBase::CollectChildrenRecursive(GameObject* parent, std::vector<GameObj
         if (child)
         {
             outList.push_back(child);
-            CollectChildrenRecursive(child, outList);  // ڽ ڽĵ 
+            CollectChildrenRecursive(child, outList);  // 자식의 자식도 수집
         }
     }
 }
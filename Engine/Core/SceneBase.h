@@ -11,7 +11,7 @@ class Application;
 class SceneBase
 {
 public:
-    // Canvas UI 
+    // Canvas별로 UI 관리
     struct CanvasGroup
     {
         Canvas* canvas;
@@ -31,44 +31,45 @@ public:
     virtual void RenderUI();
     virtual void DebugRender();
 
-    //  GameObject  (Hierarchy â )
+    // 모든 GameObject 접근 (Hierarchy 창을 위해)
     const std::vector<GameObject*>& GetAllGameObjects() const 
     { 
-        return worldObjects;  // worldObjects  ȯ (  )
+        return worldObjects;  // worldObjects 직접 반환 (정렬 순서 유지)
     }
     
-    // Canvas Ʈ鵵 
+    // Canvas 오브젝트들도 가져오기
     const std::vector<CanvasGroup>& GetCanvasGroups() const
     {
         return canvasGroups;
     }
 
-    // Application /
+    // Application 설정/가져오기
     void SetApplication(Application* app) { application = app; }
     Application* GetApplication() { return application; }
 
-    //  ̸ /
+    // 씬 이름 설정/가져오기
     void SetSceneName(const std::wstring& name) { sceneName = name; }
     std::wstring GetCurrentSceneName() const { return sceneName; }
 
-    // GameObject ߰ (public  - Serializer )
+    // GameObject 추가 (public으로 공개 - Serializer에서 사용)
     void AddGameObject(GameObject* object);
     
-    // GameObject 
+    // GameObject 제거
     void RemoveGameObject(GameObject* object)
     {
         if (!object)
             return;
         
-        // worldObjects  õ
+        // worldObjects에서 제거 시도
         auto it = std::find(worldObjects.begin(), worldObjects.end(), object);
         if (it != worldObjects.end())
         {
             worldObjects.erase(it);
+            physicsSystem.RemoveGameObject(object);
             return;
         }
         
-        // Canvas GameObject Ȯ (canvasGroups )
+        // Canvas GameObject인지 확인 (canvasGroups에서 제거)
         for (auto groupIt = canvasGroups.begin(); groupIt != canvasGroups.end(); ++groupIt)
         {
             if (groupIt->canvasObject == object)
@@ -77,7 +78,7 @@ public:
                 return;
             }
             
-            // Canvas ڽ UI  õ
+            // Canvas의 자식 UI에서 제거 시도
             auto uiIt = std::find(groupIt->uiObjects.begin(), groupIt->uiObjects.end(), object);
             if (uiIt != groupIt->uiObjects.end())
             {
@@ -87,28 +88,74 @@ public:
         }
     }
     
-    // UI GameObject  (Canvas ʼ)
+    // UI GameObject 등록 (Canvas 필수)
     void AddUIObject(GameObject* object, GameObject* canvasObj);
     
-    // Canvas  ڽ  Ʈ 籸 (ε  ȣ)
+    // Canvas의 모든 자식을 평면 리스트로 재구축 (로드 후 호출)
     void RebuildCanvasUIObjectsList(GameObject* canvasObj);
     
-    // GameObject 迭  ̵ (worldObjects <-> canvasGroups.uiObjects)
+    // GameObject를 배열 간 이동 (worldObjects <-> canvasGroups.uiObjects)
     void MoveGameObjectBetweenArrays(GameObject* obj, GameObject* newParent);
 
+    // 물리 월드 (스크립트 공간 쿼리용)
+    PhysicsSystem& GetPhysicsSystem() { return physicsSystem; }
+
+    // 공간 쿼리 (PhysicsSystem 전달, 결과는 호출자 버퍼)
+    bool Raycast(const XMFLOAT2& origin, const XMFLOAT2& direction, float maxDistance,
+                 RaycastHit& outHit, uint32_t layerMask = PhysicsSystem::AllLayers)
+    {
+        return physicsSystem.Raycast(origin, direction, maxDistance, outHit, layerMask);
+    }
+
+    int RaycastAll(const XMFLOAT2& origin, const XMFLOAT2& direction, float maxDistance,
+                   RaycastHit* outHits, int maxHits, uint32_t layerMask = PhysicsSystem::AllLayers)
+    {
+        return physicsSystem.RaycastAll(origin, direction, maxDistance, outHits, maxHits, layerMask);
+    }
+
+    bool CircleCast(const XMFLOAT2& origin, float radius, const XMFLOAT2& direction, float maxDistance,
+                    RaycastHit& outHit, uint32_t layerMask = PhysicsSystem::AllLayers)
+    {
+        return physicsSystem.CircleCast(origin, radius, direction, maxDistance, outHit, layerMask);
+    }
+
+    bool BoxCast(const XMFLOAT2& center, const XMFLOAT2& halfSize, float angle, const XMFLOAT2& direction,
+                 float maxDistance, RaycastHit& outHit, uint32_t layerMask = PhysicsSystem::AllLayers)
+    {
+        return physicsSystem.BoxCast(center, halfSize, angle, direction, maxDistance, outHit, layerMask);
+    }
+
+    int OverlapPoint(const XMFLOAT2& point, BaseCollider** outColliders, int maxColliders,
+                     uint32_t layerMask = PhysicsSystem::AllLayers)
+    {
+        return physicsSystem.OverlapPoint(point, outColliders, maxColliders, layerMask);
+    }
+
+    int OverlapCircle(const XMFLOAT2& center, float radius, BaseCollider** outColliders, int maxColliders,
+                      uint32_t layerMask = PhysicsSystem::AllLayers)
+    {
+        return physicsSystem.OverlapCircle(center, radius, outColliders, maxColliders, layerMask);
+    }
+
+    int OverlapBox(const XMFLOAT2& center, const XMFLOAT2& halfSize, float angle, BaseCollider** outColliders,
+                   int maxColliders, uint32_t layerMask = PhysicsSystem::AllLayers)
+    {
+        return physicsSystem.OverlapBox(center, halfSize, angle, outColliders, maxColliders, layerMask);
+    }
+
 protected:
     Application* application = nullptr;
     std::wstring sceneName = L"Untitled";
 
-    //  Ʈ GameObject Ʈ (Ʈ - Ʈ/)
+    // 월드 오브젝트 GameObject 리스트 (루트만 - 업데이트/렌더링용)
     std::vector<GameObject*> worldObjects;
     
-    // Canvas ׷ 
+    // Canvas 그룹 벡터
     std::vector<CanvasGroup> canvasGroups;
 
     // PhysicsSystem
     PhysicsSystem physicsSystem;
     
-    // ڽ ü  ϴ  Լ (ȭ)
+    // 자식 객체를 재귀적으로 수집하는 헬퍼 함수 (평면화용)
     void CollectChildrenRecursive(GameObject* parent, std::vector<GameObject*>& outList) const;
 };
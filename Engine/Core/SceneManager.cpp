@@ -31,17 +31,17 @@ bool SceneManager::LoadSceneFromData(const std::wstring& sceneAssetName, Applica
     if (!app)
         return false;
 
-    // Resources SceneData 
+    // Resources에서 SceneData 가져오기
     auto sceneData = Resources::Get<SceneData>(sceneAssetName);
     if (!sceneData)
         return false;
 
-    //   
+    // 새 씬 생성
     auto scene = std::make_unique<SceneBase>();
     scene->SetApplication(app);
     scene->SetSceneName(sceneData->GetSceneName());
 
-    // SceneData JSONκ GameObject ε
+    // SceneData의 JSON으로부터 GameObject 로드
     const auto& data = sceneData->GetData();
     if (data.contains("gameObjects"))
     {
@@ -55,21 +55,21 @@ bool SceneManager::LoadSceneFromData(const std::wstring& sceneAssetName, Applica
         }
     }
 
-    //  ߰
+    // 씬 추가
     std::wstring sceneName = sceneData->GetSceneName();
     AddScene(sceneName, std::move(scene));
 
     return true;
 }
 
-// SetActiveScene (̸ )
+// SetActiveScene (이름 기반)
 void SceneManager::SetActiveScene(const std::wstring& name)
 {
     auto it = sceneLookup.find(name);
     if (it == sceneLookup.end())
         return;
 
-    // sceneLookup  ͸ ã ε ȯ
+    // sceneLookup에서 씬 포인터를 찾고 인덱스로 변환
     for (int i = 0; i < static_cast<int>(sceneList.size()); ++i)
     {
         if (sceneList[i].get() == it->second)
@@ -80,10 +80,10 @@ void SceneManager::SetActiveScene(const std::wstring& name)
     }
 }
 
-// SetActiveScene (ε )
+// SetActiveScene (인덱스 기반)
 void SceneManager::SetActiveScene(int index)
 {
-    //  ȯ 
+    // 지연 전환으로 저장
     if (index >= 0 && index < static_cast<int>(sceneList.size()))
     {
         pendingSceneChange = true;
@@ -93,10 +93,10 @@ void SceneManager::SetActiveScene(int index)
 
 void SceneManager::SetActiveSceneImmediate(int index)
 {
-    // ε ȿ ˻
+    // 인덱스 유효성 검사
     if (index < 0 || index >= static_cast<int>(sceneList.size()))
     {
-        // ȿ  ε (None  )
+        // 유효하지 않은 인덱스 (None 씬인 경우)
         if (currentScene)
         {
             currentScene->OnExit();
@@ -107,21 +107,21 @@ void SceneManager::SetActiveSceneImmediate(int index)
         return;
     }
 
-    //    ̸ 
+    // 이전 씬과 같은 씬이면 무시
     if (currentScene == sceneList[index].get())
         return;
 
-    //  Scene Exit ȣ   
+    // 현재 Scene Exit 호출 및 완전 정리
     if (currentScene)
     {
         currentScene->OnExit();
-        currentScene = nullptr;  //  nullptr Ͽ ߰  
+        currentScene = nullptr;  // 즉시 nullptr로 설정하여 중간 상태 방지
     }
 
-    // ο  SceneData ٽ ε
+    // 새로운 씬을 SceneData에서 다시 로드
     currentIndex = index;
     
-    //  ̸ 
+    // 씬 이름 가져오기
     if (currentIndex >= 0 && currentIndex < static_cast<int>(sceneNameList.size()))
     {
         std::wstring sceneName = sceneNameList[currentIndex];
@@ -131,16 +131,16 @@ void SceneManager::SetActiveSceneImmediate(int index)
         {
             Application* app = currentScenePtr->GetApplication();
             
-            // SceneData  ٽ ε
+            // SceneData에서 씬을 다시 로드
             auto sceneData = Resources::Get<SceneData>(sceneName);
             if (sceneData)
             {
-                //   
+                // 새 씬 생성
                 auto newScene = std::make_unique<SceneBase>();
                 newScene->SetApplication(app);
                 newScene->SetSceneName(sceneData->GetSceneName());
                 
-                // SceneData JSONκ GameObject ε
+                // SceneData의 JSON으로부터 GameObject 로드
                 const auto& data = sceneData->GetData();
                 if (data.contains("gameObjects"))
                 {
@@ -154,16 +154,16 @@ void SceneManager::SetActiveSceneImmediate(int index)
                     }
                 }
                 
-                //     ü
+                // 기존 씬을 새 씬으로 교체
                 sceneList[currentIndex] = std::move(newScene);
                 currentScene = sceneList[currentIndex].get();
                 
-                // sceneLookup Ʈ
+                // sceneLookup 업데이트
                 sceneLookup[sceneName] = currentScene;
             }
             else
             {
-                // SceneData    
+                // SceneData가 없으면 기존 씬 사용
                 currentScene = sceneList[currentIndex].get();
             }
         }
@@ -185,11 +185,11 @@ void SceneManager::SetActiveSceneImmediate(int index)
 
 void SceneManager::ReloadCurrentScene()
 {
-    //    ε  
+    // 현재 씬이 없으면 리로드할 것이 없음
     if (currentIndex < 0 || currentIndex >= static_cast<int>(sceneList.size()))
         return;
     
-    //  ̸ Ʈ ְų ε   
+    // 씬 이름 리스트가 비어있거나 인덱스가 범위를 벗어나면 리턴
     if (sceneNameList.empty() || currentIndex >= static_cast<int>(sceneNameList.size()))
         return;
     
@@ -200,7 +200,7 @@ void SceneManager::ReloadCurrentScene()
     
     Application* app = currentScenePtr->GetApplication();
     
-    //  ̸  (ϰ)
+    // 씬 이름 가져오기 (안전하게)
     std::wstring sceneName;
     try
     {
@@ -213,19 +213,19 @@ void SceneManager::ReloadCurrentScene()
         return;
     }
     
-    //     
+    // 현재 씬 종료 및 정리
     currentScenePtr->OnExit();
     
-    //   ε (SceneData)
+    // 씬을 새로 로드 (SceneData에서)
     auto sceneData = Resources::Get<SceneData>(sceneName);
     if (sceneData)
     {
-        //   
+        // 새 씬 생성
         auto newScene = std::make_unique<SceneBase>();
         newScene->SetApplication(app);
         newScene->SetSceneName(sceneData->GetSceneName());
         
-        // SceneData JSONκ GameObject ε
+        // SceneData의 JSON으로부터 GameObject 로드
         const auto& data = sceneData->GetData();
         if (data.contains("gameObjects"))
         {
@@ -239,16 +239,16 @@ void SceneManager::ReloadCurrentScene()
             }
         }
         
-        //     ü
+        // 기존 씬을 새 씬으로 교체
         sceneList[currentIndex] = std::move(newScene);
         currentScene = sceneList[currentIndex].get();
         
-        //   ʱȭ
+        // 새 씬 초기화
         currentScene->OnEnter();
     }
     else
     {
-        // SceneData   OnEnter ٽ ȣ
+        // SceneData가 없으면 기존 OnEnter만 다시 호출
         currentScene->OnEnter();
     }
 }
@@ -266,7 +266,7 @@ nlohmann::json SceneManager::SaveSceneSnapshot()
     const auto& objects = currentScene->GetAllGameObjects();
     for (GameObject* obj : objects)
     {
-        // Ʈ Ʈ  (ڽ  )
+        // 루트 오브젝트만 저장 (자식은 재귀적으로 저장됨)
         if (obj && obj->GetParent() == nullptr)
         {
             snapshot["gameObjects"].push_back(SceneSerializer::SerializeGameObject(obj));
@@ -286,21 +286,21 @@ void SceneManager::RestoreSceneSnapshot(const nlohmann::json& snapshot)
     
     Application* app = currentScene->GetApplication();
     
-    //   
+    // 현재 씬 정리
     currentScene->OnExit();
     
-    //   
+    // 새 씬 생성
     auto newScene = std::make_unique<SceneBase>();
     newScene->SetApplication(app);
     
-    //  ̸ 
+    // 씬 이름 복원
     if (snapshot.contains("sceneName"))
     {
         std::string sceneName = snapshot["sceneName"];
         newScene->SetSceneName(SceneSerializer::StringToWString(sceneName));
     }
     
-    // GameObject 
+    // GameObject 복원
     for (const auto& objData : snapshot["gameObjects"])
     {
         GameObject* obj = SceneSerializer::DeserializeGameObject(objData, app);
@@ -310,11 +310,11 @@ void SceneManager::RestoreSceneSnapshot(const nlohmann::json& snapshot)
         }
     }
     
-    //  ü
+    // 씬 교체
     sceneList[currentIndex] = std::move(newScene);
     currentScene = sceneList[currentIndex].get();
     
-    //   ʱȭ
+    // 새 씬 초기화
     currentScene->OnEnter();
 }
 
@@ -323,7 +323,7 @@ void SceneManager::ProcessPendingSceneChange()
     if (!pendingSceneChange)
         return;
 
-    // ε ȿ 
+    // 인덱스 유효성 검증
     if (pendingSceneIndex < 0 || pendingSceneIndex >= static_cast<int>(sceneList.size()))
     {
         pendingSceneChange = false;
@@ -331,7 +331,7 @@ void SceneManager::ProcessPendingSceneChange()
         return;
     }
 
-    //    ̸ 
+    // 이전 씬과 같은 씬이면 무시
     if (currentScene == sceneList[pendingSceneIndex].get())
     {
         pendingSceneChange = false;
@@ -339,17 +339,17 @@ void SceneManager::ProcessPendingSceneChange()
         return;
     }
 
-    //  Scene Exit ȣ   
+    // 현재 Scene Exit 호출 및 완전 정리
     if (currentScene)
     {
         currentScene->OnExit();
-        currentScene = nullptr;  //  nullptr Ͽ ߰  
+        currentScene = nullptr;  // 즉시 nullptr로 설정하여 중간 상태 방지
     }
 
-    // ο  SceneData ٽ ε
+    // 새로운 씬을 SceneData에서 다시 로드
     currentIndex = pendingSceneIndex;
     
-    //  ̸ 
+    // 씬 이름 가져오기
     if (currentIndex >= 0 && currentIndex < static_cast<int>(sceneNameList.size()))
     {
         std::wstring sceneName = sceneNameList[currentIndex];
@@ -359,16 +359,16 @@ void SceneManager::ProcessPendingSceneChange()
         {
             Application* app = currentScenePtr->GetApplication();
             
-            // SceneData  ٽ ε
+            // SceneData에서 씬을 다시 로드
             auto sceneData = Resources::Get<SceneData>(sceneName);
             if (sceneData)
             {
-                //   
+                // 새 씬 생성
                 auto newScene = std::make_unique<SceneBase>();
                 newScene->SetApplication(app);
                 newScene->SetSceneName(sceneData->GetSceneName());
                 
-                // SceneData JSONκ GameObject ε
+                // SceneData의 JSON으로부터 GameObject 로드
                 const auto& data = sceneData->GetData();
                 if (data.contains("gameObjects"))
                 {
@@ -382,16 +382,16 @@ void SceneManager::ProcessPendingSceneChange()
                     }
                 }
                 
-                //     ü
+                // 기존 씬을 새 씬으로 교체
                 sceneList[currentIndex] = std::move(newScene);
                 currentScene = sceneList[currentIndex].get();
                 
-                // sceneLookup Ʈ
+                // sceneLookup 업데이트
                 sceneLookup[sceneName] = currentScene;
             }
             else
             {
-                // SceneData    
+                // SceneData가 없으면 기존 씬 사용
                 currentScene = sceneList[currentIndex].get();
             }
         }
@@ -410,12 +410,12 @@ void SceneManager::ProcessPendingSceneChange()
         currentScene->OnEnter();
     }
 
-    // ÷ ʱȭ
+    // 플래그 초기화
     pendingSceneChange = false;
     pendingSceneIndex = -1;
 }
 
-// Ʈ Լ
+// 업데이트 함수들
 void SceneManager::FixedUpdate(float dt)
 {
     if (currentScene)
@@ -433,7 +433,7 @@ void SceneManager::LateUpdate(float dt)
     if (currentScene)
         currentScene->LateUpdate(dt);
     
-    //  Ʈ   Scene ȯ ó
+    // 모든 업데이트가 끝난 후 Scene 전환 처리
     ProcessPendingSceneChange();
 }
 
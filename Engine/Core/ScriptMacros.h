@@ -13,9 +13,14 @@ typedef void (*RegisterScriptFunc)(const std::string& className, Component* (*fa
 
 // Macro to register a script component (use outside class definition)
 // This creates a factory function and a registration function
+// The factory records which collision/trigger callbacks the class overrides
 #define REGISTER_SCRIPT(ClassName) \
     namespace { \
-        Component* Create##ClassName() { return new ClassName(); } \
+        Component* Create##ClassName() { \
+            Component* component = new ClassName(); \
+            component->SetCollisionCallbacks(GetOverriddenCollisionCallbacks<ClassName>()); \
+            return component; \
+        } \
         struct Register##ClassName##Helper { \
             Register##ClassName##Helper() {} \
             void Register(RegisterScriptFunc registerFunc) { \
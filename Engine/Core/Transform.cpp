@@ -10,13 +10,21 @@ Transform::Transform()
 
 void Transform::SetPosition(float x, float y)
 {
+    if (position.x == x && position.y == y)
+        return;
+
     position = { x, y };
+    version++;
 }
 
 void Transform::Translate(float dx, float dy)
 {
+    if (dx == 0.0f && dy == 0.0f)
+        return;
+
     position.x += dx;
     position.y += dy;
+    version++;
 }
 
 XMFLOAT2 Transform::GetPosition() const
@@ -24,12 +32,12 @@ XMFLOAT2 Transform::GetPosition() const
     return position;
 }
 
-//  ǥ  (θ Transform  )
+// 월드 좌표 계산 (부모 Transform 재귀 적용)
 XMFLOAT2 Transform::GetWorldPosition() const
 {
     XMFLOAT2 worldPos = position;
     
-    // θ   θ  ġ 
+    // 부모가 있으면 재귀적으로 부모의 월드 위치를 더함
     if (gameObject && gameObject->GetParent())
     {
         XMFLOAT2 parentWorldPos = gameObject->GetParent()->transform.GetWorldPosition();
@@ -42,7 +50,11 @@ XMFLOAT2 Transform::GetWorldPosition() const
 
 void Transform::SetScale(float x, float y)
 {
+    if (scale.x == x && scale.y == y)
+        return;
+
     scale = { x, y };
+    version++;
 }
 
 XMFLOAT2 Transform::GetScale() const
@@ -50,12 +62,12 @@ XMFLOAT2 Transform::GetScale() const
     return scale;
 }
 
-//    (θ Transform  )
+// 월드 스케일 계산 (부모 Transform 재귀 적용)
 XMFLOAT2 Transform::GetWorldScale() const
 {
     XMFLOAT2 worldScale = scale;
     
-    // θ   θ  ϰ 
+    // 부모가 있으면 재귀적으로 부모의 월드 스케일과 곱함
     if (gameObject && gameObject->GetParent())
     {
         XMFLOAT2 parentWorldScale = gameObject->GetParent()->transform.GetWorldScale();
@@ -68,7 +80,11 @@ XMFLOAT2 Transform::GetWorldScale() const
 
 void Transform::SetRotation(float radians)
 {
+    if (rotation == radians)
+        return;
+
     rotation = radians;
+    version++;
 }
 
 float Transform::GetRotation() const
@@ -76,12 +92,12 @@ float Transform::GetRotation() const
     return rotation;
 }
 
-//  ȸ  (θ Transform  )
+// 월드 회전 계산 (부모 Transform 재귀 적용)
 float Transform::GetWorldRotation() const
 {
     float worldRot = rotation;
     
-    // θ   θ  ȸ 
+    // 부모가 있으면 재귀적으로 부모의 월드 회전을 더함
     if (gameObject && gameObject->GetParent())
     {
         worldRot += gameObject->GetParent()->transform.GetWorldRotation();
@@ -92,15 +108,58 @@ float Transform::GetWorldRotation() const
 
 XMMATRIX Transform::GetWorldMatrix() const
 {
-    //  Transform  (  θ )
+    // 월드 Transform 계산 (재귀적으로 모든 부모 포함)
     XMFLOAT2 worldPos = GetWorldPosition();
     XMFLOAT2 worldScale = GetWorldScale();
     float worldRot = GetWorldRotation();
 
-    // World Matrix  (S * R * T)
+    // World Matrix 생성 (S * R * T)
     XMMATRIX t = XMMatrixTranslation(worldPos.x, worldPos.y, 0.0f);
     XMMATRIX r = XMMatrixRotationZ(worldRot);
     XMMATRIX s = XMMatrixScaling(worldScale.x, worldScale.y, 1.0f);
 
     return s * r * t;
 }
+
+void Transform::SetInterpolationStart(const XMFLOAT2& previousPositionValue, float previousRotationValue)
+{
+    previousPosition = previousPositionValue;
+    previousRotation = previousRotationValue;
+    interpolationVersion = version;
+    hasInterpolation = true;
+}
+
+// 보간 월드 좌표 (로컬 자세를 보간한 뒤 부모의 보간 월드 위치를 더함)
+XMFLOAT2 Transform::GetInterpolatedWorldPosition(float alpha) const
+{
+    XMFLOAT2 worldPos = position;
+
+    if (IsInterpolating())
+    {
+        worldPos.x = previousPosition.x + (position.x - previousPosition.x) * alpha;
+        worldPos.y = previousPosition.y + (position.y - previousPosition.y) * alpha;
+    }
+
+    if (gameObject && gameObject->GetParent())
+    {
+        XMFLOAT2 parentWorldPos = gameObject->GetParent()->transform.GetInterpolatedWorldPosition(alpha);
+        worldPos.x += parentWorldPos.x;
+        worldPos.y += parentWorldPos.y;
+    }
+
+    return worldPos;
+}
+
+// 보간 월드 회전 (물리 회전은 누적값이라 감싸지 않고 선형 보간)
+float Transform::GetInterpolatedWorldRotation(float alpha) const
+{
+    float worldRot = rotation;
+
+    if (IsInterpolating())
+        worldRot = previousRotation + (rotation - previousRotation) * alpha;
+
+    if (gameObject && gameObject->GetParent())
+        worldRot += gameObject->GetParent()->transform.GetInterpolatedWorldRotation(alpha);
+
+    return worldRot;
+}
@@ -15,25 +15,49 @@ public:
     // Position
     void SetPosition(float x, float y);
     void Translate(float dx, float dy);
-    XMFLOAT2 GetPosition() const;        //  ġ
-    XMFLOAT2 GetWorldPosition() const;   //  ġ (θ )
+    XMFLOAT2 GetPosition() const;        // 로컬 위치
+    XMFLOAT2 GetWorldPosition() const;   // 월드 위치 (부모 포함)
 
     // Scale
     void SetScale(float x, float y);
-    XMFLOAT2 GetScale() const;           //  
-    XMFLOAT2 GetWorldScale() const;      //   (θ )
+    XMFLOAT2 GetScale() const;           // 로컬 스케일
+    XMFLOAT2 GetWorldScale() const;      // 월드 스케일 (부모 포함)
 
     // Rotation (radians)
     void SetRotation(float radians);
-    float GetRotation() const;           //  ȸ
-    float GetWorldRotation() const;      //  ȸ (θ )
+    float GetRotation() const;           // 로컬 회전
+    float GetWorldRotation() const;      // 월드 회전 (부모 포함)
 
-    // World matrix (θ Transform )
+    // World matrix (부모 Transform 포함)
     XMMATRIX GetWorldMatrix() const;
 
+    // 로컬 위치/스케일/회전이 실제로 바뀔 때마다 증가 (콜라이더 형태 캐시 갱신 판단용)
+    unsigned int GetVersion() const { return version; }
+
+    // ========== 렌더 보간 (고정 스텝 물리 사이 프레임) ==========
+    // - 물리 스텝이 위치/회전을 기록할 때 스텝 직전 로컬 자세를 함께 남김
+    // - 그 뒤 Transform이 다시 바뀌면(스크립트 이동, 순간이동) 보간하지 않고 현재 자세를 사용
+    // - alpha = 0이면 스텝 직전, 1이면 현재 자세 (부모도 각자 보간해서 합침)
+    void SetInterpolationStart(const XMFLOAT2& previousPosition, float previousRotation);
+    void ClearInterpolation() { hasInterpolation = false; }
+
+    XMFLOAT2 GetInterpolatedWorldPosition(float alpha) const;
+    float GetInterpolatedWorldRotation(float alpha) const;
+
+private:
+    // 보간 시작 자세가 유효한지 (기록 이후 Transform이 바뀌지 않음)
+    bool IsInterpolating() const { return hasInterpolation && interpolationVersion == version; }
+
 private:
     GameObject* gameObject = nullptr;
     XMFLOAT2 position;
     XMFLOAT2 scale;
     float rotation; // radians
+    unsigned int version = 0;
+
+    // 렌더 보간 시작 자세 (물리 스텝 직전 로컬 위치/회전)
+    XMFLOAT2 previousPosition = { 0.0f, 0.0f };
+    float previousRotation = 0.0f;
+    unsigned int interpolationVersion = 0;  // 기록 시점 version
+    bool hasInterpolation = false;
 };
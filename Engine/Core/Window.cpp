@@ -1,7 +1,7 @@
 #include "Core/Window.h"
 #include <windowsx.h> // GET_X_LPARAM, GET_Y_LPARAM, GET_WHEEL_DELTA_WPARAM
 
-// ImGui Win32 ڵ鷯
+// ImGui Win32 핸들러
 #include <ImGui/imgui.h>
 #include <ImGui/imgui_impl_win32.h>
 
@@ -78,7 +78,7 @@ HWND Window::GetHandle() const
 
 LRESULT CALLBACK Window::WindowProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
-    // ImGui  ޽ 
+    // ImGui에 먼저 메시지 전달
     if (ImGui_ImplWin32_WndProcHandler(hwnd, msg, wParam, lParam))
         return true;
 
@@ -86,7 +86,7 @@ LRESULT CALLBACK Window::WindowProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM l
 
     if (window && window->input)
     {
-        // ImGui Context   Է ĸó üũ
+        // ImGui Context가 있을 때만 입력 캡처 체크
         bool wantCaptureKeyboard = false;
         bool wantCaptureMouse = false;
         
@@ -99,21 +99,21 @@ LRESULT CALLBACK Window::WindowProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM l
         
         switch (msg)
         {
-            // Ű
+            // 키보드
         case WM_KEYDOWN:
-            // F1 Ű ׻  (ImGui  â ۿ)
+            // F1 키는 항상 전달 (ImGui 도구 창 토글용)
             if (wParam == VK_F1)
             {
                 window->input->OnKeyDown(wParam);
             }
-            // ٸ Ű ImGui    
+            // 다른 키는 ImGui가 사용하지 않을 때만 전달
             else if (!wantCaptureKeyboard)
             {
                 window->input->OnKeyDown(wParam);
             }
             return 0;
         case WM_KEYUP:
-            // F1 Ű ׻ 
+            // F1 키는 항상 전달
             if (wParam == VK_F1)
             {
                 window->input->OnKeyUp(wParam);
@@ -124,17 +124,17 @@ LRESULT CALLBACK Window::WindowProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM l
             }
             return 0;
 
-            // 콺 ̵
+            // 마우스 이동
         case WM_MOUSEMOVE:
         {
             int x = GET_X_LPARAM(lParam);
             int y = GET_Y_LPARAM(lParam);
-            // 콺 ġ ׻ Ʈ
+            // 마우스 위치는 항상 업데이트
             window->input->OnMouseMove(x, y);
             return 0;
         }
 
-        // 콺 ư
+        // 마우스 버튼
         case WM_LBUTTONDOWN:
             if (!wantCaptureMouse)
                 window->input->OnMouseDown(0); // Left
@@ -162,7 +162,7 @@ LRESULT CALLBACK Window::WindowProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM l
                 window->input->OnMouseUp(2);
             return 0;
 
-            // 콺 
+            // 마우스 휠
         case WM_MOUSEWHEEL:
         {
             int delta = GET_WHEEL_DELTA_WPARAM(wParam);
@@ -10,16 +10,16 @@ public:
     Window();
     ~Window();
 
-    //  
+    // 윈도우 생성
     bool Create(const std::wstring& title, int width, int height);
 
-    // ޽ ó (false   )
+    // 메시지 처리 (false 리턴 시 종료)
     bool ProcessMessages();
 
-    // ڵ ȯ
+    // 핸들 반환
     HWND GetHandle() const;
 
-    // Input 
+    // Input 연결
     void SetInput(Input* inputInstance) { input = inputInstance; }
 
 private:
@@ -64,6 +64,10 @@ public:
     int GetScreenWidth() const { return screenWidth; }
     int GetScreenHeight() const { return screenHeight; }
 
+    //       (0 =   , 1 =   , Application   )
+    void SetInterpolationAlpha(float alpha) { interpolationAlpha = alpha; }
+    float GetInterpolationAlpha() const { return interpolationAlpha; }
+
 private:
     RenderManager() = default;
 
@@ -76,6 +80,8 @@ private:
     int screenWidth = 1280;
     int screenHeight = 720;
 
+    float interpolationAlpha = 1.0f;
+
     //  
     ID3D11RenderTargetView* savedRenderTarget = nullptr;
     ID3D11DepthStencilView* savedDepthStencil = nullptr;
@@ -115,13 +115,16 @@ void SpriteRenderer::Render()
     // Layer depth  (Game ̾)
     float depth = RenderManager::GetLayerDepth(RenderLayer::Game, layer);
 
+    //      ڼ  (   Ʈ  ڼ)
+    float alpha = RenderManager::Instance().GetInterpolationAlpha();
+
     //  (Transform  ǥ ڵ )
     spriteBatch->Draw(
         shaderResourceView,
-        transform.GetWorldPosition(),   //  ġ (N θ  ݿ)
+        transform.GetInterpolatedWorldPosition(alpha),   //  ġ (N θ  ݿ)
         src,
         XMLoadFloat4(&color),
-        transform.GetWorldRotation(),   //  ȸ (N θ  ݿ)
+        transform.GetInterpolatedWorldRotation(alpha),   //  ȸ (N θ  ݿ)
         finalOrigin,
         transform.GetWorldScale(),      //   (N θ  ݿ)
         effects,
@@ -1,75 +1,68 @@
 #include "Physics/BaseCollider.h"
 #include "Core/GameObject.h"
 
-void BaseCollider::NotifyCollisionEnter(BaseCollider* other)
+const ColliderWorldShape& BaseCollider::GetWorldShape() const
 {
-    if (!gameObject)
-        return;
+    unsigned int version = gameObject ? gameObject->transform.GetVersion() : 0;
+    DirectX::XMFLOAT2 size = GetShapeSize();
 
-    // GameObject  Component ̺Ʈ 
-    const auto& components = gameObject->GetComponents();
-    for (Component* component : components)
+    bool dirty = !worldShapeValid || version != worldShapeVersion ||
+                 offset.x != worldShapeOffset.x || offset.y != worldShapeOffset.y ||
+                 size.x != worldShapeSize.x || size.y != worldShapeSize.y;
+
+    if (dirty && gameObject)
     {
-        component->OnCollisionEnter(other);
+        ComputeWorldShape(worldShape);
+        worldShapeValid = true;
+        worldShapeVersion = version;
+        worldShapeOffset = offset;
+        worldShapeSize = size;
     }
+
+    return worldShape;
 }
 
-void BaseCollider::NotifyCollisionStay(BaseCollider* other)
+void BaseCollider::NotifyListeners(uint32_t callback, void (Component::*method)(BaseCollider*), BaseCollider* other)
 {
-    if (!gameObject)
+    if (!gameObject || (gameObject->GetCollisionListeners() & callback) == 0)
         return;
 
+    // 콜백을 재정의한 컴포넌트에만 전달 (GameObject 리스너 마스크로 먼저 걸러냄)
+    // 콜백 안에서 컴포넌트가 추가/제거될 수 있으므로 인덱스로 순회
     const auto& components = gameObject->GetComponents();
-    for (Component* component : components)
+    for (size_t i = 0; i < components.size(); i++)
     {
-        component->OnCollisionStay(other);
+        if (components[i]->GetCollisionCallbacks() & callback)
+            (components[i]->*method)(other);
     }
 }
 
-void BaseCollider::NotifyCollisionExit(BaseCollider* other)
+void BaseCollider::NotifyCollisionEnter(BaseCollider* other)
 {
-    if (!gameObject)
-        return;
+    NotifyListeners(CollisionCallback_CollisionEnter, &Component::OnCollisionEnter, other);
+}
 
-    const auto& components = gameObject->GetComponents();
-    for (Component* component : components)
-    {
-        component->OnCollisionExit(other);
-    }
+void BaseCollider::NotifyCollisionStay(BaseCollider* other)
+{
+    NotifyListeners(CollisionCallback_CollisionStay, &Component::OnCollisionStay, other);
 }
 
-void BaseCollider::NotifyTriggerEnter(BaseCollider* other)
+void BaseCollider::NotifyCollisionExit(BaseCollider* other)
 {
-    if (!gameObject)
-        return;
+    NotifyListeners(CollisionCallback_CollisionExit, &Component::OnCollisionExit, other);
+}
 
-    const auto& components = gameObject->GetComponents();
-    for (Component* component : components)
-    {
-        component->OnTriggerEnter(other);
-    }
+void BaseCollider::NotifyTriggerEnter(BaseCollider* other)
+{
+    NotifyListeners(CollisionCallback_TriggerEnter, &Component::OnTriggerEnter, other);
 }
 
 void BaseCollider::NotifyTriggerStay(BaseCollider* other)
 {
-    if (!gameObject)
-        return;
-
-    const auto& components = gameObject->GetComponents();
-    for (Component* component : components)
-    {
-        component->OnTriggerStay(other);
-    }
+    NotifyListeners(CollisionCallback_TriggerStay, &Component::OnTriggerStay, other);
 }
 
 void BaseCollider::NotifyTriggerExit(BaseCollider* other)
 {
-    if (!gameObject)
-        return;
-
-    const auto& components = gameObject->GetComponents();
-    for (Component* component : components)
-    {
-        component->OnTriggerExit(other);
-    }
+    NotifyListeners(CollisionCallback_TriggerExit, &Component::OnTriggerExit, other);
 }
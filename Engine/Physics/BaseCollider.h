@@ -1,37 +1,89 @@
 #pragma once
 #include "Core/Component.h"
+#include <array>
+#include <cstdint>
 #include <DirectXMath.h>
 
 using namespace DirectX;
 
 class GameObject;
+class Rigidbody2D;
+struct ConvexPolygon;
+
+// 콜라이더 형태 종류 (CollisionDispatch 함수 테이블 인덱스, 새 형태는 Count 앞에 추가)
+enum class ColliderShapeType : uint8_t
+{
+    Box,
+    Circle,
+    Polygon,
+    Capsule,
+    Count
+};
+
+// 콜라이더 월드 공간 형태 (Transform/크기/오프셋이 바뀐 콜라이더만 다시 계산)
+struct ColliderWorldShape
+{
+    XMFLOAT2 center{ 0.0f, 0.0f };       // 월드 중심 (회전한 오프셋 반영)
+    XMFLOAT2 axisX{ 1.0f, 0.0f };        // 회전 축 (단위 벡터)
+    XMFLOAT2 axisY{ 0.0f, 1.0f };
+    XMFLOAT2 halfExtents{ 0.0f, 0.0f };  // 박스 반 크기 (스케일 반영, 양수)
+    float radius = 0.0f;                 // 원/캡슐 반지름 (스케일 반영)
+    std::array<XMFLOAT2, 4> vertices{};  // 박스 꼭짓점 (원은 사용 안 함)
+    XMFLOAT2 boundsMin{ 0.0f, 0.0f };    // 월드 AABB
+    XMFLOAT2 boundsMax{ 0.0f, 0.0f };
+};
 
 class BaseCollider : public Component
 {
 public:
-    BaseCollider() = default;
+    explicit BaseCollider(ColliderShapeType type) : shapeType(type) {}
     virtual ~BaseCollider() = default;
 
+    // 형태 종류 (생성 시 고정, 충돌 판정/접촉 생성 디스패치에 사용)
+    ColliderShapeType GetShapeType() const { return shapeType; }
+
     void SetEnabled(bool isEnabled) { enabled = isEnabled; }
     bool IsEnabled() const { return enabled; }
 
     void SetTrigger(bool triggerEnabled) { isTrigger = triggerEnabled; }
     bool IsTrigger() const { return isTrigger; }
 
+    // 레이어 (0~31, 충돌 레이어 행렬과 공간 쿼리 레이어 마스크로 필터)
+    void SetLayer(int layerIndex) { layer = (layerIndex >= 0 && layerIndex < 32) ? layerIndex : 0; }
+    int GetLayer() const { return layer; }
+    uint32_t GetLayerBit() const { return 1u << layer; }
+
+    // 충돌할 상대 레이어 비트 (기본 전체, PhysicsSystem 레이어 충돌 행렬과 함께 적용)
+    void SetCollisionMask(uint32_t mask) { collisionMask = mask; }
+    uint32_t GetCollisionMask() const { return collisionMask; }
+
     // Collider offset (local space)
     void SetOffset(float x, float y) { offset = { x, y }; }
     DirectX::XMFLOAT2 GetOffset() const { return offset; }
 
-    // 浹 ˻ (ڽ ݶ̴ )
+    // 충돌 검사 (자식 콜라이더가 구현)
     virtual bool Intersects(BaseCollider* other) = 0;
 
-    //   ( )
+    // 월드 공간 형태 캐시 (Transform 버전, 오프셋, 크기가 바뀌었을 때만 재계산)
+    // PhysicsSystem은 스텝 시작 시 단일 스레드로 갱신하므로 내로우페이즈 워커는 읽기만 함
+    const ColliderWorldShape& GetWorldShape() const;
+
+    // 다각형/캡슐 월드 둥근 볼록 다각형 (월드 형태 캐시와 함께 갱신, 박스/원은 nullptr)
+    const ConvexPolygon* GetWorldPolygon() const { GetWorldShape(); return GetCachedWorldPolygon(); }
+
+    // 디버그 렌더링 (선택 사항)
     virtual void DebugDraw() {}
 
-    // GameObject  (PhysicsSystem )
+    // GameObject 접근 (PhysicsSystem에서 사용)
     GameObject* GetGameObject() const { return gameObject; }
 
-    // PhysicsSystem  ȣǴ ̺Ʈ
+    // 같은 GameObject의 Rigidbody2D (물리 월드 등록 시 연결, 없으면 nullptr)
+    Rigidbody2D* GetAttachedRigidbody() const { return attachedBody; }
+
+    // 물리 월드 등록 순서 ID (1부터, 0 = 미등록) - 쌍/접촉 정렬 기준 (포인터 주소와 무관)
+    uint32_t GetColliderId() const { return colliderId; }
+
+    // PhysicsSystem에 의해 호출되는 이벤트
     void NotifyCollisionEnter(BaseCollider* other);
     void NotifyCollisionStay(BaseCollider* other);
     void NotifyCollisionExit(BaseCollider* other);
@@ -43,5 +95,37 @@ public:
 protected:
     bool enabled = true;
     bool isTrigger = false;
+    int layer = 0;
+    uint32_t collisionMask = 0xFFFFFFFFu;
     DirectX::XMFLOAT2 offset{ 0.f, 0.f };  // Collider offset in local space
+
+    // 월드 형태 계산 (자식 콜라이더가 구현, GetWorldShape가 필요할 때만 호출)
+    virtual void ComputeWorldShape(ColliderWorldShape& outShape) const = 0;
+
+    // 형태 크기 (박스 halfSize, 원은 { radius, 0 }, 다각형은 꼭짓점 변경 횟수) - 직접 수정된 크기 감지용
+    virtual DirectX::XMFLOAT2 GetShapeSize() const = 0;
+
+    // 월드 다각형 캐시 (ComputeWorldShape가 채움, 다각형 형태만 재정의 - 박스/원 캐시에는 두지 않음)
+    virtual const ConvexPolygon* GetCachedWorldPolygon() const { return nullptr; }
+
+private:
+    friend class PhysicsSystem;
+
+    // 리스너 비트 callback을 재정의한 같은 GameObject 컴포넌트에 method 호출
+    void NotifyListeners(uint32_t callback, void (Component::*method)(BaseCollider*), BaseCollider* other);
+
+    ColliderShapeType shapeType;
+
+    Rigidbody2D* attachedBody = nullptr;   // 등록 시 한 번 찾아 둠 (스텝 중 GetComponent 없음)
+    int registryIndex = -1;                // PhysicsSystem 콜라이더 목록 인덱스 (-1 = 미등록)
+    int staticProxyId = -1;                // PhysicsSystem 정적 트리 프록시 (-1 = 동적 또는 미등록)
+    uint32_t colliderId = 0;               // PhysicsSystem 등록 시 부여 (등록할 때마다 새 ID)
+    uint32_t pairMask = 0xFFFFFFFFu;       // 이번 스텝 충돌 가능 레이어 (collisionMask & 행렬 행)
+
+    // 월드 형태 캐시와 계산 당시 입력값
+    mutable ColliderWorldShape worldShape;
+    mutable bool worldShapeValid = false;
+    mutable unsigned int worldShapeVersion = 0;
+    mutable DirectX::XMFLOAT2 worldShapeOffset{ 0.f, 0.f };
+    mutable DirectX::XMFLOAT2 worldShapeSize{ 0.f, 0.f };
 };
@@ -0,0 +1,297 @@
+#include "Physics/BodyIntegrator.h"
+#include <cmath>
+
+#if BODY_INTEGRATOR_SSE
+#include <emmintrin.h>
+#endif
+
+void BodyIntegrator::IntegrateVelocities(BodyStore& bodies, const IntegrationSettings& settings, bool useSIMD)
+{
+    int begin = useSIMD ? IntegrateVelocitiesSSE(bodies, settings) : 0;
+    IntegrateVelocityRange(bodies, settings, begin, bodies.GetCount());
+}
+
+void BodyIntegrator::IntegratePositions(BodyStore& bodies, const IntegrationSettings& settings, bool useSIMD)
+{
+    int begin = useSIMD ? IntegratePositionsSSE(bodies, settings) : 0;
+    IntegratePositionRange(bodies, settings, begin, bodies.GetCount());
+}
+
+void BodyIntegrator::IntegrateScalar(BodyStore& bodies, const IntegrationSettings& settings)
+{
+    IntegrateVelocities(bodies, settings, false);
+    IntegratePositions(bodies, settings, false);
+}
+
+void BodyIntegrator::IntegrateSIMD(BodyStore& bodies, const IntegrationSettings& settings)
+{
+    IntegrateVelocities(bodies, settings, true);
+    IntegratePositions(bodies, settings, true);
+}
+
+// ========== 스칼라 ==========
+
+void BodyIntegrator::IntegrateVelocityRange(BodyStore& bodies, const IntegrationSettings& settings, int begin, int end)
+{
+    const float deltaTime = settings.deltaTime;
+    const float maxVelocitySq = settings.maxVelocity * settings.maxVelocity;
+
+    for (int i = begin; i < end; i++)
+    {
+        uint32_t flags = bodies.flags[i];
+        if (!(flags & BodyFlag_Active) || (flags & (BodyFlag_Kinematic | BodyFlag_Sleeping)))
+            continue;
+
+        // 1. 가속도 (a = F/m) + 중력
+        float inverseMass = bodies.inverseMass[i];
+        float accelerationX = bodies.forceX[i] * inverseMass;
+        float accelerationY = bodies.forceY[i] * inverseMass;
+
+        if ((flags & BodyFlag_UseGravity) && inverseMass > 0.0f)
+            accelerationY += settings.gravity * bodies.gravityScale[i];
+
+        // 2. 속도 업데이트 (v = v0 + at)
+        float velocityX = bodies.velocityX[i] + accelerationX * deltaTime;
+        float velocityY = bodies.velocityY[i] + accelerationY * deltaTime;
+
+        // 3. 최대 속도 제한 (제한을 넘을 때만 sqrt, CCD 강체는 터널링이 없으므로 제외)
+        float speedSq = velocityX * velocityX + velocityY * velocityY;
+        if (speedSq > maxVelocitySq && !(flags & BodyFlag_UseCCD))
+        {
+            float scale = settings.maxVelocity / sqrtf(speedSq);
+            velocityX *= scale;
+            velocityY *= scale;
+        }
+
+        // 4. 공기 저항
+        if (bodies.drag[i] > 0.0f)
+        {
+            float dragFactor = 1.0f - bodies.drag[i] * deltaTime;
+            if (dragFactor < 0.0f) dragFactor = 0.0f;
+
+            velocityX *= dragFactor;
+            velocityY *= dragFactor;
+        }
+
+        bodies.velocityX[i] = velocityX;
+        bodies.velocityY[i] = velocityY;
+
+        // 5. 회전 저항
+        if (!(flags & BodyFlag_FreezeRotation) && bodies.angularDrag[i] > 0.0f)
+        {
+            float rotDragFactor = 1.0f - bodies.angularDrag[i] * deltaTime;
+            if (rotDragFactor < 0.0f) rotDragFactor = 0.0f;
+            bodies.angularVelocity[i] *= rotDragFactor;
+        }
+
+        // 6. 힘 누적기 초기화
+        bodies.forceX[i] = 0.0f;
+        bodies.forceY[i] = 0.0f;
+        bodies.torque[i] = 0.0f;
+    }
+}
+
+void BodyIntegrator::IntegratePositionRange(BodyStore& bodies, const IntegrationSettings& settings, int begin, int end)
+{
+    const float deltaTime = settings.deltaTime;
+
+    for (int i = begin; i < end; i++)
+    {
+        uint32_t flags = bodies.flags[i];
+        if (!(flags & BodyFlag_Active) || (flags & (BodyFlag_Kinematic | BodyFlag_Sleeping)))
+            continue;
+
+        // 이전 위치 저장 (CCD용)
+        bodies.previousX[i] = bodies.positionX[i];
+        bodies.previousY[i] = bodies.positionY[i];
+
+        // 위치 업데이트 (x = x0 + vt)
+        if (!(flags & BodyFlag_FreezePositionX))
+            bodies.positionX[i] += bodies.velocityX[i] * deltaTime;
+
+        if (!(flags & BodyFlag_FreezePositionY))
+            bodies.positionY[i] += bodies.velocityY[i] * deltaTime;
+
+        // 회전 업데이트
+        if (!(flags & BodyFlag_FreezeRotation))
+            bodies.rotation[i] += bodies.angularVelocity[i] * deltaTime;
+    }
+}
+
+// ========== SSE ==========
+
+#if BODY_INTEGRATOR_SSE
+namespace
+{
+    // mask ? a : b (SSE2에는 blendv가 없으므로 비트 연산)
+    inline __m128 Select(__m128 mask, __m128 a, __m128 b)
+    {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    // 플래그 비트가 켜진 레인 마스크
+    inline __m128 HasFlag(__m128i flags, __m128i bit)
+    {
+        return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(flags, bit), bit));
+    }
+
+    // 움직이는 강체 = Active && !Kinematic && !Sleeping
+    inline __m128 MovingMask(__m128i flags)
+    {
+        const __m128i activeBit = _mm_set1_epi32(BodyFlag_Active);
+        const __m128i checkedBits = _mm_set1_epi32(BodyFlag_Active | BodyFlag_Kinematic | BodyFlag_Sleeping);
+        return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(flags, checkedBits), activeBit));
+    }
+}
+
+int BodyIntegrator::IntegrateVelocitiesSSE(BodyStore& bodies, const IntegrationSettings& settings)
+{
+    const int simdCount = bodies.GetCount() & ~3;
+
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 deltaTime = _mm_set1_ps(settings.deltaTime);
+    const __m128 gravity = _mm_set1_ps(settings.gravity);
+    const __m128 maxVelocity = _mm_set1_ps(settings.maxVelocity);
+    const __m128 maxVelocitySq = _mm_set1_ps(settings.maxVelocity * settings.maxVelocity);
+
+    const __m128i gravityBit = _mm_set1_epi32(BodyFlag_UseGravity);
+    const __m128i freezeRotationBit = _mm_set1_epi32(BodyFlag_FreezeRotation);
+    const __m128i ccdBit = _mm_set1_epi32(BodyFlag_UseCCD);
+
+    float* velocityX = bodies.velocityX.data();
+    float* velocityY = bodies.velocityY.data();
+    float* angularVelocity = bodies.angularVelocity.data();
+    float* forceX = bodies.forceX.data();
+    float* forceY = bodies.forceY.data();
+    float* torque = bodies.torque.data();
+    const float* inverseMass = bodies.inverseMass.data();
+    const float* gravityScale = bodies.gravityScale.data();
+    const float* drag = bodies.drag.data();
+    const float* angularDrag = bodies.angularDrag.data();
+    const uint32_t* flags = bodies.flags.data();
+
+    for (int i = 0; i < simdCount; i += 4)
+    {
+        __m128i flagBits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(flags + i));
+
+        // 4개 모두 정지면 건너뜀
+        __m128 moving = MovingMask(flagBits);
+        if (_mm_movemask_ps(moving) == 0)
+            continue;
+
+        __m128 velX = _mm_loadu_ps(velocityX + i);
+        __m128 velY = _mm_loadu_ps(velocityY + i);
+        __m128 invMass = _mm_loadu_ps(inverseMass + i);
+
+        // 1. 가속도 (a = F/m) + 중력
+        __m128 accelX = _mm_mul_ps(_mm_loadu_ps(forceX + i), invMass);
+        __m128 accelY = _mm_mul_ps(_mm_loadu_ps(forceY + i), invMass);
+
+        __m128 gravityMask = _mm_and_ps(HasFlag(flagBits, gravityBit), _mm_cmpgt_ps(invMass, zero));
+        accelY = _mm_add_ps(accelY,
+            _mm_and_ps(gravityMask, _mm_mul_ps(gravity, _mm_loadu_ps(gravityScale + i))));
+
+        // 2. 속도 업데이트
+        __m128 newVelX = _mm_add_ps(velX, _mm_mul_ps(accelX, deltaTime));
+        __m128 newVelY = _mm_add_ps(velY, _mm_mul_ps(accelY, deltaTime));
+
+        // 3. 최대 속도 제한 (넘지 않은 레인과 CCD 레인은 배율 1)
+        __m128 speedSq = _mm_add_ps(_mm_mul_ps(newVelX, newVelX), _mm_mul_ps(newVelY, newVelY));
+        __m128 clampMask = _mm_andnot_ps(HasFlag(flagBits, ccdBit), _mm_cmpgt_ps(speedSq, maxVelocitySq));
+        if (_mm_movemask_ps(clampMask) != 0)
+        {
+            __m128 scale = Select(clampMask, _mm_div_ps(maxVelocity, _mm_sqrt_ps(speedSq)), one);
+            newVelX = _mm_mul_ps(newVelX, scale);
+            newVelY = _mm_mul_ps(newVelY, scale);
+        }
+
+        // 4. 공기 저항
+        __m128 dragValue = _mm_loadu_ps(drag + i);
+        __m128 dragFactor = _mm_max_ps(_mm_sub_ps(one, _mm_mul_ps(dragValue, deltaTime)), zero);
+        dragFactor = Select(_mm_cmpgt_ps(dragValue, zero), dragFactor, one);
+        newVelX = _mm_mul_ps(newVelX, dragFactor);
+        newVelY = _mm_mul_ps(newVelY, dragFactor);
+
+        _mm_storeu_ps(velocityX + i, Select(moving, newVelX, velX));
+        _mm_storeu_ps(velocityY + i, Select(moving, newVelY, velY));
+
+        // 5. 회전 저항 (회전 고정 레인 제외)
+        __m128 rotate = _mm_andnot_ps(HasFlag(flagBits, freezeRotationBit), moving);
+        __m128 angVel = _mm_loadu_ps(angularVelocity + i);
+        __m128 angDragValue = _mm_loadu_ps(angularDrag + i);
+        __m128 angDragFactor = _mm_max_ps(_mm_sub_ps(one, _mm_mul_ps(angDragValue, deltaTime)), zero);
+        angDragFactor = Select(_mm_cmpgt_ps(angDragValue, zero), angDragFactor, one);
+        _mm_storeu_ps(angularVelocity + i, Select(rotate, _mm_mul_ps(angVel, angDragFactor), angVel));
+
+        // 6. 힘 누적기 초기화
+        _mm_storeu_ps(forceX + i, Select(moving, zero, _mm_loadu_ps(forceX + i)));
+        _mm_storeu_ps(forceY + i, Select(moving, zero, _mm_loadu_ps(forceY + i)));
+        _mm_storeu_ps(torque + i, Select(moving, zero, _mm_loadu_ps(torque + i)));
+    }
+
+    return simdCount;
+}
+
+int BodyIntegrator::IntegratePositionsSSE(BodyStore& bodies, const IntegrationSettings& settings)
+{
+    const int simdCount = bodies.GetCount() & ~3;
+
+    const __m128 deltaTime = _mm_set1_ps(settings.deltaTime);
+    const __m128i freezeXBit = _mm_set1_epi32(BodyFlag_FreezePositionX);
+    const __m128i freezeYBit = _mm_set1_epi32(BodyFlag_FreezePositionY);
+    const __m128i freezeRotationBit = _mm_set1_epi32(BodyFlag_FreezeRotation);
+
+    float* positionX = bodies.positionX.data();
+    float* positionY = bodies.positionY.data();
+    float* rotation = bodies.rotation.data();
+    float* previousX = bodies.previousX.data();
+    float* previousY = bodies.previousY.data();
+    const float* velocityX = bodies.velocityX.data();
+    const float* velocityY = bodies.velocityY.data();
+    const float* angularVelocity = bodies.angularVelocity.data();
+    const uint32_t* flags = bodies.flags.data();
+
+    for (int i = 0; i < simdCount; i += 4)
+    {
+        __m128i flagBits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(flags + i));
+
+        __m128 moving = MovingMask(flagBits);
+        if (_mm_movemask_ps(moving) == 0)
+            continue;
+
+        __m128 posX = _mm_loadu_ps(positionX + i);
+        __m128 posY = _mm_loadu_ps(positionY + i);
+
+        // 이전 위치 저장 (CCD용)
+        _mm_storeu_ps(previousX + i, Select(moving, posX, _mm_loadu_ps(previousX + i)));
+        _mm_storeu_ps(previousY + i, Select(moving, posY, _mm_loadu_ps(previousY + i)));
+
+        // 위치 업데이트 (축 고정 레인 제외)
+        __m128 moveX = _mm_andnot_ps(HasFlag(flagBits, freezeXBit), moving);
+        __m128 moveY = _mm_andnot_ps(HasFlag(flagBits, freezeYBit), moving);
+        __m128 newPosX = _mm_add_ps(posX, _mm_mul_ps(_mm_loadu_ps(velocityX + i), deltaTime));
+        __m128 newPosY = _mm_add_ps(posY, _mm_mul_ps(_mm_loadu_ps(velocityY + i), deltaTime));
+        _mm_storeu_ps(positionX + i, Select(moveX, newPosX, posX));
+        _mm_storeu_ps(positionY + i, Select(moveY, newPosY, posY));
+
+        // 회전 업데이트
+        __m128 rotate = _mm_andnot_ps(HasFlag(flagBits, freezeRotationBit), moving);
+        __m128 rot = _mm_loadu_ps(rotation + i);
+        __m128 newRot = _mm_add_ps(rot, _mm_mul_ps(_mm_loadu_ps(angularVelocity + i), deltaTime));
+        _mm_storeu_ps(rotation + i, Select(rotate, newRot, rot));
+    }
+
+    return simdCount;
+}
+#else
+int BodyIntegrator::IntegrateVelocitiesSSE(BodyStore&, const IntegrationSettings&)
+{
+    return 0;
+}
+
+int BodyIntegrator::IntegratePositionsSSE(BodyStore&, const IntegrationSettings&)
+{
+    return 0;
+}
+#endif
@@ -0,0 +1,44 @@
+#pragma once
+#include "Physics/BodyStore.h"
+
+// SSE2 사용 가능 여부 (x86/x64는 항상 지원, 그 외는 스칼라 경로만)
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define BODY_INTEGRATOR_SSE 1
+#else
+#define BODY_INTEGRATOR_SSE 0
+#endif
+
+// 강체 적분 설정
+struct IntegrationSettings
+{
+    float deltaTime = 1.0f / 60.0f;
+    float gravity = 500.0f;        // 픽셀/s^2 (PhysicsSystem::gravity)
+    float maxVelocity = 1000.0f;   // 최대 속도 (터널링 방지, UseCCD 강체는 제한 없음)
+};
+
+// BodyStore 일괄 적분 (Semi-implicit Euler, 접촉 솔버는 두 단계 사이에서 실행)
+// - 속도 단계: 힘/중력 → 속도 → 속도 제한 (CCD 제외) → 저항 → 힘 초기화
+// - 위치 단계: 이전 위치 저장 → 위치/회전 (축 고정 반영)
+// - Active && !Kinematic && !Sleeping 강체만 변경, 나머지는 그대로 유지
+// - SIMD 경로는 4개씩 처리하고 남은 강체는 스칼라로 처리 (두 경로 결과 동일)
+class BodyIntegrator
+{
+public:
+    static void IntegrateVelocities(BodyStore& bodies, const IntegrationSettings& settings, bool useSIMD);
+    static void IntegratePositions(BodyStore& bodies, const IntegrationSettings& settings, bool useSIMD);
+
+    // 두 단계 연속 실행 (접촉이 없는 스텝과 동일)
+    static void IntegrateScalar(BodyStore& bodies, const IntegrationSettings& settings);
+    static void IntegrateSIMD(BodyStore& bodies, const IntegrationSettings& settings);
+
+    static bool IsSIMDAvailable() { return BODY_INTEGRATOR_SSE != 0; }
+
+private:
+    // [begin, end) 범위 스칼라 적분 (SIMD 나머지 처리 공용)
+    static void IntegrateVelocityRange(BodyStore& bodies, const IntegrationSettings& settings, int begin, int end);
+    static void IntegratePositionRange(BodyStore& bodies, const IntegrationSettings& settings, int begin, int end);
+
+    // SSE 4개씩 처리 후 나머지는 스칼라 (반환값 = SIMD로 처리한 개수)
+    static int IntegrateVelocitiesSSE(BodyStore& bodies, const IntegrationSettings& settings);
+    static int IntegratePositionsSSE(BodyStore& bodies, const IntegrationSettings& settings);
+};
@@ -0,0 +1,122 @@
+#include "Physics/BodyStore.h"
+#include "Physics/Rigidbody2D.h"
+#include "Core/GameObject.h"
+
+int BodyStore::Add(Rigidbody2D* owner)
+{
+    int index = static_cast<int>(owners.size());
+
+    positionX.push_back(0.0f);
+    positionY.push_back(0.0f);
+    rotation.push_back(0.0f);
+    previousX.push_back(0.0f);
+    previousY.push_back(0.0f);
+
+    velocityX.push_back(0.0f);
+    velocityY.push_back(0.0f);
+    angularVelocity.push_back(0.0f);
+    forceX.push_back(0.0f);
+    forceY.push_back(0.0f);
+    torque.push_back(0.0f);
+
+    inverseMass.push_back(0.0f);
+    gravityScale.push_back(0.0f);
+    drag.push_back(0.0f);
+    angularDrag.push_back(0.0f);
+    flags.push_back(0u);
+    sleepTime.push_back(0.0f);
+
+    owners.push_back(owner);
+    transforms.push_back(&owner->GetGameObject()->transform);
+    return index;
+}
+
+void BodyStore::Remove(int index)
+{
+    int last = static_cast<int>(owners.size()) - 1;
+    if (index < 0 || index > last)
+        return;
+
+    // 마지막 원소를 빈 자리로 이동 (배열 연속성 유지)
+    if (index != last)
+    {
+        positionX[index] = positionX[last];
+        positionY[index] = positionY[last];
+        rotation[index] = rotation[last];
+        previousX[index] = previousX[last];
+        previousY[index] = previousY[last];
+
+        velocityX[index] = velocityX[last];
+        velocityY[index] = velocityY[last];
+        angularVelocity[index] = angularVelocity[last];
+        forceX[index] = forceX[last];
+        forceY[index] = forceY[last];
+        torque[index] = torque[last];
+
+        inverseMass[index] = inverseMass[last];
+        gravityScale[index] = gravityScale[last];
+        drag[index] = drag[last];
+        angularDrag[index] = angularDrag[last];
+        flags[index] = flags[last];
+        sleepTime[index] = sleepTime[last];
+
+        owners[index] = owners[last];
+        owners[index]->bodyIndex = index;
+        transforms[index] = transforms[last];
+    }
+
+    positionX.pop_back();
+    positionY.pop_back();
+    rotation.pop_back();
+    previousX.pop_back();
+    previousY.pop_back();
+
+    velocityX.pop_back();
+    velocityY.pop_back();
+    angularVelocity.pop_back();
+    forceX.pop_back();
+    forceY.pop_back();
+    torque.pop_back();
+
+    inverseMass.pop_back();
+    gravityScale.pop_back();
+    drag.pop_back();
+    angularDrag.pop_back();
+    flags.pop_back();
+    sleepTime.pop_back();
+
+    owners.pop_back();
+    transforms.pop_back();
+}
+
+void BodyStore::Clear()
+{
+    positionX.clear();
+    positionY.clear();
+    rotation.clear();
+    previousX.clear();
+    previousY.clear();
+
+    velocityX.clear();
+    velocityY.clear();
+    angularVelocity.clear();
+    forceX.clear();
+    forceY.clear();
+    torque.clear();
+
+    inverseMass.clear();
+    gravityScale.clear();
+    drag.clear();
+    angularDrag.clear();
+    flags.clear();
+    sleepTime.clear();
+
+    owners.clear();
+    transforms.clear();
+}
+
+void BodyStore::Wake(int index)
+{
+    flags[index] &= ~BodyFlag_Sleeping;
+    sleepTime[index] = 0.0f;
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+class Rigidbody2D;
+class Transform;
+
+// 강체 상태 플래그 (BodyStore::flags)
+enum BodyFlag : uint32_t
+{
+    BodyFlag_Active          = 1u << 0,  // 컴포넌트 활성화
+    BodyFlag_Kinematic       = 1u << 1,
+    BodyFlag_UseGravity      = 1u << 2,
+    BodyFlag_FreezePositionX = 1u << 3,
+    BodyFlag_FreezePositionY = 1u << 4,
+    BodyFlag_FreezeRotation  = 1u << 5,
+    BodyFlag_UseCCD          = 1u << 6,
+    BodyFlag_Sleeping        = 1u << 7   // 잠든 섬 (적분/풀이 생략, SyncBodies에서 유지)
+};
+
+// 강체 시뮬레이션 상태 SoA(Structure of Arrays) 저장소
+// - 매 스텝 순회하는 필드를 필드별 연속 배열로 보관 (캐시/SIMD 친화)
+// - Rigidbody2D는 인덱스만 가진 핸들, 제거 시 마지막 원소와 교환
+class BodyStore
+{
+public:
+    // 강체 추가 (반환값 = 인덱스)
+    int Add(Rigidbody2D* owner);
+
+    // 강체 제거 (마지막 원소를 빈 자리로 옮기고 그 핸들 인덱스 갱신)
+    void Remove(int index);
+
+    void Clear();
+
+    // 잠든 강체 깨우기 (수면 타이머 초기화)
+    void Wake(int index);
+
+    bool IsSleeping(int index) const { return (flags[index] & BodyFlag_Sleeping) != 0; }
+
+    int GetCount() const { return static_cast<int>(owners.size()); }
+
+    // 위치/회전 (스텝 시작 시 Transform에서 읽고 적분 후 되돌려 씀)
+    std::vector<float> positionX;
+    std::vector<float> positionY;
+    std::vector<float> rotation;
+    std::vector<float> previousX;        // 적분 전 위치 (CCD용)
+    std::vector<float> previousY;
+
+    // 속도/힘
+    std::vector<float> velocityX;
+    std::vector<float> velocityY;
+    std::vector<float> angularVelocity;
+    std::vector<float> forceX;
+    std::vector<float> forceY;
+    std::vector<float> torque;
+
+    // 물성 (컴포넌트 설정에서 매 스텝 동기화)
+    std::vector<float> inverseMass;      // 0 = 움직이지 않음
+    std::vector<float> gravityScale;
+    std::vector<float> drag;
+    std::vector<float> angularDrag;
+    std::vector<uint32_t> flags;         // BodyFlag 조합
+
+    // 수면 (속도가 기준 이하로 유지된 시간, 초)
+    std::vector<float> sleepTime;
+
+    std::vector<Rigidbody2D*> owners;    // 인덱스 → 컴포넌트
+    std::vector<Transform*> transforms;  // 인덱스 → GameObject Transform (자세를 읽고 쓸 때 컴포넌트를 거치지 않음)
+};
@@ -1,30 +1,34 @@
 #include "BoxCollider2D.h"
 #include "CircleCollider.h"
+#include "Physics/CollisionDispatch.h"
 #include "Core/GameObject.h"
 #include "Core/Transform.h"
+#ifndef ENGINE_HEADLESS
 #include "Graphics/DebugRenderer.h"
 #include "Graphics/SpriteRenderer.h"
 #include "Resource/Texture.h"
 #include <d3d11.h>
+#endif
 
 using namespace DirectX;
 
 void BoxCollider2D::FitToTexture()
 {
+#ifndef ENGINE_HEADLESS
     if (!gameObject)
         return;
 
-    // SpriteRenderer ã
+    // SpriteRenderer 찾기
     auto* spriteRenderer = gameObject->GetComponent<SpriteRenderer>();
     if (!spriteRenderer)
         return;
 
-    // Texture 
+    // Texture 가져오기
     auto texture = spriteRenderer->GetTexture();
     if (!texture)
         return;
 
-    // SRV ؽó  
+    // SRV에서 텍스처 정보 가져오기
     ID3D11ShaderResourceView* srv = texture->GetSRV();
     if (!srv)
         return;
@@ -42,7 +46,7 @@ void BoxCollider2D::FitToTexture()
             D3D11_TEXTURE2D_DESC desc;
             texture2D->GetDesc(&desc);
             
-            // halfSize = ؽó ũ / 2
+            // halfSize = 텍스처 크기 / 2
             halfSize.x = desc.Width * 0.5f;
             halfSize.y = desc.Height * 0.5f;
             
@@ -51,6 +55,7 @@ void BoxCollider2D::FitToTexture()
         
         resource->Release();
     }
+#endif
 }
 
 XMFLOAT2 BoxCollider2D::GetCenter() const
@@ -68,6 +73,11 @@ float BoxCollider2D::GetRotation() const
 }
 
 void BoxCollider2D::GetVertices(std::array<XMFLOAT2, 4>& out) const
+{
+    out = GetWorldShape().vertices;
+}
+
+void BoxCollider2D::ComputeWorldShape(ColliderWorldShape& outShape) const
 {
     XMFLOAT2 pos = gameObject->transform.GetPosition();
     XMFLOAT2 scale = gameObject->transform.GetScale();
@@ -102,7 +112,27 @@ void BoxCollider2D::GetVertices(std::array<XMFLOAT2, 4>& out) const
         float wx = rotX + offset.x * cosR - offset.y * sinR + pos.x;
         float wy = rotY + offset.x * sinR + offset.y * cosR + pos.y;
 
-        out[i] = { wx, wy };
+        outShape.vertices[i] = { wx, wy };
+    }
+
+    outShape.center = {
+        offset.x * cosR - offset.y * sinR + pos.x,
+        offset.x * sinR + offset.y * cosR + pos.y
+    };
+    outShape.axisX = { cosR, sinR };
+    outShape.axisY = { -sinR, cosR };
+    outShape.halfExtents = { fabsf(hx), fabsf(hy) };
+    outShape.radius = 0.0f;
+
+    // 꼭짓점 범위 = 월드 AABB
+    outShape.boundsMin = outShape.vertices[0];
+    outShape.boundsMax = outShape.vertices[0];
+    for (int i = 1; i < 4; i++)
+    {
+        outShape.boundsMin.x = (std::min)(outShape.boundsMin.x, outShape.vertices[i].x);
+        outShape.boundsMin.y = (std::min)(outShape.boundsMin.y, outShape.vertices[i].y);
+        outShape.boundsMax.x = (std::max)(outShape.boundsMax.x, outShape.vertices[i].x);
+        outShape.boundsMax.y = (std::max)(outShape.boundsMax.y, outShape.vertices[i].y);
     }
 }
 
@@ -111,13 +141,8 @@ bool BoxCollider2D::Intersects(BaseCollider* other)
     if (!enabled || !other->IsEnabled())
         return false;
 
-    if (auto box = dynamic_cast<BoxCollider2D*>(other))
-        return IntersectsOBB(box);
-
-    if (auto circle = dynamic_cast<CircleCollider*>(other))
-        return IntersectsCircle(circle);
-
-    return false;
+    // 형태 종류별 함수 테이블 (dynamic_cast 없음)
+    return CollisionDispatch::Intersects(this, other);
 }
 
 static void ProjectOntoAxis(
@@ -141,25 +166,16 @@ static void ProjectOntoAxis(
 
 bool BoxCollider2D::IntersectsOBB(BoxCollider2D* other)
 {
-    std::array<XMFLOAT2, 4> a, b;
-    GetVertices(a);
-    other->GetVertices(b);
+    const ColliderWorldShape& shapeA = GetWorldShape();
+    const ColliderWorldShape& shapeB = other->GetWorldShape();
+    const std::array<XMFLOAT2, 4>& a = shapeA.vertices;
+    const std::array<XMFLOAT2, 4>& b = shapeB.vertices;
 
-    XMFLOAT2 axes[4] =
-    {
-        { a[1].x - a[0].x, a[1].y - a[0].y },
-        { a[3].x - a[0].x, a[3].y - a[0].y },
-        { b[1].x - b[0].x, b[1].y - b[0].y },
-        { b[3].x - b[0].x, b[3].y - b[0].y }
-    };
+    // 변 방향 = 캐시된 회전 축 (이미 단위 벡터)
+    const XMFLOAT2 axes[4] = { shapeA.axisX, shapeA.axisY, shapeB.axisX, shapeB.axisY };
 
-    for (auto& ax : axes)
+    for (const XMFLOAT2& axis : axes)
     {
-        float len = sqrtf(ax.x * ax.x + ax.y * ax.y);
-        if (len < 0.0001f) continue;
-
-        XMFLOAT2 axis = { ax.x / len, ax.y / len };
-
         float aMin, aMax, bMin, bMax;
         ProjectOntoAxis(a, axis, aMin, aMax);
         ProjectOntoAxis(b, axis, bMin, bMax);
@@ -173,41 +189,32 @@ bool BoxCollider2D::IntersectsOBB(BoxCollider2D* other)
 
 bool BoxCollider2D::IntersectsCircle(CircleCollider* circle)
 {
-    std::array<XMFLOAT2, 4> verts;
-    GetVertices(verts);
-
-    XMFLOAT2 c = circle->GetWorldCenter();
-    float r = circle->GetWorldRadius();
-
-    float minX = verts[0].x, maxX = verts[0].x;
-    float minY = verts[0].y, maxY = verts[0].y;
-
-    for (int i = 1; i < 4; i++)
-    {
-        minX = (std::min)(minX, verts[i].x);
-        maxX = (std::max)(maxX, verts[i].x);
-        minY = (std::min)(minY, verts[i].y);
-        maxY = (std::max)(maxY, verts[i].y);
-    }
+    const ColliderWorldShape& shape = GetWorldShape();
+    const ColliderWorldShape& circleShape = circle->GetWorldShape();
 
-    float clampedX = (std::max)(minX, (std::min)(c.x, maxX));
-    float clampedY = (std::max)(minY, (std::min)(c.y, maxY));
+    // 원 중심을 박스 축 좌표로 옮겨 반 크기 범위로 자름 (회전한 박스도 CollideBoxCircle과 같은 판정)
+    float offsetX = circleShape.center.x - shape.center.x;
+    float offsetY = circleShape.center.y - shape.center.y;
+    float localX = offsetX * shape.axisX.x + offsetY * shape.axisX.y;
+    float localY = offsetX * shape.axisY.x + offsetY * shape.axisY.y;
 
-    float dx = c.x - clampedX;
-    float dy = c.y - clampedY;
+    float dx = localX - (std::max)(-shape.halfExtents.x, (std::min)(localX, shape.halfExtents.x));
+    float dy = localY - (std::max)(-shape.halfExtents.y, (std::min)(localY, shape.halfExtents.y));
 
+    float r = circleShape.radius;
     return (dx * dx + dy * dy) <= (r * r);
 }
 
 void BoxCollider2D::DebugDraw()
 {
+#ifndef ENGINE_HEADLESS
     
     if (!enabled) return;
 
-    std::array<XMFLOAT2, 4> v;
-    GetVertices(v);
+    const std::array<XMFLOAT2, 4>& v = GetWorldShape().vertices;
 
-    XMFLOAT4 col = { 0,1,0,1 }; //  ʷ
-    // DebugRenderer DrawBox ȣմϴ.
+    XMFLOAT4 col = { 0,1,0,1 }; // 밝은 초록
+    // DebugRenderer의 DrawBox를 호출합니다.
     DebugRenderer::Instance().DrawBox(v, col);
+#endif
 }
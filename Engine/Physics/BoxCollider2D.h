@@ -5,20 +5,26 @@
 class BoxCollider2D : public BaseCollider
 {
 public:
-    DirectX::XMFLOAT2 halfSize{ 16, 16 };  // ⺻ (32x32 ؽó )
+    BoxCollider2D() : BaseCollider(ColliderShapeType::Box) {}
 
-    // ؽó ũ⿡ ° ڵ 
+    DirectX::XMFLOAT2 halfSize{ 16, 16 };  // 기본값 (32x32 텍스처 기준)
+
+    // 텍스처 크기에 맞게 자동 설정
     void FitToTexture();
 
     virtual bool Intersects(BaseCollider* other) override;
     virtual void DebugDraw() override;
 
-    // ȸ OBB 
+    // 회전된 OBB 계산
     DirectX::XMFLOAT2 GetCenter() const;
     float GetRotation() const;
-    void GetVertices(std::array<DirectX::XMFLOAT2, 4>& outVerts) const;
+    void GetVertices(std::array<DirectX::XMFLOAT2, 4>& outVerts) const;  // 월드 형태 캐시에서 복사
 
-    // SAT 浹 ˻
+    // SAT 충돌 검사
     bool IntersectsOBB(BoxCollider2D* other);
     bool IntersectsCircle(class CircleCollider* circle);
+
+protected:
+    void ComputeWorldShape(ColliderWorldShape& outShape) const override;
+    DirectX::XMFLOAT2 GetShapeSize() const override { return halfSize; }
 };
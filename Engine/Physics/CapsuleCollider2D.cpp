@@ -0,0 +1,127 @@
+#include "CapsuleCollider2D.h"
+#include "Physics/CollisionDispatch.h"
+#include "Core/GameObject.h"
+#include "Core/Transform.h"
+#ifndef ENGINE_HEADLESS
+#include "Graphics/DebugRenderer.h"
+#include "Graphics/SpriteRenderer.h"
+#include "Resource/Texture.h"
+#include <d3d11.h>
+#endif
+#include <algorithm>
+#include <cmath>
+
+using namespace DirectX;
+
+void CapsuleCollider2D::FitToTexture()
+{
+#ifndef ENGINE_HEADLESS
+    if (!gameObject)
+        return;
+
+    auto* spriteRenderer = gameObject->GetComponent<SpriteRenderer>();
+    if (!spriteRenderer)
+        return;
+
+    auto texture = spriteRenderer->GetTexture();
+    if (!texture)
+        return;
+
+    ID3D11ShaderResourceView* srv = texture->GetSRV();
+    if (!srv)
+        return;
+
+    ID3D11Resource* resource = nullptr;
+    srv->GetResource(&resource);
+
+    if (resource)
+    {
+        ID3D11Texture2D* texture2D = nullptr;
+        resource->QueryInterface(__uuidof(ID3D11Texture2D), (void**)&texture2D);
+
+        if (texture2D)
+        {
+            D3D11_TEXTURE2D_DESC desc;
+            texture2D->GetDesc(&desc);
+
+            radius = desc.Width * 0.5f;
+            height = static_cast<float>(desc.Height);
+
+            texture2D->Release();
+        }
+
+        resource->Release();
+    }
+#endif
+}
+
+void CapsuleCollider2D::ComputeWorldShape(ColliderWorldShape& outShape) const
+{
+    XMFLOAT2 pos = gameObject->transform.GetPosition();
+    XMFLOAT2 scale = gameObject->transform.GetScale();
+    float rot = gameObject->transform.GetRotation();
+
+    float cosR = cosf(rot);
+    float sinR = sinf(rot);
+
+    XMFLOAT2 center = {
+        offset.x * cosR - offset.y * sinR + pos.x,
+        offset.x * sinR + offset.y * cosR + pos.y
+    };
+
+    // 반지름은 X 스케일, 높이는 Y 스케일
+    // 선분 길이가 0이면 참조 변 방향이 없으므로 원 모양이어도 아주 짧게 유지
+    float worldRadius = fabsf(radius * scale.x);
+    float halfLength = (std::max)(0.01f, 0.5f * fabsf(height * scale.y) - worldRadius);
+
+    XMFLOAT2 axisX = { cosR, sinR };
+    XMFLOAT2 axisY = { -sinR, cosR };
+
+    // 선분 아래 → 위 (변 법선 = ±axisX)
+    ConvexPolygon& polygon = worldPolygon;
+    polygon.count = 2;
+    polygon.radius = worldRadius;
+    polygon.vertices[0] = { center.x - axisY.x * halfLength, center.y - axisY.y * halfLength };
+    polygon.vertices[1] = { center.x + axisY.x * halfLength, center.y + axisY.y * halfLength };
+    polygon.normals[0] = axisX;
+    polygon.normals[1] = { -axisX.x, -axisX.y };
+
+    polygon.ComputeBounds(outShape.boundsMin, outShape.boundsMax);
+
+    outShape.center = center;
+    outShape.axisX = axisX;
+    outShape.axisY = axisY;
+    outShape.halfExtents = { worldRadius, halfLength + worldRadius };
+    outShape.radius = worldRadius;
+}
+
+bool CapsuleCollider2D::Intersects(BaseCollider* other)
+{
+    if (!enabled || !other->IsEnabled())
+        return false;
+
+    return CollisionDispatch::Intersects(this, other);
+}
+
+void CapsuleCollider2D::DebugDraw()
+{
+#ifndef ENGINE_HEADLESS
+    if (!enabled) return;
+
+    const ColliderWorldShape& shape = GetWorldShape();
+    const ConvexPolygon& polygon = worldPolygon;
+    XMFLOAT4 col = { 0,1,0,1 };
+
+    // 양 옆 직선 + 양 끝 원
+    for (int side = 0; side < 2; side++)
+    {
+        XMFLOAT2 normal = polygon.normals[side];
+        XMFLOAT2 start = { polygon.vertices[0].x + normal.x * shape.radius, polygon.vertices[0].y + normal.y * shape.radius };
+        XMFLOAT2 end = { polygon.vertices[1].x + normal.x * shape.radius, polygon.vertices[1].y + normal.y * shape.radius };
+        DebugRenderer::Instance().DrawLine(start, end, col);
+    }
+
+    DebugRenderer::Instance().DrawCircle(polygon.vertices[0], shape.radius, col);
+    DebugRenderer::Instance().DrawCircle(polygon.vertices[1], shape.radius, col);
+#endif
+}
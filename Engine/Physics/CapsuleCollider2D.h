@@ -0,0 +1,33 @@
+#pragma once
+#include "Physics/BaseCollider.h"
+#include "Physics/ConvexPolygon.h"
+
+// 캡슐 콜라이더 (로컬 Y축 방향)
+// - 중심 선분 양 끝에 반원을 붙인 형태, height는 반원까지 포함한 전체 높이
+// - 월드 형태는 꼭짓점 2개(선분 양 끝) + 반지름의 둥근 다각형 (ConvexPolygon)
+class CapsuleCollider2D : public BaseCollider
+{
+public:
+    CapsuleCollider2D() : BaseCollider(ColliderShapeType::Capsule) {}
+
+    float radius = 8.0f;
+    float height = 32.0f;  // 2 * radius 이하면 원
+
+    // 텍스처 크기에 맞게 자동 설정 (반지름 = 너비 절반, 높이 = 텍스처 높이)
+    void FitToTexture();
+
+    virtual bool Intersects(BaseCollider* other) override;
+    virtual void DebugDraw() override;
+
+    // 월드 형태 캐시에서 읽음
+    float GetWorldRadius() const { return GetWorldShape().radius; }
+    DirectX::XMFLOAT2 GetWorldCenter() const { return GetWorldShape().center; }
+
+protected:
+    void ComputeWorldShape(ColliderWorldShape& outShape) const override;
+    DirectX::XMFLOAT2 GetShapeSize() const override { return { radius, height }; }
+    const ConvexPolygon* GetCachedWorldPolygon() const override { return &worldPolygon; }
+
+private:
+    mutable ConvexPolygon worldPolygon;  // 선분 양 끝 + 반지름 (ComputeWorldShape에서 갱신)
+};
@@ -2,30 +2,34 @@
 #include "Core/GameObject.h"
 #include "Core/Transform.h"
 #include "Physics/BoxCollider2D.h"
+#include "Physics/CollisionDispatch.h"
+#ifndef ENGINE_HEADLESS
 #include "Graphics/DebugRenderer.h"
 #include "Graphics/SpriteRenderer.h"
 #include "Resource/Texture.h"
 #include <d3d11.h>
+#endif
 #include <algorithm>
 
 using namespace DirectX;
 
 void CircleCollider::FitToTexture()
 {
+#ifndef ENGINE_HEADLESS
     if (!gameObject)
         return;
 
-    // SpriteRenderer ã
+    // SpriteRenderer 찾기
     auto* spriteRenderer = gameObject->GetComponent<SpriteRenderer>();
     if (!spriteRenderer)
         return;
 
-    // Texture 
+    // Texture 가져오기
     auto texture = spriteRenderer->GetTexture();
     if (!texture)
         return;
 
-    // SRV ؽó  
+    // SRV에서 텍스처 정보 가져오기
     ID3D11ShaderResourceView* srv = texture->GetSRV();
     if (!srv)
         return;
@@ -43,7 +47,7 @@ void CircleCollider::FitToTexture()
             D3D11_TEXTURE2D_DESC desc;
             texture2D->GetDesc(&desc);
             
-            // radius = ؽó ũ  (   )
+            // radius = 텍스처 크기의 절반 (더 작은 쪽 기준)
             radius = (std::min)(desc.Width, desc.Height) * 0.5f;
             
             texture2D->Release();
@@ -51,18 +55,24 @@ void CircleCollider::FitToTexture()
         
         resource->Release();
     }
+#endif
 }
 
 float CircleCollider::GetWorldRadius() const
 {
-    float scaleX = gameObject->transform.GetScale().x;
-    return radius * scaleX;
+    return GetWorldShape().radius;
 }
 
 XMFLOAT2 CircleCollider::GetWorldCenter() const
+{
+    return GetWorldShape().center;
+}
+
+void CircleCollider::ComputeWorldShape(ColliderWorldShape& outShape) const
 {
     XMFLOAT2 pos = gameObject->transform.GetPosition();
     float rot = gameObject->transform.GetRotation();
+    float scaleX = gameObject->transform.GetScale().x;
     
     // Apply offset with rotation
     float cosR = cosf(rot);
@@ -70,43 +80,50 @@ XMFLOAT2 CircleCollider::GetWorldCenter() const
     
     pos.x += offset.x * cosR - offset.y * sinR;
     pos.y += offset.x * sinR + offset.y * cosR;
-    
-    return pos;
+
+    float worldRadius = radius * scaleX;
+    float extent = fabsf(worldRadius);
+
+    outShape.center = pos;
+    outShape.axisX = { cosR, sinR };
+    outShape.axisY = { -sinR, cosR };
+    outShape.halfExtents = { extent, extent };
+    outShape.radius = worldRadius;
+    outShape.boundsMin = { pos.x - extent, pos.y - extent };
+    outShape.boundsMax = { pos.x + extent, pos.y + extent };
 }
 
 bool CircleCollider::Intersects(BaseCollider* other)
 {
     if (!enabled || !other->IsEnabled()) return false;
 
-    // Circle  Circle
-    if (auto c = dynamic_cast<CircleCollider*>(other))
-    {
-        XMFLOAT2 a = GetWorldCenter();
-        XMFLOAT2 b = c->GetWorldCenter();
-
-        float dx = a.x - b.x;
-        float dy = a.y - b.y;
-        float dist2 = dx * dx + dy * dy;
+    // 형태 종류별 함수 테이블 (Circle ↔ Box는 BoxCollider2D::IntersectsCircle)
+    return CollisionDispatch::Intersects(this, other);
+}
 
-        float r = GetWorldRadius() + c->GetWorldRadius();
-        return dist2 <= (r * r);
-    }
+bool CircleCollider::IntersectsCircle(CircleCollider* other)
+{
+    const ColliderWorldShape& shape = GetWorldShape();
+    const ColliderWorldShape& otherShape = other->GetWorldShape();
 
-    // Circle  Box(OBB)
-    if (auto b = dynamic_cast<BoxCollider2D*>(other))
-        return b->Intersects(this);
+    float dx = shape.center.x - otherShape.center.x;
+    float dy = shape.center.y - otherShape.center.y;
+    float dist2 = dx * dx + dy * dy;
 
-    return false;
+    float r = shape.radius + otherShape.radius;
+    return dist2 <= (r * r);
 }
 
 void CircleCollider::DebugDraw()
 {
+#ifndef ENGINE_HEADLESS
     if (!enabled) return;
 
-    // DebugRenderer DrawCircle ȣմϴ.
+    // DebugRenderer의 DrawCircle을 호출합니다.
     DebugRenderer::Instance().DrawCircle(
         GetWorldCenter(),
         GetWorldRadius(),
         { 0,1,0,1 }
     );
+#endif
 }
\ No newline at end of file
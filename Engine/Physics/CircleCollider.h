@@ -4,14 +4,24 @@
 class CircleCollider : public BaseCollider
 {
 public:
+    CircleCollider() : BaseCollider(ColliderShapeType::Circle) {}
+
     float radius = 10.f;
 
-    // ؽó ũ⿡ ° ڵ 
+    // 텍스처 크기에 맞게 자동 설정
     void FitToTexture();
 
     virtual bool Intersects(BaseCollider* other) override;
+
+    // 원 vs 원 겹침
+    bool IntersectsCircle(CircleCollider* other);
     virtual void DebugDraw() override;
 
+    // 월드 형태 캐시에서 읽음
     float GetWorldRadius() const;
     DirectX::XMFLOAT2 GetWorldCenter() const;
+
+protected:
+    void ComputeWorldShape(ColliderWorldShape& outShape) const override;
+    DirectX::XMFLOAT2 GetShapeSize() const override { return { radius, 0.0f }; }
 };
@@ -0,0 +1,185 @@
+#include "Physics/CollisionDispatch.h"
+#include "Physics/BoxCollider2D.h"
+#include "Physics/CircleCollider.h"
+#include "Physics/CapsuleCollider2D.h"
+#include "Physics/PolygonCollider2D.h"
+#include <cmath>
+
+namespace
+{
+    const int ShapeTypeCount = static_cast<int>(ColliderShapeType::Count);
+
+    struct DispatchEntry
+    {
+        CollisionDispatch::IntersectFunc intersect = nullptr;
+        CollisionDispatch::ManifoldFunc manifold = nullptr;
+        bool flipIntersect = false;  // 등록된 함수가 (B, A) 순서 → 인자를 바꿔 호출
+        bool flipManifold = false;
+    };
+
+    struct DispatchTable
+    {
+        DispatchEntry entries[ShapeTypeCount][ShapeTypeCount];
+
+        DispatchTable();
+    };
+
+    void StoreIntersect(DispatchTable& table, ColliderShapeType typeA, ColliderShapeType typeB,
+                        CollisionDispatch::IntersectFunc func)
+    {
+        int a = static_cast<int>(typeA);
+        int b = static_cast<int>(typeB);
+
+        table.entries[a][b].intersect = func;
+        table.entries[a][b].flipIntersect = false;
+
+        if (a != b)
+        {
+            table.entries[b][a].intersect = func;
+            table.entries[b][a].flipIntersect = true;
+        }
+    }
+
+    void StoreManifold(DispatchTable& table, ColliderShapeType typeA, ColliderShapeType typeB,
+                       CollisionDispatch::ManifoldFunc func)
+    {
+        int a = static_cast<int>(typeA);
+        int b = static_cast<int>(typeB);
+
+        table.entries[a][b].manifold = func;
+        table.entries[a][b].flipManifold = false;
+
+        if (a != b)
+        {
+            table.entries[b][a].manifold = func;
+            table.entries[b][a].flipManifold = true;
+        }
+    }
+
+    // ========== 기본 겹침 판정 ==========
+
+    bool IntersectBoxBox(BaseCollider* colliderA, BaseCollider* colliderB)
+    {
+        return static_cast<BoxCollider2D*>(colliderA)->IntersectsOBB(static_cast<BoxCollider2D*>(colliderB));
+    }
+
+    bool IntersectBoxCircle(BaseCollider* box, BaseCollider* circle)
+    {
+        return static_cast<BoxCollider2D*>(box)->IntersectsCircle(static_cast<CircleCollider*>(circle));
+    }
+
+    bool IntersectCircleCircle(BaseCollider* colliderA, BaseCollider* colliderB)
+    {
+        return static_cast<CircleCollider*>(colliderA)->IntersectsCircle(static_cast<CircleCollider*>(colliderB));
+    }
+
+    // 다각형/캡슐은 월드 형태 캐시 그대로, 박스는 scratch에 만들어 반환 (캐시된 월드 법선으로 SAT)
+    const ConvexPolygon& GetConvex(BaseCollider* collider, ConvexPolygon& scratch)
+    {
+        if (collider->GetShapeType() != ColliderShapeType::Box)
+            return *collider->GetWorldPolygon();
+
+        const ColliderWorldShape& shape = collider->GetWorldShape();
+        scratch.SetBox(shape.center, shape.axisX, shape.axisY, shape.halfExtents);
+        return scratch;
+    }
+
+    bool IntersectConvex(BaseCollider* colliderA, BaseCollider* colliderB)
+    {
+        ConvexPolygon scratchA;
+        ConvexPolygon scratchB;
+        return ConvexPolygon::Overlaps(GetConvex(colliderA, scratchA), GetConvex(colliderB, scratchB));
+    }
+
+    bool IntersectConvexCircle(BaseCollider* convex, BaseCollider* circle)
+    {
+        ConvexPolygon scratch;
+        const ConvexPolygon& polygon = GetConvex(convex, scratch);
+
+        const ColliderWorldShape& circleShape = circle->GetWorldShape();
+        ConvexPolygon point;
+        point.count = 1;
+        point.vertices[0] = circleShape.center;
+        point.radius = fabsf(circleShape.radius);
+        return ConvexPolygon::Overlaps(polygon, point);
+    }
+
+    DispatchTable::DispatchTable()
+    {
+        StoreIntersect(*this, ColliderShapeType::Box, ColliderShapeType::Box, IntersectBoxBox);
+        StoreIntersect(*this, ColliderShapeType::Box, ColliderShapeType::Circle, IntersectBoxCircle);
+        StoreIntersect(*this, ColliderShapeType::Circle, ColliderShapeType::Circle, IntersectCircleCircle);
+
+        StoreManifold(*this, ColliderShapeType::Box, ColliderShapeType::Box, ContactSolver::CollideBoxBox);
+        StoreManifold(*this, ColliderShapeType::Box, ColliderShapeType::Circle, ContactSolver::CollideBoxCircle);
+        StoreManifold(*this, ColliderShapeType::Circle, ColliderShapeType::Circle, ContactSolver::CollideCircleCircle);
+
+        // 다각형/캡슐은 박스까지 같은 볼록 다각형 경로 (원은 둥근 다각형 vs 점)
+        const ColliderShapeType convexTypes[] = { ColliderShapeType::Polygon, ColliderShapeType::Capsule };
+        for (ColliderShapeType convexType : convexTypes)
+        {
+            StoreIntersect(*this, convexType, ColliderShapeType::Box, IntersectConvex);
+            StoreIntersect(*this, convexType, ColliderShapeType::Polygon, IntersectConvex);
+            StoreIntersect(*this, convexType, ColliderShapeType::Capsule, IntersectConvex);
+            StoreIntersect(*this, convexType, ColliderShapeType::Circle, IntersectConvexCircle);
+
+            StoreManifold(*this, convexType, ColliderShapeType::Box, ContactSolver::CollideConvex);
+            StoreManifold(*this, convexType, ColliderShapeType::Polygon, ContactSolver::CollideConvex);
+            StoreManifold(*this, convexType, ColliderShapeType::Capsule, ContactSolver::CollideConvex);
+            StoreManifold(*this, convexType, ColliderShapeType::Circle, ContactSolver::CollideConvexCircle);
+        }
+    }
+
+    DispatchTable& GetTable()
+    {
+        static DispatchTable table;
+        return table;
+    }
+
+    inline const DispatchEntry& GetEntry(const BaseCollider* colliderA, const BaseCollider* colliderB)
+    {
+        return GetTable().entries[static_cast<int>(colliderA->GetShapeType())][static_cast<int>(colliderB->GetShapeType())];
+    }
+}
+
+void CollisionDispatch::RegisterIntersect(ColliderShapeType typeA, ColliderShapeType typeB, IntersectFunc func)
+{
+    StoreIntersect(GetTable(), typeA, typeB, func);
+}
+
+void CollisionDispatch::RegisterManifold(ColliderShapeType typeA, ColliderShapeType typeB, ManifoldFunc func)
+{
+    StoreManifold(GetTable(), typeA, typeB, func);
+}
+
+bool CollisionDispatch::Intersects(BaseCollider* colliderA, BaseCollider* colliderB)
+{
+    const DispatchEntry& entry = GetEntry(colliderA, colliderB);
+    if (entry.intersect == nullptr)
+        return false;
+
+    return entry.flipIntersect ? entry.intersect(colliderB, colliderA) : entry.intersect(colliderA, colliderB);
+}
+
+bool CollisionDispatch::Collide(BaseCollider* colliderA, BaseCollider* colliderB, ContactManifold& outManifold)
+{
+    outManifold.colliderA = colliderA;
+    outManifold.colliderB = colliderB;
+    outManifold.pointCount = 0;
+
+    const DispatchEntry& entry = GetEntry(colliderA, colliderB);
+    if (entry.manifold == nullptr)
+        return false;
+
+    if (!entry.flipManifold)
+        return entry.manifold(colliderA, colliderB, outManifold);
+
+    // 반대 순서로 계산한 뒤 A → B 법선으로 되돌림
+    if (!entry.manifold(colliderB, colliderA, outManifold))
+        return false;
+
+    outManifold.colliderA = colliderA;
+    outManifold.colliderB = colliderB;
+    outManifold.normal = { -outManifold.normal.x, -outManifold.normal.y };
+    return true;
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include "Physics/BaseCollider.h"
+#include "Physics/ContactSolver.h"
+
+// 형태 종류 쌍별 충돌 함수 테이블 (ColliderShapeType x ColliderShapeType)
+// - 겹침 판정(Intersects)과 접촉 생성(Collide)을 dynamic_cast 없이 배열 조회로 분기
+// - (A, B)만 등록하면 (B, A)는 인자를 바꿔 호출 (접촉 법선은 뒤집어 A → B 유지)
+// - 새 형태는 ColliderShapeType에 추가한 뒤 다른 형태와의 함수를 등록
+// - 기본 형태(Box, Circle, Polygon, Capsule) 함수는 첫 사용 시 등록됨, 등록은 스텝 밖에서만 (워커 스레드는 읽기만 함)
+class CollisionDispatch
+{
+public:
+    using IntersectFunc = bool (*)(BaseCollider* colliderA, BaseCollider* colliderB);
+    using ManifoldFunc = bool (*)(BaseCollider* colliderA, BaseCollider* colliderB, ContactManifold& outManifold);
+
+    static void RegisterIntersect(ColliderShapeType typeA, ColliderShapeType typeB, IntersectFunc func);
+    static void RegisterManifold(ColliderShapeType typeA, ColliderShapeType typeB, ManifoldFunc func);
+
+    // 겹침 판정 (등록된 함수가 없으면 false)
+    static bool Intersects(BaseCollider* colliderA, BaseCollider* colliderB);
+
+    // 접촉 생성 (겹치지 않거나 함수가 없으면 false). colliderA/B, normal, points만 채움
+    static bool Collide(BaseCollider* colliderA, BaseCollider* colliderB, ContactManifold& outManifold);
+};
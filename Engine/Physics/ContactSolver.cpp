@@ -0,0 +1,851 @@
+#include "Physics/ContactSolver.h"
+#include "Physics/BaseCollider.h"
+#include "Physics/BoxCollider2D.h"
+#include "Physics/CircleCollider.h"
+#include "Physics/CapsuleCollider2D.h"
+#include "Physics/PolygonCollider2D.h"
+#include "Physics/CollisionDispatch.h"
+#include "Core/GameObject.h"
+#include "Core/Transform.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <functional>
+
+namespace
+{
+    // ========== 벡터 헬퍼 ==========
+
+    inline float Dot(const XMFLOAT2& a, const XMFLOAT2& b) { return a.x * b.x + a.y * b.y; }
+    inline float Cross(const XMFLOAT2& a, const XMFLOAT2& b) { return a.x * b.y - a.y * b.x; }
+    inline XMFLOAT2 Sub(const XMFLOAT2& a, const XMFLOAT2& b) { return { a.x - b.x, a.y - b.y }; }
+    inline XMFLOAT2 Add(const XMFLOAT2& a, const XMFLOAT2& b) { return { a.x + b.x, a.y + b.y }; }
+    inline XMFLOAT2 Scale(const XMFLOAT2& v, float s) { return { v.x * s, v.y * s }; }
+
+    // ========== 볼록 다각형 (월드 공간, 반시계 방향) ==========
+
+    // 박스는 월드 형태 캐시의 축을 그대로 변 법선으로 (음수 스케일도 halfExtents가 양수라 반시계)
+    void BuildBoxPolygon(const BaseCollider* box, ConvexPolygon& outPolygon)
+    {
+        const ColliderWorldShape& shape = box->GetWorldShape();
+        outPolygon.SetBox(shape.center, shape.axisX, shape.axisY, shape.halfExtents);
+    }
+
+    // 다각형/캡슐은 월드 형태 캐시 (회전한 법선 그대로), 박스는 scratch에 만들어 반환
+    const ConvexPolygon& GetColliderPolygon(BaseCollider* collider, ConvexPolygon& scratch)
+    {
+        if (collider->GetShapeType() == ColliderShapeType::Box)
+        {
+            BuildBoxPolygon(collider, scratch);
+            return scratch;
+        }
+
+        return *collider->GetWorldPolygon();
+    }
+
+    // ========== 특징 ID ==========
+
+    // [flip:1][referenceEdge:8][type:8][index:8]
+    enum FeatureType : uint32_t
+    {
+        Feature_IncidentVertex = 1,  // 클리핑되지 않은 입사 변 꼭짓점
+        Feature_ClippedSide = 2,     // 참조 변 측면에서 잘린 점
+        Feature_RoundedVertex = 3    // 둥근 형태의 꼭짓점끼리 (캡슐 끝 ↔ 모서리)
+    };
+
+    inline uint32_t MakeFeatureId(bool flip, int referenceEdge, FeatureType type, int index)
+    {
+        return (flip ? (1u << 24) : 0u) |
+               (static_cast<uint32_t>(referenceEdge) << 16) |
+               (static_cast<uint32_t>(type) << 8) |
+               static_cast<uint32_t>(index);
+    }
+
+    struct ClipVertex
+    {
+        XMFLOAT2 position;
+        FeatureType type;
+        int index;
+    };
+
+    // ========== 다각형 vs 다각형 (SAT + 참조 면 클리핑) ==========
+
+    // poly1의 각 변 법선 중 poly2와의 분리 거리가 가장 큰 변
+    float FindMaxSeparation(int& outEdge, const ConvexPolygon& poly1, const ConvexPolygon& poly2)
+    {
+        float maxSeparation = -FLT_MAX;
+        outEdge = 0;
+
+        for (int i = 0; i < poly1.count; i++)
+        {
+            const XMFLOAT2& normal = poly1.normals[i];
+            const XMFLOAT2& vertex = poly1.vertices[i];
+
+            float separation = FLT_MAX;
+            for (int j = 0; j < poly2.count; j++)
+            {
+                separation = (std::min)(separation, Dot(normal, Sub(poly2.vertices[j], vertex)));
+            }
+
+            if (separation > maxSeparation)
+            {
+                maxSeparation = separation;
+                outEdge = i;
+            }
+        }
+
+        return maxSeparation;
+    }
+
+    // 참조 변 법선과 가장 반대 방향인 입사 변
+    void FindIncidentEdge(ClipVertex outEdge[2], const ConvexPolygon& poly1, int edge1, const ConvexPolygon& poly2)
+    {
+        const XMFLOAT2& normal1 = poly1.normals[edge1];
+
+        int incident = 0;
+        float minDot = FLT_MAX;
+        for (int i = 0; i < poly2.count; i++)
+        {
+            float dot = Dot(normal1, poly2.normals[i]);
+            if (dot < minDot)
+            {
+                minDot = dot;
+                incident = i;
+            }
+        }
+
+        int next = (incident + 1) % poly2.count;
+        outEdge[0] = { poly2.vertices[incident], Feature_IncidentVertex, incident };
+        outEdge[1] = { poly2.vertices[next], Feature_IncidentVertex, next };
+    }
+
+    // 선분을 평면(normal·x <= offset) 안쪽으로 자름
+    int ClipSegmentToLine(ClipVertex out[2], const ClipVertex in[2], const XMFLOAT2& normal, float offset, int sideIndex)
+    {
+        int count = 0;
+
+        float distance0 = Dot(normal, in[0].position) - offset;
+        float distance1 = Dot(normal, in[1].position) - offset;
+
+        if (distance0 <= 0.0f) out[count++] = in[0];
+        if (distance1 <= 0.0f) out[count++] = in[1];
+
+        // 평면을 가로지르면 교차점 추가
+        if (distance0 * distance1 < 0.0f && count < 2)
+        {
+            float t = distance0 / (distance0 - distance1);
+            out[count].position = Add(in[0].position, Scale(Sub(in[1].position, in[0].position), t));
+            out[count].type = Feature_ClippedSide;
+            out[count].index = sideIndex;
+            count++;
+        }
+
+        return count;
+    }
+
+    // 두 선분의 최근접점 (s, t = 각 선분 위 비율 0~1)
+    void ClosestPointsOnSegments(const XMFLOAT2& p1, const XMFLOAT2& q1, const XMFLOAT2& p2, const XMFLOAT2& q2,
+                                 float& outS, float& outT, XMFLOAT2& outPoint1, XMFLOAT2& outPoint2)
+    {
+        XMFLOAT2 d1 = Sub(q1, p1);
+        XMFLOAT2 d2 = Sub(q2, p2);
+        XMFLOAT2 r = Sub(p1, p2);
+        float a = Dot(d1, d1);
+        float e = Dot(d2, d2);
+        float f = Dot(d2, r);
+
+        auto clamp01 = [](float value) { return (std::max)(0.0f, (std::min)(1.0f, value)); };
+        const float Epsilon = 1e-6f;
+
+        outS = 0.0f;
+        outT = 0.0f;
+
+        if (a <= Epsilon && e > Epsilon)
+        {
+            outT = clamp01(f / e);
+        }
+        else if (a > Epsilon)
+        {
+            float c = Dot(d1, r);
+            if (e <= Epsilon)
+            {
+                outS = clamp01(-c / a);
+            }
+            else
+            {
+                float b = Dot(d1, d2);
+                float denominator = a * e - b * b;
+                outS = (denominator != 0.0f) ? clamp01((b * f - c * e) / denominator) : 0.0f;
+                outT = (b * outS + f) / e;
+
+                if (outT < 0.0f)
+                {
+                    outT = 0.0f;
+                    outS = clamp01(-c / a);
+                }
+                else if (outT > 1.0f)
+                {
+                    outT = 1.0f;
+                    outS = clamp01((b - c) / a);
+                }
+            }
+        }
+
+        outPoint1 = Add(p1, Scale(d1, outS));
+        outPoint2 = Add(p2, Scale(d2, outT));
+    }
+
+    // 둥근 다각형(radius > 0)은 중심부 간격이 반지름 합 이하인 동안 접촉
+    bool CollidePolygons(const ConvexPolygon& polyA, const ConvexPolygon& polyB, ContactManifold& manifold)
+    {
+        float totalRadius = polyA.radius + polyB.radius;
+
+        int edgeA = 0;
+        float separationA = FindMaxSeparation(edgeA, polyA, polyB);
+        if (separationA > totalRadius)
+            return false;
+
+        int edgeB = 0;
+        float separationB = FindMaxSeparation(edgeB, polyB, polyA);
+        if (separationB > totalRadius)
+            return false;
+
+        // 참조 다각형 선택 (비슷하면 A 우선 - 프레임 간 특징 ID 안정)
+        const float tolerance = 0.05f;
+        const ConvexPolygon* poly1 = &polyA;
+        const ConvexPolygon* poly2 = &polyB;
+        int edge1 = edgeA;
+        bool flip = false;
+
+        if (separationB > separationA + tolerance)
+        {
+            poly1 = &polyB;
+            poly2 = &polyA;
+            edge1 = edgeB;
+            flip = true;
+        }
+
+        ClipVertex incidentEdge[2];
+        FindIncidentEdge(incidentEdge, *poly1, edge1, *poly2);
+
+        int vertexIndex1 = edge1;
+        int vertexIndex2 = (edge1 + 1) % poly1->count;
+        XMFLOAT2 v11 = poly1->vertices[vertexIndex1];
+        XMFLOAT2 v12 = poly1->vertices[vertexIndex2];
+        float radius1 = poly1->radius;
+        float radius2 = poly2->radius;
+
+        // 중심부가 떨어진 둥근 형태에서 가장 가까운 특징이 양쪽 꼭짓점이면 (캡슐 끝 ↔ 모서리)
+        // 면 클리핑 대신 두 꼭짓점을 잇는 방향으로 한 점 (선분끼리는 SAT 면 법선만으로 분리를 알 수 없어 항상 확인)
+        bool segments = poly1->count == 2 && poly2->count == 2;
+        if (totalRadius > 0.0f && ((std::max)(separationA, separationB) > 0.0f || segments))
+        {
+            float s, t;
+            XMFLOAT2 closest1, closest2;
+            ClosestPointsOnSegments(v11, v12, incidentEdge[0].position, incidentEdge[1].position, s, t, closest1, closest2);
+
+            XMFLOAT2 delta = Sub(closest2, closest1);
+            float distance = sqrtf(Dot(delta, delta));
+            bool vertexVertex = (s == 0.0f || s == 1.0f) && (t == 0.0f || t == 1.0f);
+
+            if (distance > 0.005f && vertexVertex)
+            {
+                if (distance > totalRadius)
+                    return false;
+
+                XMFLOAT2 direction = Scale(delta, 1.0f / distance);
+                XMFLOAT2 surface1 = Add(closest1, Scale(direction, radius1));
+                XMFLOAT2 surface2 = Sub(closest2, Scale(direction, radius2));
+
+                manifold.normal = flip ? Scale(direction, -1.0f) : direction;
+                manifold.pointCount = 1;
+
+                ContactPoint& point = manifold.points[0];
+                point = ContactPoint();
+                point.position = Scale(Add(surface1, surface2), 0.5f);
+                point.separation = distance - totalRadius;
+                point.featureId = MakeFeatureId(flip, (s == 0.0f) ? vertexIndex1 : vertexIndex2, Feature_RoundedVertex,
+                                                (t == 0.0f) ? incidentEdge[0].index : incidentEdge[1].index);
+                return true;
+            }
+        }
+
+        XMFLOAT2 tangent = Sub(v12, v11);
+        float length = sqrtf(Dot(tangent, tangent));
+        if (length < 0.0001f)
+            return false;
+        tangent = Scale(tangent, 1.0f / length);
+
+        XMFLOAT2 normal = poly1->normals[edge1];
+        float frontOffset = Dot(normal, v11);
+        float sideOffset1 = -Dot(tangent, v11);
+        float sideOffset2 = Dot(tangent, v12);
+
+        // 참조 변 양쪽 측면으로 입사 변 클리핑
+        ClipVertex clipPoints1[2];
+        ClipVertex clipPoints2[2];
+
+        if (ClipSegmentToLine(clipPoints1, incidentEdge, Scale(tangent, -1.0f), sideOffset1, vertexIndex1) < 2)
+            return false;
+
+        if (ClipSegmentToLine(clipPoints2, clipPoints1, tangent, sideOffset2, vertexIndex2) < 2)
+            return false;
+
+        // 참조 면 아래(침투)에 있는 점만 접촉점으로
+        manifold.normal = flip ? Scale(normal, -1.0f) : normal;
+        manifold.pointCount = 0;
+
+        for (const ClipVertex& clip : clipPoints2)
+        {
+            float coreSeparation = Dot(normal, clip.position) - frontOffset;
+            float separation = coreSeparation - totalRadius;
+            if (separation > 0.0f)
+                continue;
+
+            // 입사 표면(점 - 법선 x 반지름2)과 참조 표면(참조 면 + 법선 x 반지름1)의 중간
+            ContactPoint& point = manifold.points[manifold.pointCount++];
+            point = ContactPoint();
+            point.position = Sub(clip.position, Scale(normal, 0.5f * (coreSeparation + radius2 - radius1)));
+            point.separation = separation;
+            point.featureId = MakeFeatureId(flip, edge1, clip.type, clip.index);
+        }
+
+        return manifold.pointCount > 0;
+    }
+
+    // ========== 다각형 vs 원 ==========
+
+    // 법선은 다각형 → 원 방향 (둥근 다각형은 polygon.radius만큼 부풀린 형태)
+    bool CollidePolygonCircle(const ConvexPolygon& polygon, const XMFLOAT2& center, float circleRadius,
+                              XMFLOAT2& outNormal, ContactPoint& outPoint)
+    {
+        float radius = circleRadius + polygon.radius;
+        float maxSeparation = -FLT_MAX;
+        int normalIndex = 0;
+
+        for (int i = 0; i < polygon.count; i++)
+        {
+            float separation = Dot(polygon.normals[i], Sub(center, polygon.vertices[i]));
+            if (separation > radius)
+                return false;
+
+            if (separation > maxSeparation)
+            {
+                maxSeparation = separation;
+                normalIndex = i;
+            }
+        }
+
+        XMFLOAT2 v1 = polygon.vertices[normalIndex];
+        XMFLOAT2 v2 = polygon.vertices[(normalIndex + 1) % polygon.count];
+
+        XMFLOAT2 polygonPoint;
+        float separation;
+
+        float u1 = Dot(Sub(center, v1), Sub(v2, v1));
+        float u2 = Dot(Sub(center, v2), Sub(v1, v2));
+
+        if (maxSeparation > 0.0f && (u1 <= 0.0f || u2 <= 0.0f))
+        {
+            // 꼭짓점 영역
+            XMFLOAT2 vertex = (u1 <= 0.0f) ? v1 : v2;
+            XMFLOAT2 delta = Sub(center, vertex);
+            float distance = sqrtf(Dot(delta, delta));
+            if (distance > radius)
+                return false;
+
+            outNormal = (distance > 0.0001f) ? Scale(delta, 1.0f / distance) : polygon.normals[normalIndex];
+            polygonPoint = vertex;
+            separation = distance - radius;
+        }
+        else
+        {
+            // 면 영역 (중심이 다각형 안에 있는 경우 포함)
+            outNormal = polygon.normals[normalIndex];
+            polygonPoint = Sub(center, Scale(outNormal, maxSeparation));
+            separation = maxSeparation - radius;
+        }
+
+        polygonPoint = Add(polygonPoint, Scale(outNormal, polygon.radius));
+        XMFLOAT2 circlePoint = Sub(center, Scale(outNormal, circleRadius));
+
+        outPoint = ContactPoint();
+        outPoint.position = Scale(Add(polygonPoint, circlePoint), 0.5f);
+        outPoint.separation = separation;
+        outPoint.featureId = 0;
+        return true;
+    }
+
+    // ========== 원 vs 원 ==========
+
+    bool CollideCircles(const CircleCollider* circleA, const CircleCollider* circleB, ContactManifold& manifold)
+    {
+        XMFLOAT2 centerA = circleA->GetWorldCenter();
+        XMFLOAT2 centerB = circleB->GetWorldCenter();
+        float radiusA = circleA->GetWorldRadius();
+        float radiusB = circleB->GetWorldRadius();
+
+        XMFLOAT2 delta = Sub(centerB, centerA);
+        float distanceSq = Dot(delta, delta);
+        float radiusSum = radiusA + radiusB;
+        if (distanceSq > radiusSum * radiusSum)
+            return false;
+
+        float distance = sqrtf(distanceSq);
+        manifold.normal = (distance > 0.0001f) ? Scale(delta, 1.0f / distance) : XMFLOAT2{ 0.0f, 1.0f };
+
+        XMFLOAT2 pointA = Add(centerA, Scale(manifold.normal, radiusA));
+        XMFLOAT2 pointB = Sub(centerB, Scale(manifold.normal, radiusB));
+
+        ContactPoint& point = manifold.points[0];
+        point = ContactPoint();
+        point.position = Scale(Add(pointA, pointB), 0.5f);
+        point.separation = distance - radiusSum;
+        point.featureId = 0;
+        manifold.pointCount = 1;
+        return true;
+    }
+
+    // ========== 속도 접근 (정적 = 인덱스 -1) ==========
+
+    struct BodyVelocity
+    {
+        XMFLOAT2 linear{0.0f, 0.0f};
+        float angular = 0.0f;
+    };
+
+    inline BodyVelocity LoadVelocity(const BodyStore& bodies, int index)
+    {
+        if (index < 0)
+            return BodyVelocity();
+
+        return { { bodies.velocityX[index], bodies.velocityY[index] }, bodies.angularVelocity[index] };
+    }
+
+    inline void StoreVelocity(BodyStore& bodies, int index, const BodyVelocity& velocity)
+    {
+        if (index < 0)
+            return;
+
+        bodies.velocityX[index] = velocity.linear.x;
+        bodies.velocityY[index] = velocity.linear.y;
+        bodies.angularVelocity[index] = velocity.angular;
+    }
+
+    // 접촉점에서의 상대 속도 (B - A)
+    inline XMFLOAT2 RelativeVelocity(const BodyVelocity& a, const BodyVelocity& b, const ContactPoint& point)
+    {
+        // v + w × r
+        return {
+            b.linear.x - b.angular * point.rB.y - a.linear.x + a.angular * point.rA.y,
+            b.linear.y + b.angular * point.rB.x - a.linear.y - a.angular * point.rA.x
+        };
+    }
+
+    inline void ApplyImpulse(const ContactManifold& manifold, const ContactPoint& point, const XMFLOAT2& impulse,
+                             BodyVelocity& a, BodyVelocity& b)
+    {
+        a.linear.x -= impulse.x * manifold.inverseMassA;
+        a.linear.y -= impulse.y * manifold.inverseMassA;
+        a.angular -= Cross(point.rA, impulse) * manifold.inverseInertiaA;
+
+        b.linear.x += impulse.x * manifold.inverseMassB;
+        b.linear.y += impulse.y * manifold.inverseMassB;
+        b.angular += Cross(point.rB, impulse) * manifold.inverseInertiaB;
+    }
+}
+
+// ========== 접촉 생성 ==========
+
+bool ContactSolver::Collide(BaseCollider* colliderA, BaseCollider* colliderB, ContactManifold& outManifold)
+{
+    return CollisionDispatch::Collide(colliderA, colliderB, outManifold);
+}
+
+// Box vs Box (회전 포함, 최대 2점)
+bool ContactSolver::CollideBoxBox(BaseCollider* colliderA, BaseCollider* colliderB, ContactManifold& outManifold)
+{
+    ConvexPolygon polyA;
+    ConvexPolygon polyB;
+    BuildBoxPolygon(colliderA, polyA);
+    BuildBoxPolygon(colliderB, polyB);
+    return CollidePolygons(polyA, polyB, outManifold);
+}
+
+// Box vs Circle (법선 = Box → Circle)
+bool ContactSolver::CollideBoxCircle(BaseCollider* box, BaseCollider* circle, ContactManifold& outManifold)
+{
+    CircleCollider* circleCollider = static_cast<CircleCollider*>(circle);
+
+    ConvexPolygon polygon;
+    BuildBoxPolygon(box, polygon);
+
+    if (!CollidePolygonCircle(polygon, circleCollider->GetWorldCenter(), circleCollider->GetWorldRadius(),
+                              outManifold.normal, outManifold.points[0]))
+        return false;
+
+    outManifold.pointCount = 1;
+    return true;
+}
+
+bool ContactSolver::CollideCircleCircle(BaseCollider* colliderA, BaseCollider* colliderB, ContactManifold& outManifold)
+{
+    return CollideCircles(static_cast<CircleCollider*>(colliderA), static_cast<CircleCollider*>(colliderB), outManifold);
+}
+
+// 다각형/캡슐 vs 다각형/캡슐/박스 (캐시된 월드 법선으로 SAT, 박스는 다각형으로 변환)
+bool ContactSolver::CollideConvex(BaseCollider* colliderA, BaseCollider* colliderB, ContactManifold& outManifold)
+{
+    ConvexPolygon scratchA;
+    ConvexPolygon scratchB;
+    return CollidePolygons(GetColliderPolygon(colliderA, scratchA), GetColliderPolygon(colliderB, scratchB), outManifold);
+}
+
+// 다각형/캡슐 vs 원 (법선 = 다각형 → 원)
+bool ContactSolver::CollideConvexCircle(BaseCollider* convex, BaseCollider* circle, ContactManifold& outManifold)
+{
+    CircleCollider* circleCollider = static_cast<CircleCollider*>(circle);
+
+    ConvexPolygon scratch;
+    if (!CollidePolygonCircle(GetColliderPolygon(convex, scratch), circleCollider->GetWorldCenter(),
+                              fabsf(circleCollider->GetWorldRadius()), outManifold.normal, outManifold.points[0]))
+        return false;
+
+    outManifold.pointCount = 1;
+    return true;
+}
+
+float ContactSolver::ComputeInverseInertia(BaseCollider* collider, float mass)
+{
+    if (mass <= 0.0f || collider == nullptr || collider->GetGameObject() == nullptr)
+        return 0.0f;
+
+    XMFLOAT2 scale = collider->GetGameObject()->transform.GetScale();
+    XMFLOAT2 offset = collider->GetOffset();
+    float offsetSq = offset.x * offset.x + offset.y * offset.y;
+    float inertia = 0.0f;
+
+    if (collider->GetShapeType() == ColliderShapeType::Box)
+    {
+        // 직사각형: m(w^2 + h^2) / 12
+        BoxCollider2D* box = static_cast<BoxCollider2D*>(collider);
+        float width = 2.0f * box->halfSize.x * fabsf(scale.x);
+        float height = 2.0f * box->halfSize.y * fabsf(scale.y);
+        inertia = mass * (width * width + height * height) / 12.0f;
+    }
+    else if (collider->GetShapeType() == ColliderShapeType::Circle)
+    {
+        // 원판: m r^2 / 2
+        float radius = static_cast<CircleCollider*>(collider)->GetWorldRadius();
+        inertia = 0.5f * mass * radius * radius;
+    }
+    else if (collider->GetShapeType() == ColliderShapeType::Polygon)
+    {
+        // 볼록 다각형: 삼각형 분할 (오프셋을 꼭짓점에 더해 강체 중심 기준으로 바로 계산)
+        const ConvexPolygon& polygon = static_cast<PolygonCollider2D*>(collider)->GetLocalPolygon();
+        float area = 0.0f;
+        float moment = 0.0f;
+
+        for (int i = 0; i < polygon.count; i++)
+        {
+            const XMFLOAT2& v1 = polygon.vertices[i];
+            const XMFLOAT2& v2 = polygon.vertices[(i + 1) % polygon.count];
+            XMFLOAT2 a = { v1.x * scale.x + offset.x, v1.y * scale.y + offset.y };
+            XMFLOAT2 b = { v2.x * scale.x + offset.x, v2.y * scale.y + offset.y };
+
+            float cross = Cross(a, b);
+            area += 0.5f * cross;
+            moment += cross * (Dot(a, a) + Dot(a, b) + Dot(b, b)) / 12.0f;
+        }
+
+        inertia = (area != 0.0f) ? mass * moment / area : 0.0f;
+        offsetSq = 0.0f;  // 꼭짓점에 이미 반영
+    }
+    else if (collider->GetShapeType() == ColliderShapeType::Capsule)
+    {
+        // 캡슐: 가운데 직사각형 + 양 끝 반원 (면적 비율로 질량 분배)
+        const ColliderWorldShape& shape = collider->GetWorldShape();
+        float radius = shape.radius;
+        float length = 2.0f * (shape.halfExtents.y - radius);
+
+        const float Pi = 3.14159265f;
+        float boxArea = 2.0f * radius * length;
+        float circleArea = Pi * radius * radius;
+        float totalArea = boxArea + circleArea;
+
+        if (totalArea > 0.0f)
+        {
+            float boxMass = mass * boxArea / totalArea;
+            float circleMass = mass * circleArea / totalArea;
+            float halfLength = 0.5f * length;
+            float centroidOffset = 4.0f * radius / (3.0f * Pi);  // 반원 무게중심
+
+            inertia = boxMass * (4.0f * radius * radius + length * length) / 12.0f +
+                      circleMass * (0.5f * radius * radius + halfLength * halfLength + 2.0f * halfLength * centroidOffset);
+        }
+    }
+
+    // 오프셋은 평행축 정리로 반영
+    inertia += mass * offsetSq;
+    return (inertia > 0.0f) ? 1.0f / inertia : 0.0f;
+}
+
+// ========== 프레임 간 매칭 ==========
+
+void ContactSolver::BeginStep()
+{
+    previousManifolds.swap(manifolds);
+    manifolds.clear();
+    previousCursor = 0;
+}
+
+const ContactManifold* ContactSolver::FindManifold(uint64_t pairKey) const
+{
+    auto it = std::lower_bound(manifolds.begin(), manifolds.end(), pairKey, [](const ContactManifold& manifold, uint64_t key)
+    {
+        return manifold.pairKey < key;
+    });
+
+    if (it == manifolds.end() || it->pairKey != pairKey)
+        return nullptr;
+
+    return &*it;
+}
+
+const ContactManifold* ContactSolver::FindPrevious(const ContactManifold& manifold)
+{
+    // 이전 목록도 쌍 정렬 순서이므로 커서를 앞으로만 이동
+    while (previousCursor < previousManifolds.size() && previousManifolds[previousCursor].pairKey < manifold.pairKey)
+        previousCursor++;
+
+    if (previousCursor >= previousManifolds.size())
+        return nullptr;
+
+    const ContactManifold& previous = previousManifolds[previousCursor];
+    if (previous.pairKey != manifold.pairKey)
+        return nullptr;
+
+    return &previous;
+}
+
+void ContactSolver::AddManifold(const ContactManifold& manifold)
+{
+    manifolds.push_back(manifold);
+    ContactManifold& current = manifolds.back();
+
+    const ContactManifold* previous = FindPrevious(current);
+    if (previous == nullptr)
+        return;
+
+    // 같은 특징 ID의 누적 충격량 이어 받기
+    for (int i = 0; i < current.pointCount; i++)
+    {
+        ContactPoint& point = current.points[i];
+        for (int j = 0; j < previous->pointCount; j++)
+        {
+            if (previous->points[j].featureId == point.featureId)
+            {
+                point.normalImpulse = previous->points[j].normalImpulse;
+                point.tangentImpulse = previous->points[j].tangentImpulse;
+                break;
+            }
+        }
+    }
+}
+
+void ContactSolver::KeepManifold(const ContactManifold& manifold)
+{
+    const ContactManifold* previous = FindPrevious(manifold);
+    if (previous == nullptr)
+        return;
+
+    // 접촉점을 다시 계산한 경우 (스냅샷 복원 직후 이전 매니폴드에 충격량만 있음) 특징 ID로 이어 받기
+    if (manifold.pointCount > 0)
+    {
+        AddManifold(manifold);
+        return;
+    }
+
+    manifolds.push_back(*previous);
+    ContactManifold& current = manifolds.back();
+
+    // BodyStore 인덱스는 강체 제거 시 바뀌므로 새 값 사용
+    current.bodyA = manifold.bodyA;
+    current.bodyB = manifold.bodyB;
+    current.centerA = manifold.centerA;
+    current.centerB = manifold.centerB;
+    current.inverseMassA = manifold.inverseMassA;
+    current.inverseMassB = manifold.inverseMassB;
+    current.inverseInertiaA = manifold.inverseInertiaA;
+    current.inverseInertiaB = manifold.inverseInertiaB;
+    current.friction = manifold.friction;
+    current.restitution = manifold.restitution;
+}
+
+void ContactSolver::Clear()
+{
+    manifolds.clear();
+    previousManifolds.clear();
+    previousCursor = 0;
+}
+
+ContactManifold* ContactSolver::ResetManifolds(size_t count)
+{
+    manifolds.resize(count);
+    previousManifolds.clear();
+    previousCursor = 0;
+    return manifolds.data();
+}
+
+// ========== 풀이 ==========
+
+void ContactSolver::Solve(BodyStore& bodies, float deltaTime, const ContactSolverSettings& settings)
+{
+    if (manifolds.empty())
+        return;
+
+    // 양쪽 모두 잠들었거나 정적이면 풀이 생략 (누적 충격량은 그대로 유지)
+    for (ContactManifold& manifold : manifolds)
+    {
+        bool awakeA = manifold.bodyA >= 0 && !bodies.IsSleeping(manifold.bodyA);
+        bool awakeB = manifold.bodyB >= 0 && !bodies.IsSleeping(manifold.bodyB);
+        manifold.sleeping = !awakeA && !awakeB;
+    }
+
+    PrepareContacts(bodies, deltaTime, settings);
+
+    if (settings.warmStarting)
+    {
+        WarmStart(bodies);
+    }
+    else
+    {
+        for (ContactManifold& manifold : manifolds)
+        {
+            for (int i = 0; i < manifold.pointCount; i++)
+            {
+                manifold.points[i].normalImpulse = 0.0f;
+                manifold.points[i].tangentImpulse = 0.0f;
+            }
+        }
+    }
+
+    for (int iteration = 0; iteration < settings.velocityIterations; iteration++)
+    {
+        SolveVelocities(bodies);
+    }
+}
+
+void ContactSolver::PrepareContacts(const BodyStore& bodies, float deltaTime, const ContactSolverSettings& settings)
+{
+    float inverseDeltaTime = (deltaTime > 0.0f) ? 1.0f / deltaTime : 0.0f;
+
+    for (ContactManifold& manifold : manifolds)
+    {
+        if (manifold.sleeping)
+            continue;
+
+        BodyVelocity velocityA = LoadVelocity(bodies, manifold.bodyA);
+        BodyVelocity velocityB = LoadVelocity(bodies, manifold.bodyB);
+        XMFLOAT2 normal = manifold.normal;
+        XMFLOAT2 tangent = { normal.y, -normal.x };
+
+        for (int i = 0; i < manifold.pointCount; i++)
+        {
+            ContactPoint& point = manifold.points[i];
+            point.rA = Sub(point.position, manifold.centerA);
+            point.rB = Sub(point.position, manifold.centerB);
+
+            // 유효 질량 (법선/접선)
+            float rnA = Cross(point.rA, normal);
+            float rnB = Cross(point.rB, normal);
+            float normalK = manifold.inverseMassA + manifold.inverseMassB +
+                            manifold.inverseInertiaA * rnA * rnA + manifold.inverseInertiaB * rnB * rnB;
+            point.normalMass = (normalK > 0.0f) ? 1.0f / normalK : 0.0f;
+
+            float rtA = Cross(point.rA, tangent);
+            float rtB = Cross(point.rB, tangent);
+            float tangentK = manifold.inverseMassA + manifold.inverseMassB +
+                             manifold.inverseInertiaA * rtA * rtA + manifold.inverseInertiaB * rtB * rtB;
+            point.tangentMass = (tangentK > 0.0f) ? 1.0f / tangentK : 0.0f;
+
+            // 침투 보정 (Baumgarte) 과 반발 중 큰 값
+            float penetrationBias = settings.baumgarte * inverseDeltaTime *
+                                    (std::max)(0.0f, -point.separation - settings.linearSlop);
+
+            float normalVelocity = Dot(RelativeVelocity(velocityA, velocityB, point), normal);
+            float restitutionBias = (normalVelocity < -settings.restitutionThreshold)
+                ? -manifold.restitution * normalVelocity
+                : 0.0f;
+
+            point.velocityBias = (std::max)(penetrationBias, restitutionBias);
+        }
+    }
+}
+
+void ContactSolver::WarmStart(BodyStore& bodies)
+{
+    for (ContactManifold& manifold : manifolds)
+    {
+        if (manifold.sleeping)
+            continue;
+
+        BodyVelocity velocityA = LoadVelocity(bodies, manifold.bodyA);
+        BodyVelocity velocityB = LoadVelocity(bodies, manifold.bodyB);
+        XMFLOAT2 normal = manifold.normal;
+        XMFLOAT2 tangent = { normal.y, -normal.x };
+
+        for (int i = 0; i < manifold.pointCount; i++)
+        {
+            const ContactPoint& point = manifold.points[i];
+            XMFLOAT2 impulse = Add(Scale(normal, point.normalImpulse), Scale(tangent, point.tangentImpulse));
+            ApplyImpulse(manifold, point, impulse, velocityA, velocityB);
+        }
+
+        StoreVelocity(bodies, manifold.bodyA, velocityA);
+        StoreVelocity(bodies, manifold.bodyB, velocityB);
+    }
+}
+
+void ContactSolver::SolveVelocities(BodyStore& bodies)
+{
+    for (ContactManifold& manifold : manifolds)
+    {
+        if (manifold.sleeping)
+            continue;
+
+        BodyVelocity velocityA = LoadVelocity(bodies, manifold.bodyA);
+        BodyVelocity velocityB = LoadVelocity(bodies, manifold.bodyB);
+        XMFLOAT2 normal = manifold.normal;
+        XMFLOAT2 tangent = { normal.y, -normal.x };
+
+        for (int i = 0; i < manifold.pointCount; i++)
+        {
+            ContactPoint& point = manifold.points[i];
+
+            // 1. 법선 충격량 (누적값 >= 0)
+            float normalVelocity = Dot(RelativeVelocity(velocityA, velocityB, point), normal);
+            float lambda = point.normalMass * (point.velocityBias - normalVelocity);
+
+            float newImpulse = (std::max)(point.normalImpulse + lambda, 0.0f);
+            lambda = newImpulse - point.normalImpulse;
+            point.normalImpulse = newImpulse;
+
+            ApplyImpulse(manifold, point, Scale(normal, lambda), velocityA, velocityB);
+
+            // 2. 마찰 충격량 (|누적값| <= μ * 법선 누적값)
+            float tangentVelocity = Dot(RelativeVelocity(velocityA, velocityB, point), tangent);
+            float tangentLambda = -point.tangentMass * tangentVelocity;
+
+            float maxFriction = manifold.friction * point.normalImpulse;
+            float newTangentImpulse = (std::max)(-maxFriction, (std::min)(point.tangentImpulse + tangentLambda, maxFriction));
+            tangentLambda = newTangentImpulse - point.tangentImpulse;
+            point.tangentImpulse = newTangentImpulse;
+
+            ApplyImpulse(manifold, point, Scale(tangent, tangentLambda), velocityA, velocityB);
+        }
+
+        StoreVelocity(bodies, manifold.bodyA, velocityA);
+        StoreVelocity(bodies, manifold.bodyB, velocityB);
+    }
+}
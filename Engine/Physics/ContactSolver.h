@@ -0,0 +1,127 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <DirectXMath.h>
+#include "Physics/BodyStore.h"
+
+using namespace DirectX;
+
+class BaseCollider;
+
+// 접촉점 (특징 ID로 프레임 간 매칭해 누적 충격량 유지)
+struct ContactPoint
+{
+    XMFLOAT2 position{0.0f, 0.0f};  // 월드 접촉점
+    float separation = 0.0f;        // 음수 = 침투 깊이
+    uint32_t featureId = 0;         // 접촉을 만든 변/꼭짓점 조합
+
+    // 누적 충격량 (Warm Starting)
+    float normalImpulse = 0.0f;
+    float tangentImpulse = 0.0f;
+
+    // 솔버 준비 값
+    XMFLOAT2 rA{0.0f, 0.0f};        // 강체 중심 → 접촉점
+    XMFLOAT2 rB{0.0f, 0.0f};
+    float normalMass = 0.0f;
+    float tangentMass = 0.0f;
+    float velocityBias = 0.0f;      // 침투 보정 + 반발
+};
+
+// 두 콜라이더의 접촉 정보 (최대 2점)
+struct ContactManifold
+{
+    static const int MaxPoints = 2;
+
+    BaseCollider* colliderA = nullptr;  // 콜라이더 ID 순서 (A < B)
+    BaseCollider* colliderB = nullptr;
+    uint64_t pairKey = 0;               // 두 콜라이더 ID (프레임 간 매칭, 삭제된 콜라이더도 역참조 없이 비교)
+
+    XMFLOAT2 normal{0.0f, 1.0f};        // A → B
+    ContactPoint points[MaxPoints];
+    int pointCount = 0;
+
+    // 강체 (BodyStore 인덱스, -1 = 정적)
+    int bodyA = -1;
+    int bodyB = -1;
+    XMFLOAT2 centerA{0.0f, 0.0f};       // 회전 중심 (강체 위치)
+    XMFLOAT2 centerB{0.0f, 0.0f};
+    float inverseMassA = 0.0f;
+    float inverseMassB = 0.0f;
+    float inverseInertiaA = 0.0f;
+    float inverseInertiaB = 0.0f;
+
+    float friction = 0.0f;
+    float restitution = 0.0f;
+
+    bool sleeping = false;              // 양쪽 모두 잠들었거나 정적 (내로우페이즈: 이전 접촉 유지, Solve: 풀이 생략)
+};
+
+// 솔버 설정
+struct ContactSolverSettings
+{
+    int velocityIterations = 4;         // 속도 반복 횟수
+    bool warmStarting = true;           // 이전 스텝 충격량으로 시작
+    float baumgarte = 0.2f;             // 침투 보정 비율 (스텝당)
+    float linearSlop = 0.5f;            // 허용 침투 (픽셀, 떨림 방지)
+    float restitutionThreshold = 50.0f; // 이보다 느린 충돌은 반발 없음 (픽셀/s)
+};
+
+// Sequential Impulse 접촉 솔버 (Box2D 방식)
+// - 다각형(OBB, 볼록 다각형, 캡슐)은 참조 면 클리핑으로 최대 2개 접촉점 생성
+// - 접촉점은 특징 ID로 이전 스텝과 매칭해 누적 충격량을 이어 받음 (Warm Starting)
+// - 법선 충격량은 0 이상, 마찰은 쿨롱 원뿔로 누적값을 제한
+class ContactSolver
+{
+public:
+    // 접촉 정보 계산 (겹치지 않으면 false). colliderA/B, normal, points만 채움
+    // 형태 쌍은 CollisionDispatch 테이블로 분기
+    static bool Collide(BaseCollider* colliderA, BaseCollider* colliderB, ContactManifold& outManifold);
+
+    // 형태 쌍별 접촉 생성 (CollisionDispatch 기본 등록 함수, 법선 = A → B)
+    static bool CollideBoxBox(BaseCollider* colliderA, BaseCollider* colliderB, ContactManifold& outManifold);
+    static bool CollideBoxCircle(BaseCollider* box, BaseCollider* circle, ContactManifold& outManifold);
+    static bool CollideCircleCircle(BaseCollider* colliderA, BaseCollider* colliderB, ContactManifold& outManifold);
+    static bool CollideConvex(BaseCollider* colliderA, BaseCollider* colliderB, ContactManifold& outManifold);
+    static bool CollideConvexCircle(BaseCollider* convex, BaseCollider* circle, ContactManifold& outManifold);
+
+    // 콜라이더 형태 기준 관성 모멘트의 역수 (mass = 질량)
+    static float ComputeInverseInertia(BaseCollider* collider, float mass);
+
+    // 스텝 시작 (이번 스텝 목록을 이전 목록으로 넘김)
+    void BeginStep();
+
+    // 접촉 추가 (콜라이더 쌍 정렬 순서대로 호출해야 이전 스텝과 매칭됨)
+    void AddManifold(const ContactManifold& manifold);
+
+    // 잠든 쌍: 이전 스텝 접촉점/충격량을 그대로 유지하고 강체 정보만 갱신 (없으면 무시)
+    // 잠든 강체는 움직이지 않으므로 깨어날 때 접촉을 다시 만들지 않고 이어서 풀이
+    // manifold에 접촉점이 있으면 (스냅샷 복원 직후) 그 접촉점에 이전 충격량만 이어 받음
+    void KeepManifold(const ContactManifold& manifold);
+
+    // 속도 제약 풀이 (BodyStore 속도/회전 속도 갱신, 잠든 매니폴드는 생략)
+    void Solve(BodyStore& bodies, float deltaTime, const ContactSolverSettings& settings);
+
+    void Clear();
+
+    const std::vector<ContactManifold>& GetManifolds() const { return manifolds; }
+
+    // 이번 스텝 쌍 키의 매니폴드 (없으면 nullptr, 쌍 정렬 순서이므로 이진 탐색)
+    const ContactManifold* FindManifold(uint64_t pairKey) const;
+
+    // 스냅샷 복원: 이번 스텝 매니폴드를 count개로 비우고 채울 버퍼 반환 (다음 스텝 Warm Starting에 사용)
+    // 복원한 매니폴드는 쌍 키, 특징 ID, 누적 충격량만 채움 (나머지는 다음 스텝에 다시 계산)
+    ContactManifold* ResetManifolds(size_t count);
+
+private:
+    // 같은 쌍의 이전 스텝 매니폴드 (정렬 순서 커서 이동, 없으면 nullptr)
+    const ContactManifold* FindPrevious(const ContactManifold& manifold);
+
+    void PrepareContacts(const BodyStore& bodies, float deltaTime, const ContactSolverSettings& settings);
+    void WarmStart(BodyStore& bodies);
+    void SolveVelocities(BodyStore& bodies);
+
+private:
+    std::vector<ContactManifold> manifolds;          // 이번 스텝 (쌍 정렬 순서)
+    std::vector<ContactManifold> previousManifolds;  // 이전 스텝
+    size_t previousCursor = 0;                       // 병합 매칭 위치
+};
@@ -0,0 +1,307 @@
+#include "Physics/ConvexPolygon.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    inline float Dot(const XMFLOAT2& a, const XMFLOAT2& b) { return a.x * b.x + a.y * b.y; }
+    inline float Cross(const XMFLOAT2& a, const XMFLOAT2& b) { return a.x * b.y - a.y * b.x; }
+    inline XMFLOAT2 Sub(const XMFLOAT2& a, const XMFLOAT2& b) { return { a.x - b.x, a.y - b.y }; }
+    inline XMFLOAT2 Add(const XMFLOAT2& a, const XMFLOAT2& b) { return { a.x + b.x, a.y + b.y }; }
+    inline XMFLOAT2 Scale(const XMFLOAT2& v, float s) { return { v.x * s, v.y * s }; }
+
+    inline XMFLOAT2 Normalize(const XMFLOAT2& v, const XMFLOAT2& fallback)
+    {
+        float length = sqrtf(Dot(v, v));
+        return (length > 0.0001f) ? Scale(v, 1.0f / length) : fallback;
+    }
+
+    XMFLOAT2 ClosestPointOnSegment(const XMFLOAT2& point, const XMFLOAT2& start, const XMFLOAT2& end)
+    {
+        XMFLOAT2 edge = Sub(end, start);
+        float lengthSq = Dot(edge, edge);
+        if (lengthSq <= 0.0f)
+            return start;
+
+        float t = (std::max)(0.0f, (std::min)(1.0f, Dot(Sub(point, start), edge) / lengthSq));
+        return Add(start, Scale(edge, t));
+    }
+
+    // 꼭짓점 ↔ 변 검사에 쓰는 변 개수 (점은 자기 자신, 선분은 한 변)
+    inline int GetEdgeCount(const ConvexPolygon& polygon)
+    {
+        return (polygon.count >= 3) ? polygon.count : 1;
+    }
+
+    // 중심부(radius 제외) 투영 구간이 떨어져 있는지
+    bool IsSeparatedOnAxis(const ConvexPolygon& a, const ConvexPolygon& b, const XMFLOAT2& axis)
+    {
+        float minA = FLT_MAX, maxA = -FLT_MAX;
+        float minB = FLT_MAX, maxB = -FLT_MAX;
+
+        for (int i = 0; i < a.count; i++)
+        {
+            float projection = Dot(a.vertices[i], axis);
+            minA = (std::min)(minA, projection);
+            maxA = (std::max)(maxA, projection);
+        }
+
+        for (int i = 0; i < b.count; i++)
+        {
+            float projection = Dot(b.vertices[i], axis);
+            minB = (std::min)(minB, projection);
+            maxB = (std::max)(maxB, projection);
+        }
+
+        return maxA < minB || maxB < minA;
+    }
+
+    // 분리축 후보: 다각형은 변 법선, 선분은 법선 + 방향 (같은 직선 위에서 떨어진 경우)
+    bool HasSeparatingAxis(const ConvexPolygon& polygon, const ConvexPolygon& a, const ConvexPolygon& b)
+    {
+        if (polygon.count >= 3)
+        {
+            for (int i = 0; i < polygon.count; i++)
+            {
+                if (IsSeparatedOnAxis(a, b, polygon.normals[i]))
+                    return true;
+            }
+            return false;
+        }
+
+        if (polygon.count == 2)
+        {
+            const XMFLOAT2& normal = polygon.normals[0];
+            return IsSeparatedOnAxis(a, b, normal) || IsSeparatedOnAxis(a, b, { -normal.y, normal.x });
+        }
+
+        return false;
+    }
+
+    bool CoresSeparated(const ConvexPolygon& a, const ConvexPolygon& b)
+    {
+        if (a.count == 1 && b.count == 1)
+            return a.vertices[0].x != b.vertices[0].x || a.vertices[0].y != b.vertices[0].y;
+
+        return HasSeparatingAxis(a, a, b) || HasSeparatingAxis(b, a, b);
+    }
+}
+
+bool ConvexPolygon::SetHull(const XMFLOAT2* points, int pointCount)
+{
+    // 가까운 점은 하나로 (짧은 변은 법선이 불안정)
+    const float WeldDistanceSq = 0.0001f;
+    std::vector<XMFLOAT2> unique;
+    unique.reserve(pointCount);
+
+    for (int i = 0; i < pointCount; i++)
+    {
+        bool duplicate = false;
+        for (const XMFLOAT2& point : unique)
+        {
+            XMFLOAT2 delta = Sub(points[i], point);
+            if (Dot(delta, delta) < WeldDistanceSq)
+            {
+                duplicate = true;
+                break;
+            }
+        }
+
+        if (!duplicate)
+            unique.push_back(points[i]);
+    }
+
+    if (unique.size() < 3)
+        return false;
+
+    std::sort(unique.begin(), unique.end(), [](const XMFLOAT2& a, const XMFLOAT2& b)
+    {
+        return (a.x < b.x) || (a.x == b.x && a.y < b.y);
+    });
+
+    // Monotone Chain (아래 → 위 껍질, 일직선 위 점은 cross <= 0으로 제거)
+    std::vector<XMFLOAT2> hull(unique.size() * 2);
+    int size = 0;
+
+    for (size_t i = 0; i < unique.size(); i++)
+    {
+        while (size >= 2 && Cross(Sub(hull[size - 1], hull[size - 2]), Sub(unique[i], hull[size - 2])) <= 0.0f)
+            size--;
+        hull[size++] = unique[i];
+    }
+
+    for (int i = static_cast<int>(unique.size()) - 2, lower = size + 1; i >= 0; i--)
+    {
+        while (size >= lower && Cross(Sub(hull[size - 1], hull[size - 2]), Sub(unique[i], hull[size - 2])) <= 0.0f)
+            size--;
+        hull[size++] = unique[i];
+    }
+
+    // 마지막 점 = 첫 점
+    size--;
+    if (size < 3 || size > MaxVertices)
+        return false;
+
+    count = size;
+    radius = 0.0f;
+    for (int i = 0; i < size; i++)
+        vertices[i] = hull[i];
+
+    ComputeNormals();
+    return true;
+}
+
+void ConvexPolygon::SetBox(const XMFLOAT2& center, const XMFLOAT2& axisX, const XMFLOAT2& axisY, const XMFLOAT2& halfExtents)
+{
+    XMFLOAT2 x = Scale(axisX, halfExtents.x);
+    XMFLOAT2 y = Scale(axisY, halfExtents.y);
+
+    count = 4;
+    radius = 0.0f;
+    vertices[0] = Sub(Sub(center, x), y);
+    vertices[1] = Sub(Add(center, x), y);
+    vertices[2] = Add(Add(center, x), y);
+    vertices[3] = Add(Sub(center, x), y);
+    normals[0] = Scale(axisY, -1.0f);
+    normals[1] = axisX;
+    normals[2] = axisY;
+    normals[3] = Scale(axisX, -1.0f);
+}
+
+void ConvexPolygon::ComputeNormals()
+{
+    if (count == 2)
+    {
+        XMFLOAT2 edge = Sub(vertices[1], vertices[0]);
+        normals[0] = Normalize({ edge.y, -edge.x }, { 1.0f, 0.0f });
+        normals[1] = Scale(normals[0], -1.0f);
+        return;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        XMFLOAT2 edge = Sub(vertices[(i + 1) % count], vertices[i]);
+        normals[i] = Normalize({ edge.y, -edge.x }, { 0.0f, 1.0f });
+    }
+}
+
+XMFLOAT2 ConvexPolygon::GetCentroid() const
+{
+    XMFLOAT2 sum{ 0.0f, 0.0f };
+    for (int i = 0; i < count; i++)
+        sum = Add(sum, vertices[i]);
+
+    return (count > 0) ? Scale(sum, 1.0f / count) : sum;
+}
+
+void ConvexPolygon::ComputeBounds(XMFLOAT2& outMin, XMFLOAT2& outMax) const
+{
+    outMin = { FLT_MAX, FLT_MAX };
+    outMax = { -FLT_MAX, -FLT_MAX };
+
+    for (int i = 0; i < count; i++)
+    {
+        outMin.x = (std::min)(outMin.x, vertices[i].x);
+        outMin.y = (std::min)(outMin.y, vertices[i].y);
+        outMax.x = (std::max)(outMax.x, vertices[i].x);
+        outMax.y = (std::max)(outMax.y, vertices[i].y);
+    }
+
+    float extent = fabsf(radius);
+    outMin = { outMin.x - extent, outMin.y - extent };
+    outMax = { outMax.x + extent, outMax.y + extent };
+}
+
+float ConvexPolygon::Distance(const ConvexPolygon& a, const ConvexPolygon& b, XMFLOAT2& outNormal, XMFLOAT2& outPointA)
+{
+    XMFLOAT2 centroidA = a.GetCentroid();
+    outNormal = Normalize(Sub(b.GetCentroid(), centroidA), { 0.0f, 1.0f });
+
+    // 중심부끼리 겹침
+    if (!CoresSeparated(a, b))
+    {
+        outPointA = Add(centroidA, Scale(outNormal, fabsf(a.radius)));
+        return 0.0f;
+    }
+
+    // 분리된 볼록 형태 사이 거리 = 꼭짓점 ↔ 상대 변 최단 거리
+    float bestDistanceSq = FLT_MAX;
+    XMFLOAT2 bestOffset{ 0.0f, 0.0f };
+    XMFLOAT2 bestPointA = centroidA;
+
+    int edgeCountA = GetEdgeCount(a);
+    int edgeCountB = GetEdgeCount(b);
+
+    for (int i = 0; i < a.count; i++)
+    {
+        for (int j = 0; j < edgeCountB; j++)
+        {
+            XMFLOAT2 closestOnB = ClosestPointOnSegment(a.vertices[i], b.vertices[j], b.vertices[(j + 1) % b.count]);
+            XMFLOAT2 offset = Sub(closestOnB, a.vertices[i]);
+            float distanceSq = Dot(offset, offset);
+            if (distanceSq < bestDistanceSq)
+            {
+                bestDistanceSq = distanceSq;
+                bestOffset = offset;
+                bestPointA = a.vertices[i];
+            }
+        }
+    }
+
+    // B 꼭짓점 → A 변 (법선은 A → B)
+    for (int i = 0; i < b.count; i++)
+    {
+        for (int j = 0; j < edgeCountA; j++)
+        {
+            XMFLOAT2 closestOnA = ClosestPointOnSegment(b.vertices[i], a.vertices[j], a.vertices[(j + 1) % a.count]);
+            XMFLOAT2 offset = Sub(b.vertices[i], closestOnA);
+            float distanceSq = Dot(offset, offset);
+            if (distanceSq < bestDistanceSq)
+            {
+                bestDistanceSq = distanceSq;
+                bestOffset = offset;
+                bestPointA = closestOnA;
+            }
+        }
+    }
+
+    outNormal = Normalize(bestOffset, outNormal);
+    outPointA = Add(bestPointA, Scale(outNormal, fabsf(a.radius)));
+    return (std::max)(0.0f, sqrtf(bestDistanceSq) - fabsf(a.radius) - fabsf(b.radius));
+}
+
+bool ConvexPolygon::Overlaps(const ConvexPolygon& a, const ConvexPolygon& b)
+{
+    float totalRadius = fabsf(a.radius) + fabsf(b.radius);
+
+    // 캐시된 변 법선으로 SAT (반지름만큼 여유, 변 방향에서 법선을 다시 계산하지 않음)
+    const ConvexPolygon* polygons[2] = { &a, &b };
+    for (int side = 0; side < 2; side++)
+    {
+        const ConvexPolygon& polygon1 = *polygons[side];
+        const ConvexPolygon& polygon2 = *polygons[1 - side];
+        if (polygon1.count < 2)
+            continue;
+
+        for (int i = 0; i < polygon1.count; i++)
+        {
+            float separation = FLT_MAX;
+            for (int j = 0; j < polygon2.count; j++)
+                separation = (std::min)(separation, Dot(polygon1.normals[i], Sub(polygon2.vertices[j], polygon1.vertices[i])));
+
+            if (separation > totalRadius)
+                return false;
+        }
+    }
+
+    // 모서리가 없는 다각형끼리는 변 법선만으로 충분
+    if (totalRadius <= 0.0f && a.count >= 3 && b.count >= 3)
+        return true;
+
+    // 둥근 모서리/선분 끝은 최단 거리로 확인
+    XMFLOAT2 normal;
+    XMFLOAT2 point;
+    return Distance(a, b, normal, point) <= 0.0f;
+}
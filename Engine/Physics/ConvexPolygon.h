@@ -0,0 +1,42 @@
+#pragma once
+#include <DirectXMath.h>
+
+using namespace DirectX;
+
+// 둥근 볼록 다각형 (반시계 방향, 최대 8꼭짓점)
+// - 다각형 콜라이더: 꼭짓점 3~8개, radius = 0
+// - 캡슐: 꼭짓점 2개 (양 끝 반원 중심) + radius, 원: 꼭짓점 1개 + radius
+// - 변 i = vertices[i] → vertices[i + 1], normals[i]는 그 바깥 법선 (꼭짓점 2개면 선분 양쪽 법선)
+struct ConvexPolygon
+{
+    static const int MaxVertices = 8;
+
+    XMFLOAT2 vertices[MaxVertices];
+    XMFLOAT2 normals[MaxVertices];
+    int count = 0;
+    float radius = 0.0f;
+
+    // 점 목록의 볼록 껍질로 설정 (반시계, 일직선 위 점 제거, radius = 0)
+    // 껍질 꼭짓점이 3개 미만이거나 MaxVertices를 넘으면 false (기존 값 유지)
+    bool SetHull(const XMFLOAT2* points, int pointCount);
+
+    // OBB로 설정 (단위 축 + 양수 반 크기, 반시계, 변 법선 = -axisY, axisX, axisY, -axisX 그대로)
+    // 박스 콜라이더 월드 형태 캐시(ColliderWorldShape)와 쿼리 형태(QueryShape)가 같은 값으로 변환
+    void SetBox(const XMFLOAT2& center, const XMFLOAT2& axisX, const XMFLOAT2& axisY, const XMFLOAT2& halfExtents);
+
+    // 꼭짓점으로 변 법선 다시 계산 (SetHull/감김이 바뀐 변환 후에만, 평소에는 회전만)
+    void ComputeNormals();
+
+    // 꼭짓점 평균 (볼록 다각형 내부)
+    XMFLOAT2 GetCentroid() const;
+
+    // AABB (radius 포함)
+    void ComputeBounds(XMFLOAT2& outMin, XMFLOAT2& outMax) const;
+
+    // 두 형태 사이 최단 거리 (radius 포함, 겹치면 0)
+    // outNormal = A → B, outPointA = A 표면의 최근접점 (겹치면 중심 방향 근사)
+    static float Distance(const ConvexPolygon& a, const ConvexPolygon& b, XMFLOAT2& outNormal, XMFLOAT2& outPointA);
+
+    // 겹침 (캐시된 변 법선으로 SAT, 둥근 형태는 SAT를 통과한 경우만 최단 거리로 확인)
+    static bool Overlaps(const ConvexPolygon& a, const ConvexPolygon& b);
+};
@@ -0,0 +1,367 @@
+#include "Physics/DynamicAABBTree.h"
+#include <algorithm>
+
+DynamicAABBTree::DynamicAABBTree()
+{
+    nodes.reserve(256);
+    queryStack.reserve(256);
+}
+
+// ========== 노드 풀 ==========
+
+int DynamicAABBTree::AllocateNode()
+{
+    // free list가 비었으면 풀 확장
+    if (freeList == NullNode)
+    {
+        nodes.emplace_back();
+        int nodeId = static_cast<int>(nodes.size()) - 1;
+        nodes[nodeId].height = 0;
+        return nodeId;
+    }
+
+    int nodeId = freeList;
+    freeList = nodes[nodeId].parent;
+
+    TreeNode& node = nodes[nodeId];
+    node.collider = nullptr;
+    node.parent = NullNode;
+    node.child1 = NullNode;
+    node.child2 = NullNode;
+    node.height = 0;
+    return nodeId;
+}
+
+void DynamicAABBTree::FreeNode(int nodeId)
+{
+    nodes[nodeId].parent = freeList;
+    nodes[nodeId].height = -1;
+    nodes[nodeId].collider = nullptr;
+    freeList = nodeId;
+}
+
+// ========== 프록시 ==========
+
+int DynamicAABBTree::CreateProxy(const AABB& aabb, BaseCollider* collider)
+{
+    int proxyId = AllocateNode();
+
+    TreeNode& node = nodes[proxyId];
+    node.aabb = AABB(
+        aabb.min.x - aabbMargin, aabb.min.y - aabbMargin,
+        aabb.max.x + aabbMargin, aabb.max.y + aabbMargin
+    );
+    node.collider = collider;
+    node.height = 0;
+
+    InsertLeaf(proxyId);
+    proxyCount++;
+
+    return proxyId;
+}
+
+void DynamicAABBTree::DestroyProxy(int proxyId)
+{
+    if (proxyId < 0 || proxyId >= static_cast<int>(nodes.size()) || !nodes[proxyId].IsLeaf())
+        return;
+
+    RemoveLeaf(proxyId);
+    FreeNode(proxyId);
+    proxyCount--;
+}
+
+bool DynamicAABBTree::MoveProxy(int proxyId, const AABB& aabb, const XMFLOAT2& displacement)
+{
+    // Fat AABB 안에 있으면 트리 변경 없음
+    if (nodes[proxyId].aabb.Contains(aabb))
+        return false;
+
+    RemoveLeaf(proxyId);
+
+    // 여유 공간 + 이동 방향 예측 확장
+    AABB fatAABB(
+        aabb.min.x - aabbMargin, aabb.min.y - aabbMargin,
+        aabb.max.x + aabbMargin, aabb.max.y + aabbMargin
+    );
+
+    float dx = displacementMultiplier * displacement.x;
+    float dy = displacementMultiplier * displacement.y;
+
+    if (dx < 0.0f) fatAABB.min.x += dx;
+    else           fatAABB.max.x += dx;
+
+    if (dy < 0.0f) fatAABB.min.y += dy;
+    else           fatAABB.max.y += dy;
+
+    nodes[proxyId].aabb = fatAABB;
+
+    InsertLeaf(proxyId);
+    return true;
+}
+
+void DynamicAABBTree::Clear()
+{
+    nodes.clear();
+    root = NullNode;
+    freeList = NullNode;
+    proxyCount = 0;
+}
+
+// ========== 삽입/제거 ==========
+
+AABB DynamicAABBTree::Combine(const AABB& a, const AABB& b)
+{
+    return AABB(
+        (std::min)(a.min.x, b.min.x), (std::min)(a.min.y, b.min.y),
+        (std::max)(a.max.x, b.max.x), (std::max)(a.max.y, b.max.y)
+    );
+}
+
+float DynamicAABBTree::Perimeter(const AABB& aabb)
+{
+    return 2.0f * ((aabb.max.x - aabb.min.x) + (aabb.max.y - aabb.min.y));
+}
+
+void DynamicAABBTree::InsertLeaf(int leaf)
+{
+    if (root == NullNode)
+    {
+        root = leaf;
+        nodes[root].parent = NullNode;
+        return;
+    }
+
+    // 1. 둘레(Perimeter) 비용이 가장 작은 형제 노드 탐색 (SAH)
+    AABB leafAABB = nodes[leaf].aabb;
+    int index = root;
+
+    while (!nodes[index].IsLeaf())
+    {
+        int child1 = nodes[index].child1;
+        int child2 = nodes[index].child2;
+
+        float area = Perimeter(nodes[index].aabb);
+        float combinedArea = Perimeter(Combine(nodes[index].aabb, leafAABB));
+
+        // 이 노드와 리프를 묶어 새 부모를 만드는 비용
+        float cost = 2.0f * combinedArea;
+
+        // 리프를 더 아래로 내려보낼 때 조상들이 커지는 비용
+        float inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto descendCost = [&](int child)
+        {
+            AABB combined = Combine(leafAABB, nodes[child].aabb);
+            if (nodes[child].IsLeaf())
+                return Perimeter(combined) + inheritanceCost;
+
+            return (Perimeter(combined) - Perimeter(nodes[child].aabb)) + inheritanceCost;
+        };
+
+        float cost1 = descendCost(child1);
+        float cost2 = descendCost(child2);
+
+        if (cost < cost1 && cost < cost2)
+            break;
+
+        index = (cost1 < cost2) ? child1 : child2;
+    }
+
+    int sibling = index;
+
+    // 2. 형제와 리프를 묶는 새 부모 생성
+    int oldParent = nodes[sibling].parent;
+    int newParent = AllocateNode();
+    nodes[newParent].parent = oldParent;
+    nodes[newParent].aabb = Combine(leafAABB, nodes[sibling].aabb);
+    nodes[newParent].height = nodes[sibling].height + 1;
+
+    if (oldParent != NullNode)
+    {
+        if (nodes[oldParent].child1 == sibling)
+            nodes[oldParent].child1 = newParent;
+        else
+            nodes[oldParent].child2 = newParent;
+    }
+    else
+    {
+        root = newParent;
+    }
+
+    nodes[newParent].child1 = sibling;
+    nodes[newParent].child2 = leaf;
+    nodes[sibling].parent = newParent;
+    nodes[leaf].parent = newParent;
+
+    // 3. 조상들의 AABB/높이 갱신 및 균형 조정
+    index = nodes[leaf].parent;
+    while (index != NullNode)
+    {
+        index = Balance(index);
+
+        int child1 = nodes[index].child1;
+        int child2 = nodes[index].child2;
+
+        nodes[index].height = 1 + (std::max)(nodes[child1].height, nodes[child2].height);
+        nodes[index].aabb = Combine(nodes[child1].aabb, nodes[child2].aabb);
+
+        index = nodes[index].parent;
+    }
+}
+
+void DynamicAABBTree::RemoveLeaf(int leaf)
+{
+    if (leaf == root)
+    {
+        root = NullNode;
+        return;
+    }
+
+    int parent = nodes[leaf].parent;
+    int grandParent = nodes[parent].parent;
+    int sibling = (nodes[parent].child1 == leaf) ? nodes[parent].child2 : nodes[parent].child1;
+
+    if (grandParent != NullNode)
+    {
+        // 부모를 제거하고 형제를 조부모에 연결
+        if (nodes[grandParent].child1 == parent)
+            nodes[grandParent].child1 = sibling;
+        else
+            nodes[grandParent].child2 = sibling;
+
+        nodes[sibling].parent = grandParent;
+        FreeNode(parent);
+
+        int index = grandParent;
+        while (index != NullNode)
+        {
+            index = Balance(index);
+
+            int child1 = nodes[index].child1;
+            int child2 = nodes[index].child2;
+
+            nodes[index].aabb = Combine(nodes[child1].aabb, nodes[child2].aabb);
+            nodes[index].height = 1 + (std::max)(nodes[child1].height, nodes[child2].height);
+
+            index = nodes[index].parent;
+        }
+    }
+    else
+    {
+        root = sibling;
+        nodes[sibling].parent = NullNode;
+        FreeNode(parent);
+    }
+}
+
+// ========== 균형 조정 ==========
+
+int DynamicAABBTree::Balance(int iA)
+{
+    TreeNode& A = nodes[iA];
+    if (A.IsLeaf() || A.height < 2)
+        return iA;
+
+    int iB = A.child1;
+    int iC = A.child2;
+
+    int balance = nodes[iC].height - nodes[iB].height;
+
+    // C를 위로 회전
+    if (balance > 1)
+    {
+        int iF = nodes[iC].child1;
+        int iG = nodes[iC].child2;
+
+        nodes[iC].child1 = iA;
+        nodes[iC].parent = A.parent;
+        A.parent = iC;
+
+        if (nodes[iC].parent != NullNode)
+        {
+            if (nodes[nodes[iC].parent].child1 == iA)
+                nodes[nodes[iC].parent].child1 = iC;
+            else
+                nodes[nodes[iC].parent].child2 = iC;
+        }
+        else
+        {
+            root = iC;
+        }
+
+        if (nodes[iF].height > nodes[iG].height)
+        {
+            nodes[iC].child2 = iF;
+            A.child2 = iG;
+            nodes[iG].parent = iA;
+            A.aabb = Combine(nodes[iB].aabb, nodes[iG].aabb);
+            nodes[iC].aabb = Combine(A.aabb, nodes[iF].aabb);
+
+            A.height = 1 + (std::max)(nodes[iB].height, nodes[iG].height);
+            nodes[iC].height = 1 + (std::max)(A.height, nodes[iF].height);
+        }
+        else
+        {
+            nodes[iC].child2 = iG;
+            A.child2 = iF;
+            nodes[iF].parent = iA;
+            A.aabb = Combine(nodes[iB].aabb, nodes[iF].aabb);
+            nodes[iC].aabb = Combine(A.aabb, nodes[iG].aabb);
+
+            A.height = 1 + (std::max)(nodes[iB].height, nodes[iF].height);
+            nodes[iC].height = 1 + (std::max)(A.height, nodes[iG].height);
+        }
+
+        return iC;
+    }
+
+    // B를 위로 회전
+    if (balance < -1)
+    {
+        int iD = nodes[iB].child1;
+        int iE = nodes[iB].child2;
+
+        nodes[iB].child1 = iA;
+        nodes[iB].parent = A.parent;
+        A.parent = iB;
+
+        if (nodes[iB].parent != NullNode)
+        {
+            if (nodes[nodes[iB].parent].child1 == iA)
+                nodes[nodes[iB].parent].child1 = iB;
+            else
+                nodes[nodes[iB].parent].child2 = iB;
+        }
+        else
+        {
+            root = iB;
+        }
+
+        if (nodes[iD].height > nodes[iE].height)
+        {
+            nodes[iB].child2 = iD;
+            A.child1 = iE;
+            nodes[iE].parent = iA;
+            A.aabb = Combine(nodes[iC].aabb, nodes[iE].aabb);
+            nodes[iB].aabb = Combine(A.aabb, nodes[iD].aabb);
+
+            A.height = 1 + (std::max)(nodes[iC].height, nodes[iE].height);
+            nodes[iB].height = 1 + (std::max)(A.height, nodes[iD].height);
+        }
+        else
+        {
+            nodes[iB].child2 = iE;
+            A.child1 = iD;
+            nodes[iD].parent = iA;
+            A.aabb = Combine(nodes[iC].aabb, nodes[iD].aabb);
+            nodes[iB].aabb = Combine(A.aabb, nodes[iE].aabb);
+
+            A.height = 1 + (std::max)(nodes[iC].height, nodes[iD].height);
+            nodes[iB].height = 1 + (std::max)(A.height, nodes[iE].height);
+        }
+
+        return iB;
+    }
+
+    return iA;
+}
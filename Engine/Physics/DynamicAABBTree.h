@@ -0,0 +1,189 @@
+#pragma once
+#include <vector>
+#include "Physics/Quadtree.h"
+
+class BaseCollider;
+
+// 동적 AABB 트리 (증분 업데이트 브로드페이즈)
+// - 매 스텝 재구축하지 않고, 프록시가 자신의 Fat AABB를 벗어날 때만 재삽입
+// - 노드는 풀(vector)에서 관리하여 new/delete 없음
+class DynamicAABBTree
+{
+public:
+    static constexpr int NullNode = -1;
+
+    DynamicAABBTree();
+
+    // 프록시 생성/제거 (반환값: 프록시 ID)
+    int CreateProxy(const AABB& aabb, BaseCollider* collider);
+    void DestroyProxy(int proxyId);
+
+    // 프록시 이동 (Fat AABB를 벗어났을 때만 재삽입, 재삽입 시 true)
+    bool MoveProxy(int proxyId, const AABB& aabb, const XMFLOAT2& displacement);
+
+    // 범위와 겹치는 프록시 순회 (callback(proxyId)가 false를 반환하면 중단)
+    template<typename Callback>
+    void Query(const AABB& range, Callback&& callback) const;
+
+    // 선분(origin + direction * t, 0 <= t <= maxDistance)과 겹치는 프록시 순회
+    // extents = 노드 AABB 확장량 (원/박스 캐스트의 형태 크기, 레이는 0)
+    // callback(proxyId, maxDistance)는 새 최대 거리를 반환 (더 가까운 히트로 탐색 범위 축소, 음수 = 중단)
+    template<typename Callback>
+    void RayCast(const XMFLOAT2& origin, const XMFLOAT2& direction, float maxDistance,
+                 const XMFLOAT2& extents, Callback&& callback) const;
+
+    BaseCollider* GetCollider(int proxyId) const { return nodes[proxyId].collider; }
+    const AABB& GetFatAABB(int proxyId) const { return nodes[proxyId].aabb; }
+
+    // 모든 프록시 제거
+    void Clear();
+
+    // 통계 (디버그용)
+    int GetProxyCount() const { return proxyCount; }
+    int GetHeight() const { return root == NullNode ? 0 : nodes[root].height; }
+
+    // Fat AABB 여유 공간 (픽셀)
+    float aabbMargin = 8.0f;
+    // 이동 방향으로 추가 확장하는 배율 (변위 * 배율)
+    float displacementMultiplier = 2.0f;
+
+private:
+    struct TreeNode
+    {
+        AABB aabb;                        // Fat AABB (리프) 또는 자식 합집합 (내부 노드)
+        BaseCollider* collider = nullptr; // 리프 노드의 콜라이더
+        int parent = NullNode;            // 부모 (free list에서는 next로 사용)
+        int child1 = NullNode;
+        int child2 = NullNode;
+        int height = -1;                  // 리프 = 0, free 노드 = -1
+
+        bool IsLeaf() const { return child1 == NullNode; }
+    };
+
+    int AllocateNode();
+    void FreeNode(int nodeId);
+
+    void InsertLeaf(int leaf);
+    void RemoveLeaf(int leaf);
+
+    // 회전으로 트리 균형 유지 (새 서브트리 루트 반환)
+    int Balance(int nodeId);
+
+    static AABB Combine(const AABB& a, const AABB& b);
+    static float Perimeter(const AABB& aabb);
+
+private:
+    std::vector<TreeNode> nodes;
+    int root = NullNode;
+    int freeList = NullNode;
+    int proxyCount = 0;
+
+    mutable std::vector<int> queryStack;  // Query용 스택 (재할당 방지)
+};
+
+template<typename Callback>
+void DynamicAABBTree::Query(const AABB& range, Callback&& callback) const
+{
+    if (root == NullNode)
+        return;
+
+    queryStack.clear();
+    queryStack.push_back(root);
+
+    while (!queryStack.empty())
+    {
+        int nodeId = queryStack.back();
+        queryStack.pop_back();
+
+        const TreeNode& node = nodes[nodeId];
+        if (!node.aabb.Intersects(range))
+            continue;
+
+        if (node.IsLeaf())
+        {
+            if (!callback(nodeId))
+                return;
+        }
+        else
+        {
+            queryStack.push_back(node.child1);
+            queryStack.push_back(node.child2);
+        }
+    }
+}
+
+template<typename Callback>
+void DynamicAABBTree::RayCast(const XMFLOAT2& origin, const XMFLOAT2& direction, float maxDistance,
+                              const XMFLOAT2& extents, Callback&& callback) const
+{
+    if (root == NullNode)
+        return;
+
+    // 축별 역방향 (0 방향은 무한대 대신 큰 값)
+    const float Huge = 1e30f;
+    float inverseX = (direction.x != 0.0f) ? 1.0f / direction.x : Huge;
+    float inverseY = (direction.y != 0.0f) ? 1.0f / direction.y : Huge;
+
+    queryStack.clear();
+    queryStack.push_back(root);
+
+    while (!queryStack.empty())
+    {
+        int nodeId = queryStack.back();
+        queryStack.pop_back();
+
+        const TreeNode& node = nodes[nodeId];
+
+        // Slab 검사 (확장된 AABB)
+        float minX = node.aabb.min.x - extents.x;
+        float maxX = node.aabb.max.x + extents.x;
+        float minY = node.aabb.min.y - extents.y;
+        float maxY = node.aabb.max.y + extents.y;
+
+        float enter = 0.0f;
+        float exit = maxDistance;
+
+        if (direction.x == 0.0f)
+        {
+            if (origin.x < minX || origin.x > maxX)
+                continue;
+        }
+        else
+        {
+            float t1 = (minX - origin.x) * inverseX;
+            float t2 = (maxX - origin.x) * inverseX;
+            if (t1 > t2) { float temp = t1; t1 = t2; t2 = temp; }
+            if (t1 > enter) enter = t1;
+            if (t2 < exit) exit = t2;
+        }
+
+        if (direction.y == 0.0f)
+        {
+            if (origin.y < minY || origin.y > maxY)
+                continue;
+        }
+        else
+        {
+            float t1 = (minY - origin.y) * inverseY;
+            float t2 = (maxY - origin.y) * inverseY;
+            if (t1 > t2) { float temp = t1; t1 = t2; t2 = temp; }
+            if (t1 > enter) enter = t1;
+            if (t2 < exit) exit = t2;
+        }
+
+        if (enter > exit)
+            continue;
+
+        if (node.IsLeaf())
+        {
+            maxDistance = callback(nodeId, maxDistance);
+            if (maxDistance < 0.0f)
+                return;
+        }
+        else
+        {
+            queryStack.push_back(node.child1);
+            queryStack.push_back(node.child2);
+        }
+    }
+}
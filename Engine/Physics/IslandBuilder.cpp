@@ -0,0 +1,93 @@
+#include "Physics/IslandBuilder.h"
+
+bool IslandBuilder::IsIslandBody(const BodyStore& bodies, int bodyIndex)
+{
+    if (bodyIndex < 0)
+        return false;
+
+    uint32_t flags = bodies.flags[bodyIndex];
+    return (flags & BodyFlag_Active) && !(flags & BodyFlag_Kinematic);
+}
+
+void IslandBuilder::Build(const BodyStore& bodies, const std::vector<ContactManifold>& manifolds)
+{
+    const int bodyCount = bodies.GetCount();
+
+    // 1. 강체마다 자기 자신이 루트
+    parent.resize(bodyCount);
+    for (int i = 0; i < bodyCount; i++)
+    {
+        parent[i] = i;
+    }
+
+    // 2. 움직이는 강체끼리 접촉하면 합침
+    for (const ContactManifold& manifold : manifolds)
+    {
+        if (IsIslandBody(bodies, manifold.bodyA) && IsIslandBody(bodies, manifold.bodyB))
+            Union(manifold.bodyA, manifold.bodyB);
+    }
+
+    // 3. 루트별 섬 번호 부여 (강체 인덱스 순서 → 같은 입력이면 같은 번호)
+    islandOfBody.assign(bodyCount, -1);
+    islandCount = 0;
+
+    for (int i = 0; i < bodyCount; i++)
+    {
+        if (!IsIslandBody(bodies, i))
+            continue;
+
+        int root = Find(i);
+        if (islandOfBody[root] < 0)
+            islandOfBody[root] = islandCount++;
+
+        islandOfBody[i] = islandOfBody[root];
+    }
+
+    // 4. Kinematic 접촉 표시
+    touchesKinematic.assign(islandCount, 0);
+
+    for (const ContactManifold& manifold : manifolds)
+    {
+        bool kinematicA = manifold.bodyA >= 0 && (bodies.flags[manifold.bodyA] & BodyFlag_Kinematic);
+        bool kinematicB = manifold.bodyB >= 0 && (bodies.flags[manifold.bodyB] & BodyFlag_Kinematic);
+
+        if (kinematicA && IsIslandBody(bodies, manifold.bodyB))
+            touchesKinematic[islandOfBody[manifold.bodyB]] = 1;
+
+        if (kinematicB && IsIslandBody(bodies, manifold.bodyA))
+            touchesKinematic[islandOfBody[manifold.bodyA]] = 1;
+    }
+}
+
+void IslandBuilder::Clear()
+{
+    parent.clear();
+    islandOfBody.clear();
+    touchesKinematic.clear();
+    islandCount = 0;
+}
+
+int IslandBuilder::Find(int bodyIndex)
+{
+    // 경로 절반 압축
+    while (parent[bodyIndex] != bodyIndex)
+    {
+        parent[bodyIndex] = parent[parent[bodyIndex]];
+        bodyIndex = parent[bodyIndex];
+    }
+    return bodyIndex;
+}
+
+void IslandBuilder::Union(int bodyA, int bodyB)
+{
+    int rootA = Find(bodyA);
+    int rootB = Find(bodyB);
+    if (rootA == rootB)
+        return;
+
+    // 작은 인덱스를 루트로 (결정적)
+    if (rootA < rootB)
+        parent[rootB] = rootA;
+    else
+        parent[rootA] = rootB;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <vector>
+#include "Physics/BodyStore.h"
+#include "Physics/ContactSolver.h"
+
+// 접촉 그래프 섬(Island) 구성
+// - 접촉으로 이어진 움직이는 강체끼리 같은 섬 (Union-Find, 경로 압축)
+// - 정적/Kinematic 물체는 섬을 잇지 않음 (바닥 하나로 모든 강체가 한 섬이 되는 것 방지)
+// - Kinematic과 닿은 섬은 재울 수 없음 (Kinematic 이동을 감지할 수 없으므로)
+class IslandBuilder
+{
+public:
+    // 접촉 매니폴드로 섬 구성 (강체 인덱스 = BodyStore 인덱스)
+    void Build(const BodyStore& bodies, const std::vector<ContactManifold>& manifolds);
+
+    void Clear();
+
+    int GetIslandCount() const { return islandCount; }
+
+    // 강체의 섬 번호 (-1 = 비활성/Kinematic)
+    int GetIsland(int bodyIndex) const { return islandOfBody[bodyIndex]; }
+
+    // Kinematic 강체와 닿은 섬인지
+    bool TouchesKinematic(int island) const { return touchesKinematic[island] != 0; }
+
+private:
+    int Find(int bodyIndex);
+    void Union(int bodyA, int bodyB);
+
+    // 섬에 포함되는 강체 (Active && !Kinematic)
+    static bool IsIslandBody(const BodyStore& bodies, int bodyIndex);
+
+private:
+    std::vector<int> parent;
+    std::vector<int> islandOfBody;
+    std::vector<unsigned char> touchesKinematic;
+    int islandCount = 0;
+};
@@ -0,0 +1,123 @@
+#include "Physics/PhysicsProfiler.h"
+#include <algorithm>
+#include <iterator>
+
+namespace
+{
+    const int DefaultHistorySize = 120;
+
+    // 평균을 내는 카운터
+    int PhysicsStepStats::* const Counters[] =
+    {
+        &PhysicsStepStats::bodyCount,
+        &PhysicsStepStats::colliderCount,
+        &PhysicsStepStats::staticColliderCount,
+        &PhysicsStepStats::candidatePairCount,
+        &PhysicsStepStats::triggerPairCount,
+        &PhysicsStepStats::contactCount,
+        &PhysicsStepStats::eventCount,
+        &PhysicsStepStats::ccdHitCount,
+        &PhysicsStepStats::sleepingBodyCount,
+        &PhysicsStepStats::islandCount,
+        &PhysicsStepStats::quadtreeNodeCount,
+    };
+}
+
+PhysicsProfiler::PhysicsProfiler()
+{
+    SetHistorySize(DefaultHistorySize);
+}
+
+void PhysicsProfiler::SetHistorySize(int size)
+{
+    history.assign((std::max)(size, 1), PhysicsStepStats());
+    Clear();
+}
+
+void PhysicsProfiler::BeginStep()
+{
+    current = PhysicsStepStats();
+    current.step = ++stepNumber;
+    stepStart = Clock::now();
+    lastMark = stepStart;
+}
+
+void PhysicsProfiler::Mark(PhysicsPhase phase)
+{
+    Clock::time_point now = Clock::now();
+    current.phaseNs[static_cast<int>(phase)] +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now - lastMark).count();
+    lastMark = now;
+}
+
+PhysicsStepStats& PhysicsProfiler::EndStep()
+{
+    current.totalNs = std::chrono::duration_cast<std::chrono::nanoseconds>(lastMark - stepStart).count();
+    return current;
+}
+
+void PhysicsProfiler::Commit()
+{
+    history[next] = current;
+    next = (next + 1) % static_cast<int>(history.size());
+    count = (std::min)(count + 1, static_cast<int>(history.size()));
+}
+
+const PhysicsStepStats& PhysicsProfiler::GetStats(int age) const
+{
+    int size = static_cast<int>(history.size());
+    return history[(next - 1 - age + size * 2) % size];
+}
+
+PhysicsStepStats PhysicsProfiler::ComputeAverage(int stepCount) const
+{
+    PhysicsStepStats average;
+    int samples = (std::min)(stepCount, count);
+    if (samples <= 0)
+        return average;
+
+    // 카운터는 64비트로 합산 후 나눔
+    int64_t counterSums[std::size(Counters)] = {};
+    for (int age = 0; age < samples; age++)
+    {
+        const PhysicsStepStats& stats = GetStats(age);
+        average.totalNs += stats.totalNs;
+        for (int phase = 0; phase < static_cast<int>(PhysicsPhase::Count); phase++)
+            average.phaseNs[phase] += stats.phaseNs[phase];
+        for (size_t i = 0; i < std::size(Counters); i++)
+            counterSums[i] += stats.*Counters[i];
+    }
+
+    average.step = GetStats(0).step;
+    average.totalNs /= samples;
+    for (int phase = 0; phase < static_cast<int>(PhysicsPhase::Count); phase++)
+        average.phaseNs[phase] /= samples;
+    for (size_t i = 0; i < std::size(Counters); i++)
+        average.*Counters[i] = static_cast<int>(counterSums[i] / samples);
+
+    return average;
+}
+
+const char* PhysicsProfiler::GetPhaseName(PhysicsPhase phase)
+{
+    switch (phase)
+    {
+    case PhysicsPhase::Integrate:       return "integrate";
+    case PhysicsPhase::Gather:          return "gather";
+    case PhysicsPhase::BroadphaseBuild: return "broadphase_build";
+    case PhysicsPhase::BroadphaseQuery: return "broadphase_query";
+    case PhysicsPhase::Narrowphase:     return "narrowphase";
+    case PhysicsPhase::Triggers:        return "triggers";
+    case PhysicsPhase::Solve:           return "solve";
+    case PhysicsPhase::Continuous:      return "continuous";
+    case PhysicsPhase::Events:          return "events";
+    default:                            return "unknown";
+    }
+}
+
+void PhysicsProfiler::Clear()
+{
+    next = 0;
+    count = 0;
+    stepNumber = 0;
+}
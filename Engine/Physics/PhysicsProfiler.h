@@ -0,0 +1,88 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+// 물리 스텝 구간 (PhysicsStepStats::phaseNs 인덱스)
+enum class PhysicsPhase : uint8_t
+{
+    Integrate,        // 컴포넌트 동기화 + 속도/위치 적분 + Transform 기록
+    Gather,           // 활성 콜라이더 수집, 월드 형태 캐시, 정적 트리 갱신
+    BroadphaseBuild,  // 브로드페이즈 구조 재구축/갱신 (Quadtree 삽입, 트리 재삽입, 끝점 정렬, 해시 테이블)
+    BroadphaseQuery,  // 후보 쌍 수집 + 정적 쌍 + 정렬/중복 제거
+    Narrowphase,      // 후보 쌍 형태 판정 (워커 병렬)
+    Triggers,         // 트리거 쌍 겹침 판정 (매니폴드 없음)
+    Solve,            // 섬 구성, 접촉 풀이, 수면
+    Continuous,       // CCD 서브스텝
+    Events,           // 이벤트 수집 + 콜백 전달
+    Count
+};
+
+// 스텝 하나의 구간별 시간과 카운터
+struct PhysicsStepStats
+{
+    unsigned int step = 0;   // 프로파일한 스텝 번호 (Clear 후 1부터)
+    int64_t totalNs = 0;
+    int64_t phaseNs[static_cast<int>(PhysicsPhase::Count)] = {};
+
+    int bodyCount = 0;           // 등록 강체
+    int colliderCount = 0;       // 활성 동적 콜라이더
+    int staticColliderCount = 0; // 활성 정적 콜라이더
+    int candidatePairCount = 0;  // 레이어 필터 후 후보 쌍 (트리거 쌍 제외)
+    int triggerPairCount = 0;    // 트리거 후보 쌍
+    int contactCount = 0;        // 실제로 겹친 쌍
+    int eventCount = 0;          // 전달한 이벤트 (콜라이더 쌍 단위)
+    int ccdHitCount = 0;
+    int sleepingBodyCount = 0;
+    int islandCount = 0;
+    int quadtreeNodeCount = 0;   // Quadtree 방식으로 스텝했을 때만
+
+    int64_t GetPhaseNs(PhysicsPhase phase) const { return phaseNs[static_cast<int>(phase)]; }
+};
+
+// 물리 스텝 프로파일러 (최근 N스텝 링 버퍼)
+// - BeginStep → Mark(구간)... → EndStep 순으로 호출, Mark는 직전 Mark 이후 시간을 그 구간에 더함
+//   (같은 구간을 여러 번 Mark하면 합산)
+// - 기록 버퍼는 SetHistorySize 때만 할당 (스텝 중 할당 없음)
+class PhysicsProfiler
+{
+public:
+    PhysicsProfiler();
+
+    // 보관할 스텝 수 (기록 초기화)
+    void SetHistorySize(int size);
+    int GetHistorySize() const { return static_cast<int>(history.size()); }
+
+    void BeginStep();
+    void Mark(PhysicsPhase phase);
+
+    // 총 시간 기록 후 카운터를 채울 이번 스텝 통계 반환 (Commit 전까지 기록에 보이지 않음)
+    PhysicsStepStats& EndStep();
+    void Commit();
+
+    // 기록된 스텝 수 (최대 GetHistorySize())
+    int GetCount() const { return count; }
+
+    // age = 0이 가장 최근 스텝 (age < GetCount())
+    const PhysicsStepStats& GetStats(int age) const;
+
+    // 최근 stepCount 스텝 평균 (기록이 더 적으면 있는 만큼, 없으면 0)
+    PhysicsStepStats ComputeAverage(int stepCount) const;
+
+    void Clear();
+
+    // 구간 이름 (로그/JSON 키용, snake_case)
+    static const char* GetPhaseName(PhysicsPhase phase);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    std::vector<PhysicsStepStats> history;
+    int next = 0;   // 다음 기록 위치
+    int count = 0;
+    unsigned int stepNumber = 0;
+
+    PhysicsStepStats current;
+    Clock::time_point stepStart;
+    Clock::time_point lastMark;
+};
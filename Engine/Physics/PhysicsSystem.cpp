@@ -1,34 +1,70 @@
 #include "Physics/PhysicsSystem.h"
 #include "Core/GameObject.h"
 #include "Physics/BaseCollider.h"
+#include "Physics/BodyIntegrator.h"
+#include "Physics/ContactSolver.h"
 #include "Physics/Rigidbody2D.h"
 #include "Physics/BoxCollider2D.h"
 #include "Physics/CircleCollider.h"
 #include "Physics/Quadtree.h"
+#include "Physics/TilemapCollider.h"
+#include "Physics/TimeOfImpact.h"
 #include "Core/Transform.h"
 #include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
 
 PhysicsSystem::PhysicsSystem()
     : quadtree(nullptr)
 {
-    // Quadtree ʱȭ ( ü )
+    // Quadtree 초기화 (월드 전체 영역)
     AABB worldBounds(
         -worldWidth * 0.5f, -worldHeight * 0.5f,
         worldWidth * 0.5f, worldHeight * 0.5f
     );
-    quadtree = new Quadtree(worldBounds, 5, 4);  // ִ 5ܰ,  4
+    quadtree = new Quadtree(worldBounds, 5, 4);  // 최대 5단계, 노드당 4개
+    quadtreeWidth = worldWidth;
+    quadtreeHeight = worldHeight;
+
+    // 모든 레이어끼리 충돌
+    std::fill(std::begin(layerCollisionMatrix), std::end(layerCollisionMatrix), 0xFFFFFFFFu);
 }
 
 PhysicsSystem::~PhysicsSystem()
 {
+    // 등록된 GameObject가 삭제된 월드를 가리키지 않도록 해제
+    Clear();
     delete quadtree;
 }
 
+namespace
+{
+    // CCD 대상 이동량 기준 (형태 최소 반 두께 대비)
+    const float FastMotionRatio = 0.5f;
+
+    // CCD 충돌 시점 계산에 쓰는 중심부 비율 (형태 최소 반 두께 대비)
+    const float CoreFraction = 0.5f;
+
+    // 스윕 동안 형태가 지나는 범위 (시작/끝 AABB 합 + 회전으로 움직이는 거리 + margin)
+    AABB ComputeSweptBounds(const ShapeSweep& sweep, float margin)
+    {
+        XMFLOAT2 extents = sweep.shape.GetAABBExtents();
+        XMFLOAT2 start = sweep.shape.center;
+        XMFLOAT2 end = { start.x + sweep.translation.x, start.y + sweep.translation.y };
+        float expand = fabsf(sweep.rotation) * sweep.GetRotationReach() + margin;
+
+        return AABB((std::min)(start.x, end.x) - extents.x - expand, (std::min)(start.y, end.y) - extents.y - expand,
+                    (std::max)(start.x, end.x) + extents.x + expand, (std::max)(start.y, end.y) + extents.y + expand);
+    }
+}
+
 PhysicsSystem::ColliderPair PhysicsSystem::MakeSortedPair(BaseCollider* colliderA, BaseCollider* colliderB)
 {
     ColliderPair pairKey;
 
-    if (colliderA < colliderB)
+    if (colliderA->colliderId < colliderB->colliderId)
     {
         pairKey.firstCollider = colliderA;
         pairKey.secondCollider = colliderB;
@@ -39,741 +75,2158 @@ PhysicsSystem::ColliderPair PhysicsSystem::MakeSortedPair(BaseCollider* collider
         pairKey.secondCollider = colliderA;
     }
 
+    pairKey.key = (static_cast<uint64_t>(pairKey.firstCollider->colliderId) << 32) | pairKey.secondCollider->colliderId;
     return pairKey;
 }
 
-void PhysicsSystem::Clear()
+bool PhysicsSystem::CanCollide(const BaseCollider* colliderA, const BaseCollider* colliderB)
 {
-    previousCollisionPairs.clear();
-    if (quadtree)
-        quadtree->Clear();
+    return (colliderA->pairMask & colliderB->GetLayerBit()) && (colliderB->pairMask & colliderA->GetLayerBit());
 }
 
-void PhysicsSystem::UpdateRigidbodies(const std::vector<GameObject*>& gameObjects, float deltaTime)
+// ========== 충돌 레이어 ==========
+
+void PhysicsSystem::SetLayerCollision(int layerA, int layerB, bool collide)
 {
-    //  Rigidbody  Ʈ (߷, ӵ, ġ)
-    for (GameObject* gameObject : gameObjects)
-    {
-        if (gameObject == nullptr)
-            continue;
+    if (layerA < 0 || layerA >= MaxLayers || layerB < 0 || layerB >= MaxLayers)
+        return;
 
-        const auto& components = gameObject->GetComponents();
-        for (Component* component : components)
-        {
-            Rigidbody2D* rb = dynamic_cast<Rigidbody2D*>(component);
-            if (rb && rb->IsEnabled())
-            {
-                rb->PhysicsUpdate(deltaTime);
-            }
-        }
+    if (collide)
+    {
+        layerCollisionMatrix[layerA] |= 1u << layerB;
+        layerCollisionMatrix[layerB] |= 1u << layerA;
+    }
+    else
+    {
+        layerCollisionMatrix[layerA] &= ~(1u << layerB);
+        layerCollisionMatrix[layerB] &= ~(1u << layerA);
     }
 }
 
-void PhysicsSystem::Step(const std::vector<GameObject*>& gameObjects, float deltaTime)
+bool PhysicsSystem::GetLayerCollision(int layerA, int layerB) const
 {
-    // 1) Rigidbody  Ʈ (߷, ӵ, ġ)
-    UpdateRigidbodies(gameObjects, deltaTime);
-
-    // 2) ̹  Ȱȭ ݶ̴ 
-    std::vector<BaseCollider*> colliders;
-    colliders.reserve(128);
-
-    for (GameObject* gameObject : gameObjects)
-    {
-        if (gameObject == nullptr)
-            continue;
+    if (layerA < 0 || layerA >= MaxLayers || layerB < 0 || layerB >= MaxLayers)
+        return false;
 
-        const auto& components = gameObject->GetComponents();
-        for (Component* component : components)
-        {
-            BaseCollider* collider = dynamic_cast<BaseCollider*>(component);
-            if (collider == nullptr)
-                continue;
+    return (layerCollisionMatrix[layerA] & (1u << layerB)) != 0;
+}
 
-            if (!collider->IsEnabled())
-                continue;
+void PhysicsSystem::SetLayerCollisionMask(int layer, uint32_t mask)
+{
+    if (layer < 0 || layer >= MaxLayers)
+        return;
 
-            colliders.push_back(collider);
-        }
+    for (int other = 0; other < MaxLayers; other++)
+    {
+        SetLayerCollision(layer, other, (mask & (1u << other)) != 0);
     }
+}
 
-    // 3)  ӿ ϴ ݶ̴  ( ݶ̴ ȣ)
-    std::unordered_set<BaseCollider*> currentColliderSet;
-    currentColliderSet.reserve(colliders.size() * 2);
-    for (BaseCollider* collider : colliders)
-        currentColliderSet.insert(collider);
+uint32_t PhysicsSystem::GetLayerCollisionMask(int layer) const
+{
+    if (layer < 0 || layer >= MaxLayers)
+        return 0;
+
+    return layerCollisionMatrix[layer];
+}
 
-    // 4) 浹 ˻  
-    if (useQuadtree && colliders.size() > 10)
+void PhysicsSystem::Clear()
+{
+    // 등록 해제 (GameObject는 아직 살아 있음 - 씬 OnExit에서 삭제 전에 호출)
+    for (GameObject* gameObject : registeredObjects)
     {
-        // Quadtree  (Ʈ   ȿ)
-        CheckCollisionsWithQuadtree(colliders);
+        gameObject->SetPhysicsWorld(nullptr);
     }
-    else
+    registeredObjects.clear();
+
+    while (bodies.GetCount() > 0)
     {
-        // Brute Force (Ʈ  )
-        CheckCollisionsBruteForce(colliders);
+        UnregisterBody(bodies.owners.back());
     }
 
-    // 5) 浹 ̺Ʈ ߻ (̺Ʈ  )
-    std::unordered_set<ColliderPair, ColliderPairHasher> currentCollisionPairs;
-    currentCollisionPairs.reserve(colliders.size() * 2);
-
-    for (size_t firstColliderIndex = 0; firstColliderIndex < colliders.size(); firstColliderIndex++)
+    while (!registeredColliders.empty())
     {
-        BaseCollider* firstCollider = colliders[firstColliderIndex];
+        UnregisterCollider(registeredColliders.back());
+    }
 
-        for (size_t secondColliderIndex = firstColliderIndex + 1; secondColliderIndex < colliders.size(); secondColliderIndex++)
-        {
-            BaseCollider* secondCollider = colliders[secondColliderIndex];
+    colliders.clear();
+    staticColliders.clear();
+    candidatePairs.clear();
+    triggerPairs.clear();
+    rebuildSleepingContacts = false;
+    currentCollisionPairs.clear();
+    previousCollisionPairs.clear();
+    contactEvents.clear();
+    if (quadtree)
+        quadtree->Clear();
 
-            if (firstCollider == nullptr || secondCollider == nullptr)
-                continue;
+    contactSolver.Clear();
+    narrowphaseBuffers.clear();
+    islands.Clear();
+    sleepingBodyCount = 0;
+    queryColliders.clear();
+    queryTreeDirty = true;
+    dynamicTree.Clear();
+    treeProxies.clear();
+    staticTree.Clear();
+    sweepAndPrune.Clear();
+    spatialHash.Clear();
+    profiler.Clear();
+
+    // 다시 등록하면 새 월드와 같은 ID (같은 순서로 등록하면 같은 결과)
+    nextColliderId = 1;
+    collidersById.assign(1, nullptr);
+    registryVersion = 0;
+}
 
-            if (!firstCollider->IsEnabled() || !secondCollider->IsEnabled())
-                continue;
+// ========== 등록 ==========
 
-            // 浹 ˻
-            if (!firstCollider->Intersects(secondCollider))
-                continue;
+void PhysicsSystem::AddGameObject(GameObject* gameObject)
+{
+    if (gameObject == nullptr || gameObject->GetPhysicsWorld() == this)
+        return;
 
-            ColliderPair pairKey = MakeSortedPair(firstCollider, secondCollider);
-            currentCollisionPairs.insert(pairKey);
+    // 다른 월드에 등록되어 있으면 먼저 해제
+    if (gameObject->GetPhysicsWorld())
+        gameObject->GetPhysicsWorld()->RemoveGameObject(gameObject);
 
-            // Enter vs Stay 
-            bool wasCollidingBefore = (previousCollisionPairs.find(pairKey) != previousCollisionPairs.end());
-            if (!wasCollidingBefore)
-            {
-                NotifyEnter(firstCollider, secondCollider);
-            }
-            else
-            {
-                NotifyStay(firstCollider, secondCollider);
-            }
-        }
-    }
+    gameObject->SetPhysicsWorld(this);
+    registeredObjects.push_back(gameObject);
 
-    // 6) Exit :  浹ߴµ ̹  
-    for (const ColliderPair& previousPair : previousCollisionPairs)
+    for (Component* component : gameObject->GetComponents())
     {
-        bool stillColliding = (currentCollisionPairs.find(previousPair) != currentCollisionPairs.end());
-        if (stillColliding)
-            continue;
-
-        // ݶ̴  ʾ  Exit ̺Ʈ ߻
-        bool firstAlive = (currentColliderSet.find(previousPair.firstCollider) != currentColliderSet.end());
-        bool secondAlive = (currentColliderSet.find(previousPair.secondCollider) != currentColliderSet.end());
-
-        if (!firstAlive || !secondAlive)
-            continue;
-
-        NotifyExit(previousPair.firstCollider, previousPair.secondCollider);
+        RegisterComponent(component);
     }
-
-    previousCollisionPairs = std::move(currentCollisionPairs);
 }
 
-void PhysicsSystem::CheckCollisionsBruteForce(const std::vector<BaseCollider*>& colliders)
+void PhysicsSystem::RemoveGameObject(GameObject* gameObject)
 {
-    //  :   ˻ O(N^2)
-    const int iterationCount = 4;
-    
-    for (int iteration = 0; iteration < iterationCount; iteration++)
-    {
-        for (size_t i = 0; i < colliders.size(); i++)
-        {
-            for (size_t j = i + 1; j < colliders.size(); j++)
-            {
-                BaseCollider* firstCollider = colliders[i];
-                BaseCollider* secondCollider = colliders[j];
-
-                if (!firstCollider || !secondCollider)
-                    continue;
+    if (gameObject == nullptr || gameObject->GetPhysicsWorld() != this)
+        return;
 
-                if (!firstCollider->IsEnabled() || !secondCollider->IsEnabled())
-                    continue;
+    for (Component* component : gameObject->GetComponents())
+    {
+        UnregisterComponent(component);
+    }
 
-                if (!firstCollider->Intersects(secondCollider))
-                    continue;
+    gameObject->SetPhysicsWorld(nullptr);
 
-                // Trigger  ݹ ŵ
-                bool isTrigger = firstCollider->IsTrigger() || secondCollider->IsTrigger();
-                if (!isTrigger)
-                {
-                    ResolveCollision(firstCollider, secondCollider);
-                }
-            }
-        }
+    auto it = std::find(registeredObjects.begin(), registeredObjects.end(), gameObject);
+    if (it != registeredObjects.end())
+    {
+        *it = registeredObjects.back();
+        registeredObjects.pop_back();
     }
 }
 
-void PhysicsSystem::CheckCollisionsWithQuadtree(const std::vector<BaseCollider*>& colliders)
+void PhysicsSystem::RegisterComponent(Component* component)
 {
-    // Quadtree :  ͵鳢 ˻ O(N log N)
-    
-    // 1. Quadtree 籸
-    if (quadtree)
-        quadtree->Clear();
-    
-    for (BaseCollider* collider : colliders)
+    // 타입 판별은 등록 시 한 번만
+    if (Rigidbody2D* body = dynamic_cast<Rigidbody2D*>(component))
     {
-        if (quadtree)
-            quadtree->Insert(collider);
+        RegisterBody(body);
     }
-
-    // 2.  ݶ̴ ó ͵鸸 ˻
-    const int iterationCount = 4;
-    
-    for (int iteration = 0; iteration < iterationCount; iteration++)
+    else if (BaseCollider* collider = dynamic_cast<BaseCollider*>(component))
     {
-        for (BaseCollider* collider : colliders)
-        {
-            if (!collider || !collider->IsEnabled())
-                continue;
-
-            // ó ݶ̴  (Quadtree )
-            std::vector<BaseCollider*> nearby;
-            if (quadtree)
-                nearby = quadtree->QueryNearby(collider);
-
-            // ó ͵ϰ 浹 ˻
-            for (BaseCollider* other : nearby)
-            {
-                if (collider == other)
-                    continue;
-
-                if (!other->IsEnabled())
-                    continue;
-
-                // ߺ ˻  ( )
-                if (collider > other)
-                    continue;
-
-                if (!collider->Intersects(other))
-                    continue;
-
-                // Trigger  ݹ ŵ
-                bool isTrigger = collider->IsTrigger() || other->IsTrigger();
-                if (!isTrigger)
-                {
-                    ResolveCollision(collider, other);
-                }
-            }
-        }
+        RegisterCollider(collider);
+    }
+    else if (TilemapCollider* tilemap = dynamic_cast<TilemapCollider*>(component))
+    {
+        // 타일맵이 만든 박스는 컴포넌트 목록 밖에 있으므로 직접 등록
+        for (BoxCollider2D* box : tilemap->GetColliders())
+            RegisterCollider(box);
     }
 }
 
-void PhysicsSystem::NotifyEnter(BaseCollider* colliderA, BaseCollider* colliderB)
+void PhysicsSystem::UnregisterComponent(Component* component)
 {
-    if (colliderA == nullptr || colliderB == nullptr)
-        return;
-
-    // Unity Ÿ: ϳ Trigger OnTrigger ȣ
-    bool isTriggerEvent = colliderA->IsTrigger() || colliderB->IsTrigger();
-    
-    if (isTriggerEvent)
+    if (Rigidbody2D* body = dynamic_cast<Rigidbody2D*>(component))
     {
-        // OnTrigger:   X,  O,  
-        colliderA->NotifyTriggerEnter(colliderB);
-        colliderB->NotifyTriggerEnter(colliderA);
+        UnregisterBody(body);
     }
-    else
+    else if (BaseCollider* collider = dynamic_cast<BaseCollider*>(component))
     {
-        // OnCollision:   O,  X
-        colliderA->NotifyCollisionEnter(colliderB);
-        colliderB->NotifyCollisionEnter(colliderA);
+        UnregisterCollider(collider);
+    }
+    else if (TilemapCollider* tilemap = dynamic_cast<TilemapCollider*>(component))
+    {
+        for (BoxCollider2D* box : tilemap->GetColliders())
+            UnregisterCollider(box);
     }
 }
 
-void PhysicsSystem::NotifyStay(BaseCollider* colliderA, BaseCollider* colliderB)
+void PhysicsSystem::RegisterBody(Rigidbody2D* body)
 {
-    if (colliderA == nullptr || colliderB == nullptr)
+    if (body == nullptr || body->world != nullptr || body->GetGameObject() == nullptr)
         return;
 
-    bool isTriggerEvent = colliderA->IsTrigger() || colliderB->IsTrigger();
-    
-    if (isTriggerEvent)
-    {
-        colliderA->NotifyTriggerStay(colliderB);
-        colliderB->NotifyTriggerStay(colliderA);
-    }
-    else
+    // 미등록 상태 값을 SoA로 이동
+    int index = bodies.Add(body);
+    body->world = this;
+    body->bodyIndex = index;
+    registryVersion++;
+
+    bodies.velocityX[index] = body->velocity.x;
+    bodies.velocityY[index] = body->velocity.y;
+    bodies.angularVelocity[index] = body->angularVelocity;
+    bodies.forceX[index] = body->forceAccumulator.x;
+    bodies.forceY[index] = body->forceAccumulator.y;
+    bodies.torque[index] = body->torque;
+    bodies.previousX[index] = body->previousPosition.x;
+    bodies.previousY[index] = body->previousPosition.y;
+
+    // 같은 GameObject의 콜라이더에 연결
+    for (Component* component : body->GetGameObject()->GetComponents())
     {
-        colliderA->NotifyCollisionStay(colliderB);
-        colliderB->NotifyCollisionStay(colliderA);
+        BaseCollider* collider = dynamic_cast<BaseCollider*>(component);
+        if (collider && collider->registryIndex >= 0 && collider->attachedBody == nullptr)
+            collider->attachedBody = body;
     }
 }
 
-void PhysicsSystem::NotifyExit(BaseCollider* colliderA, BaseCollider* colliderB)
+void PhysicsSystem::UnregisterBody(Rigidbody2D* body)
 {
-    if (colliderA == nullptr || colliderB == nullptr)
+    if (body == nullptr || body->world != this)
         return;
 
-    bool isTriggerEvent = colliderA->IsTrigger() || colliderB->IsTrigger();
-    
-    if (isTriggerEvent)
-    {
-        colliderA->NotifyTriggerExit(colliderB);
-        colliderB->NotifyTriggerExit(colliderA);
-    }
-    else
+    // SoA 값을 컴포넌트로 되돌림 (다시 등록될 때 이어서 사용)
+    int index = body->bodyIndex;
+    body->velocity = { bodies.velocityX[index], bodies.velocityY[index] };
+    body->angularVelocity = bodies.angularVelocity[index];
+    body->forceAccumulator = { bodies.forceX[index], bodies.forceY[index] };
+    body->torque = bodies.torque[index];
+    body->previousPosition = { bodies.previousX[index], bodies.previousY[index] };
+
+    bodies.Remove(index);
+    body->world = nullptr;
+    body->bodyIndex = -1;
+    registryVersion++;
+
+    if (body->GetGameObject() == nullptr)
+        return;
+
+    for (Component* component : body->GetGameObject()->GetComponents())
     {
-        colliderA->NotifyCollisionExit(colliderB);
-        colliderB->NotifyCollisionExit(colliderA);
+        BaseCollider* collider = dynamic_cast<BaseCollider*>(component);
+        if (collider && collider->attachedBody == body)
+            collider->attachedBody = nullptr;
     }
 }
 
-void PhysicsSystem::ResolveCollision(BaseCollider* colliderA, BaseCollider* colliderB)
+void PhysicsSystem::RegisterCollider(BaseCollider* collider)
 {
-    if (!colliderA || !colliderB)
+    if (collider == nullptr || collider->registryIndex >= 0 || collider->GetGameObject() == nullptr)
         return;
 
-    GameObject* objA = colliderA->GetGameObject();
-    GameObject* objB = colliderB->GetGameObject();
-
-    if (!objA || !objB)
-        return;
+    collider->registryIndex = static_cast<int>(registeredColliders.size());
+    collider->colliderId = nextColliderId++;
+    registeredColliders.push_back(collider);
+    collidersById.push_back(collider);
+    registryVersion++;
+    queryTreeDirty = true;
 
-    Rigidbody2D* rbA = objA->GetComponent<Rigidbody2D>();
-    Rigidbody2D* rbB = objB->GetComponent<Rigidbody2D>();
+    // 같은 GameObject의 등록된 Rigidbody2D 연결
+    collider->attachedBody = nullptr;
+    for (Component* component : collider->GetGameObject()->GetComponents())
+    {
+        Rigidbody2D* body = dynamic_cast<Rigidbody2D*>(component);
+        if (body && body->world == this)
+        {
+            collider->attachedBody = body;
+            break;
+        }
+    }
+}
 
-    //   Rigidbody ų   Kinematic̸  ݹ 
-    if (!rbA && !rbB)
+void PhysicsSystem::UnregisterCollider(BaseCollider* collider)
+{
+    if (collider == nullptr || collider->registryIndex < 0)
         return;
 
-    if (rbA && rbA->isKinematic && rbB && rbB->isKinematic)
-        return;
+    // 마지막 원소와 교환 후 제거
+    int index = collider->registryIndex;
+    BaseCollider* last = registeredColliders.back();
+    registeredColliders[index] = last;
+    last->registryIndex = index;
+    registeredColliders.pop_back();
+
+    collidersById[collider->colliderId] = nullptr;
+    collider->registryIndex = -1;
+    collider->colliderId = 0;
+    collider->attachedBody = nullptr;
+    registryVersion++;
+
+    // 이벤트 전달 중이면 남은 이벤트에서 제외 (콜백이 GameObject/컴포넌트를 삭제한 경우)
+    if (dispatchingEvents)
+        removedDuringDispatch.push_back(collider);
+
+    // 쿼리/브로드페이즈 트리에서 즉시 제거 (삭제된 콜라이더를 쿼리가 반환하지 않도록)
+    auto proxy = treeProxies.find(collider);
+    if (proxy != treeProxies.end())
+    {
+        dynamicTree.DestroyProxy(proxy->second.proxyId);
+        treeProxies.erase(proxy);
+    }
 
-    // 浹    Penetration 
-    XMFLOAT2 posA = objA->transform.GetPosition();
-    XMFLOAT2 posB = objB->transform.GetPosition();
+    RemoveStaticProxy(collider);
+}
 
-    XMFLOAT2 normal;
-    normal.x = posB.x - posA.x;
-    normal.y = posB.y - posA.y;
+// ========== 강체 적분 ==========
 
-    float length = sqrtf(normal.x * normal.x + normal.y * normal.y);
-    if (length > 0.001f)
-    {
-        normal.x /= length;
-        normal.y /= length;
-    }
-    else
-    {
-        normal = {0.0f, 1.0f};
-    }
+void PhysicsSystem::SyncBodies()
+{
+    // 인스펙터/스크립트가 바꾼 설정과 Transform을 SoA로 복사
+    const int count = bodies.GetCount();
 
-    float penetration = 0.0f;
-    XMFLOAT2 contactPoint = {0, 0};  //  (ȸ )
-    
-    BoxCollider2D* boxA = dynamic_cast<BoxCollider2D*>(colliderA);
-    BoxCollider2D* boxB = dynamic_cast<BoxCollider2D*>(colliderB);
-    CircleCollider* circleA = dynamic_cast<CircleCollider*>(colliderA);
-    CircleCollider* circleB = dynamic_cast<CircleCollider*>(colliderB);
-    
-    // Box vs Box
-    if (boxA && boxB)
-    {
-        XMFLOAT2 scaleA = objA->transform.GetScale();
-        XMFLOAT2 scaleB = objB->transform.GetScale();
-        
-        float halfWidthA = boxA->halfSize.x * scaleA.x;
-        float halfHeightA = boxA->halfSize.y * scaleA.y;
-        float halfWidthB = boxB->halfSize.x * scaleB.x;
-        float halfHeightB = boxB->halfSize.y * scaleB.y;
-        
-        float dx = fabsf(posB.x - posA.x);
-        float dy = fabsf(posB.y - posA.y);
-        
-        float overlapX = (halfWidthA + halfWidthB) - dx;
-        float overlapY = (halfHeightA + halfHeightB) - dy;
-        
-        if (overlapX < overlapY)
-        {
-            penetration = overlapX;
-            normal = (posB.x > posA.x) ? XMFLOAT2{1.0f, 0.0f} : XMFLOAT2{-1.0f, 0.0f};
-            contactPoint.x = (posA.x + posB.x) * 0.5f;
-            contactPoint.y = posA.y;
-        }
-        else
-        {
-            penetration = overlapY;
-            normal = (posB.y > posA.y) ? XMFLOAT2{0.0f, 1.0f} : XMFLOAT2{0.0f, -1.0f};
-            contactPoint.x = posA.x;
-            contactPoint.y = (posA.y + posB.y) * 0.5f;
-        }
-    }
-    // Circle vs Circle
-    else if (circleA && circleB)
-    {
-        XMFLOAT2 scaleA = objA->transform.GetScale();
-        XMFLOAT2 scaleB = objB->transform.GetScale();
-        
-        float radiusA = circleA->radius * (std::max)(scaleA.x, scaleA.y);
-        float radiusB = circleB->radius * (std::max)(scaleB.x, scaleB.y);
-        
-        float distance = sqrtf((posB.x - posA.x) * (posB.x - posA.x) + 
-                               (posB.y - posA.y) * (posB.y - posA.y));
-        
-        penetration = (radiusA + radiusB) - distance;
-        
-        // : A ǥ
-        contactPoint.x = posA.x + normal.x * radiusA;
-        contactPoint.y = posA.y + normal.y * radiusA;
-    }
-    // Circle vs Box
-    else
+    for (int i = 0; i < count; i++)
     {
-        CircleCollider* circle = circleA ? circleA : circleB;
-        BoxCollider2D* box = boxA ? boxA : boxB;
-        GameObject* circleObj = circle == circleA ? objA : objB;
-        GameObject* boxObj = box == boxA ? objA : objB;
-        bool circleIsA = (circle == circleA);
-        
-        XMFLOAT2 circlePos = circleObj->transform.GetPosition();
-        XMFLOAT2 boxPos = boxObj->transform.GetPosition();
-        XMFLOAT2 circleScale = circleObj->transform.GetScale();
-        XMFLOAT2 boxScale = boxObj->transform.GetScale();
-        
-        float radius = circle->radius * (std::max)(circleScale.x, circleScale.y);
-        float halfWidth = box->halfSize.x * boxScale.x;
-        float halfHeight = box->halfSize.y * boxScale.y;
-        
-        float relX = circlePos.x - boxPos.x;
-        float relY = circlePos.y - boxPos.y;
-        
-        float closestX = (std::max)(-halfWidth, (std::min)(relX, halfWidth));
-        float closestY = (std::max)(-halfHeight, (std::min)(relY, halfHeight));
-        
-        float dx = relX - closestX;
-        float dy = relY - closestY;
-        float distSqr = dx * dx + dy * dy;
-        
-        if (distSqr > 0.0001f)
-        {
-            float distance = sqrtf(distSqr);
-            penetration = radius - distance;
-            normal.x = dx / distance;
-            normal.y = dy / distance;
-            
-            // : Box ǥ   
-            contactPoint.x = boxPos.x + closestX;
-            contactPoint.y = boxPos.y + closestY;
-        }
-        else
-        {
-            float dLeft = relX - (-halfWidth);
-            float dRight = halfWidth - relX;
-            float dBottom = relY - (-halfHeight);
-            float dTop = halfHeight - relY;
-            
-            float minD = dLeft;
-            int axis = 0;
-            
-            if (dRight < minD) { minD = dRight; axis = 1; }
-            if (dBottom < minD) { minD = dBottom; axis = 2; }
-            if (dTop < minD) { minD = dTop; axis = 3; }
-            
-            if (axis == 0) { normal = {-1.0f, 0.0f}; contactPoint = {boxPos.x - halfWidth, circlePos.y}; }
-            else if (axis == 1) { normal = {1.0f, 0.0f}; contactPoint = {boxPos.x + halfWidth, circlePos.y}; }
-            else if (axis == 2) { normal = {0.0f, -1.0f}; contactPoint = {circlePos.x, boxPos.y - halfHeight}; }
-            else if (axis == 3) { normal = {0.0f, 1.0f}; contactPoint = {circlePos.x, boxPos.y + halfHeight}; }
-            
-            penetration = minD + radius;
-        }
-        
-        if (circleIsA)
+        const Rigidbody2D* body = bodies.owners[i];
+        const Transform& transform = *bodies.transforms[i];
+
+        uint32_t flags = 0;
+        if (body->IsEnabled())      flags |= BodyFlag_Active;
+        if (body->isKinematic)      flags |= BodyFlag_Kinematic;
+        if (body->useGravity)       flags |= BodyFlag_UseGravity;
+        if (body->freezePositionX)  flags |= BodyFlag_FreezePositionX;
+        if (body->freezePositionY)  flags |= BodyFlag_FreezePositionY;
+        if (body->freezeRotation)   flags |= BodyFlag_FreezeRotation;
+        if (body->useCCD)           flags |= BodyFlag_UseCCD;
+
+        // 수면 상태 유지 (비활성/Kinematic 전환 또는 Transform 직접 변경 시 깨움)
+        XMFLOAT2 position = transform.GetPosition();
+        float rotation = transform.GetRotation();
+
+        if (bodies.IsSleeping(i))
         {
-            normal.x = -normal.x;
-            normal.y = -normal.y;
-        }
-    }
+            bool moved = position.x != bodies.positionX[i] || position.y != bodies.positionY[i] ||
+                         rotation != bodies.rotation[i];
 
-    //   ü ߽ɱ  (ȸ)
-    XMFLOAT2 rA = {contactPoint.x - posA.x, contactPoint.y - posA.y};
-    XMFLOAT2 rB = {contactPoint.x - posB.x, contactPoint.y - posB.y};
-
-    //  ӵ  (ȸ )
-    XMFLOAT2 velA = rbA ? rbA->GetVelocity() : XMFLOAT2{0, 0};
-    XMFLOAT2 velB = rbB ? rbB->GetVelocity() : XMFLOAT2{0, 0};
-    float angVelA = rbA ? rbA->angularVelocity : 0.0f;
-    float angVelB = rbB ? rbB->angularVelocity : 0.0f;
+            if (allowSleeping && !moved && (flags & BodyFlag_Active) && !(flags & BodyFlag_Kinematic))
+                flags |= BodyFlag_Sleeping;
+            else
+                bodies.sleepTime[i] = 0.0f;
+        }
 
-    //  ӵ (ӵ + ȸӵ)
-    XMFLOAT2 vA = {velA.x - angVelA * rA.y, velA.y + angVelA * rA.x};
-    XMFLOAT2 vB = {velB.x - angVelB * rB.y, velB.y + angVelB * rB.x};
+        bodies.flags[i] = flags;
+        bodies.inverseMass[i] = (body->mass > 0.0f && !body->isKinematic) ? 1.0f / body->mass : 0.0f;
+        bodies.gravityScale[i] = body->gravityScale;
+        bodies.drag[i] = body->drag;
+        bodies.angularDrag[i] = body->angularDrag;
 
-    XMFLOAT2 relativeVelocity = {vB.x - vA.x, vB.y - vA.y};
-    float velocityAlongNormal = relativeVelocity.x * normal.x + relativeVelocity.y * normal.y;
+        bodies.positionX[i] = position.x;
+        bodies.positionY[i] = position.y;
+        bodies.rotation[i] = rotation;
+    }
+}
 
-    if (velocityAlongNormal > 0)
-        return;
+IntegrationSettings PhysicsSystem::MakeIntegrationSettings(float deltaTime) const
+{
+    IntegrationSettings settings;
+    settings.deltaTime = deltaTime;
+    settings.gravity = gravity;
+    settings.maxVelocity = maxVelocity;
+    return settings;
+}
 
-    // ݹ 
-    float restitution = 0.0f;
-    if (rbA) restitution = (restitution + rbA->restitution) * 0.5f;
-    if (rbB) restitution = (restitution + rbB->restitution) * 0.5f;
+void PhysicsSystem::WriteBackBodies()
+{
+    const int count = bodies.GetCount();
 
-    //  Ʈ (Circle: I = 0.5 * m * r^2, Box  ٻ)
-    float inertiaA = 0.0f;
-    float inertiaB = 0.0f;
-    
-    if (rbA && !rbA->isKinematic)
+    for (int i = 0; i < count; i++)
     {
-        if (circleA)
+        const Rigidbody2D* body = bodies.owners[i];
+        Transform& transform = *bodies.transforms[i];
+
+        // 움직이지 않은 강체는 보간하지 않음 (이전 스텝 보간이 남아 있으면 멈춘 뒤에도 흔들림)
+        uint32_t flags = bodies.flags[i];
+        if (!(flags & BodyFlag_Active) || (flags & (BodyFlag_Kinematic | BodyFlag_Sleeping)))
         {
-            float r = circleA->radius * (std::max)(objA->transform.GetScale().x, objA->transform.GetScale().y);
-            inertiaA = 0.5f * rbA->mass * r * r;
+            transform.ClearInterpolation();
+            continue;
         }
+
+        // 렌더 보간 시작 자세 = 기록 전 Transform (스텝 시작 시 SyncBodies가 읽은 자세)
+        XMFLOAT2 previousPosition = transform.GetPosition();
+        float previousRotation = transform.GetRotation();
+
+        transform.SetPosition(bodies.positionX[i], bodies.positionY[i]);
+        transform.SetRotation(bodies.rotation[i]);
+
+        if (body->interpolate)
+            transform.SetInterpolationStart(previousPosition, previousRotation);
         else
-        {
-            inertiaA = rbA->mass * 100.0f;  // Box ٻ簪
-        }
+            transform.ClearInterpolation();
     }
-    
-    if (rbB && !rbB->isKinematic)
+}
+
+void PhysicsSystem::Step(float deltaTime)
+{
+    profilingStep = profileSteps;
+    if (profilingStep)
+        profiler.BeginStep();
+
+    // 1) Rigidbody 속도 적분 (SoA 배열 순회, 위치는 솔버 이후)
+    SyncBodies();
+    IntegrationSettings integration = MakeIntegrationSettings(deltaTime);
+    BodyIntegrator::IntegrateVelocities(bodies, integration, useSIMDIntegration);
+    ProfileMark(PhysicsPhase::Integrate);
+
+    // 2) 이번 프레임 활성화된 콜라이더 수집 (등록 목록에서) + 레이어 필터 마스크 계산
+    //    월드 형태 캐시도 여기서 갱신 (Transform이 바뀐 콜라이더만, 이후 워커 스레드는 읽기만 함)
+    //    정적 콜라이더는 정적 트리로 (추가/이동한 것만 트리 변경)
+    colliders.clear();
+    staticColliders.clear();
+
+    for (BaseCollider* collider : registeredColliders)
     {
-        if (circleB)
+        if (collider->IsEnabled())
         {
-            float r = circleB->radius * (std::max)(objB->transform.GetScale().x, objB->transform.GetScale().y);
-            inertiaB = 0.5f * rbB->mass * r * r;
-        }
-        else
-        {
-            inertiaB = rbB->mass * 100.0f;
+            collider->pairMask = collider->collisionMask & layerCollisionMatrix[collider->layer];
+            collider->GetWorldShape();
+
+            if (IsStaticCollider(collider))
+                staticColliders.push_back(collider);
+            else
+                colliders.push_back(collider);
         }
+
+        UpdateStaticProxy(collider);
     }
 
-    float invMassA = (rbA && !rbA->isKinematic) ? 1.0f / rbA->mass : 0.0f;
-    float invMassB = (rbB && !rbB->isKinematic) ? 1.0f / rbB->mass : 0.0f;
-    float invInertiaA = (inertiaA > 0.0f) ? 1.0f / inertiaA : 0.0f;
-    float invInertiaB = (inertiaB > 0.0f) ? 1.0f / inertiaB : 0.0f;
+    ProfileMark(PhysicsPhase::Gather);
 
-    // Cross product for 2D: r x n
-    float rACrossN = rA.x * normal.y - rA.y * normal.x;
-    float rBCrossN = rB.x * normal.y - rB.y * normal.x;
+    // 3) 브로드페이즈: 동적 콜라이더끼리 후보 쌍 수집 (솔버와 이벤트가 공유)
+    if (broadphaseMode == BroadphaseMode::DynamicTree && colliders.size() > 10)
+    {
+        // Dynamic AABB Tree 사용 (스텝 간 트리 유지, 움직인 것만 재삽입)
+        GatherPairsWithDynamicTree();
+    }
+    else if (broadphaseMode == BroadphaseMode::SweepAndPrune && colliders.size() > 10)
+    {
+        // Sweep and Prune 사용 (끝점 정렬 유지, 한 축으로 퍼진 씬)
+        GatherPairsWithSweepAndPrune();
+    }
+    else if (broadphaseMode == BroadphaseMode::SpatialHash && colliders.size() > 10)
+    {
+        // Spatial Hash 사용 (월드 경계 없음, 작은 오브젝트 다수)
+        GatherPairsWithSpatialHash();
+    }
+    else if (broadphaseMode == BroadphaseMode::Quadtree && colliders.size() > 10)
+    {
+        // Quadtree 사용 (오브젝트 많을 때 효율적)
+        GatherPairsWithQuadtree();
+    }
+    else
+    {
+        // Brute Force (오브젝트 적을 때)
+        GatherPairsBruteForce();
+    }
 
-    float denominator = invMassA + invMassB + 
-                       rACrossN * rACrossN * invInertiaA + 
-                       rBCrossN * rBCrossN * invInertiaB;
+    // 동적 ↔ 정적 후보 쌍 (정적끼리는 검사하지 않음)
+    GatherStaticPairs();
+
+    // 정렬 + 중복 제거 (이후 접촉 쌍도 정렬된 상태로 생성됨)
+    // 트리거 쌍은 따로 떼어 솔버/매니폴드 경로를 거치지 않음
+    std::sort(candidatePairs.begin(), candidatePairs.end());
+    candidatePairs.erase(std::unique(candidatePairs.begin(), candidatePairs.end()), candidatePairs.end());
+    SplitTriggerPairs();
+    ProfileMark(PhysicsPhase::BroadphaseQuery);
+
+    // 4) 내로우페이즈 (워커 스레드 병렬), 트리거 겹침 판정 후 충돌 해결 (접촉 매니폴드 + Sequential Impulse)
+    RunNarrowphase();
+    ProfileMark(PhysicsPhase::Narrowphase);
+    UpdateTriggerOverlaps();
+    ProfileMark(PhysicsPhase::Triggers);
+    SolveContacts(deltaTime);
+    ProfileMark(PhysicsPhase::Solve);
+
+    // 5) 솔버가 고친 속도로 위치 적분, CCD 강체는 첫 충돌 시점까지 서브스텝
+    BodyIntegrator::IntegratePositions(bodies, integration, useSIMDIntegration);
+    ProfileMark(PhysicsPhase::Integrate);
+    SolveContinuous(deltaTime);
+    ProfileMark(PhysicsPhase::Continuous);
+
+    // 6) 충돌 이벤트 수집 (Enter/Stay/Exit, 후보 쌍과 같은 위치 기준 + CCD 충돌 쌍)
+    CollectContactEvents();
+    ProfileMark(PhysicsPhase::Events);
+
+    // 7) Transform에 기록
+    WriteBackBodies();
+    ProfileMark(PhysicsPhase::Integrate);
+
+    // 위치가 바뀌었으므로 다음 쿼리 전에 트리 갱신
+    queryTreeDirty = true;
+
+    // 8) 스텝이 끝난 상태에서 이벤트 전달 (콜백이 콜라이더/강체를 바꿔도 스텝 버퍼에 영향 없음)
+    DispatchContactEvents();
+    ProfileMark(PhysicsPhase::Events);
+
+    if (profilingStep)
+        CommitStepStats();
+}
 
-    float impulseScalar = -(1.0f + restitution) * velocityAlongNormal / denominator;
+void PhysicsSystem::CommitStepStats()
+{
+    // 이벤트 콜백이 Clear를 호출했으면 카운터는 비워진 월드 기준
+    PhysicsStepStats& stats = profiler.EndStep();
+    stats.bodyCount = bodies.GetCount();
+    stats.colliderCount = static_cast<int>(colliders.size());
+    stats.staticColliderCount = static_cast<int>(staticColliders.size());
+    stats.candidatePairCount = static_cast<int>(candidatePairs.size());
+    stats.triggerPairCount = static_cast<int>(triggerPairs.size());
+    stats.contactCount = static_cast<int>(currentCollisionPairs.size());
+    stats.eventCount = static_cast<int>(contactEvents.size());
+    stats.ccdHitCount = ccdHitCount;
+    stats.sleepingBodyCount = sleepingBodyCount;
+    stats.islandCount = islands.GetIslandCount();
+
+    // Quadtree는 이번 스텝에 재구축했을 때만 (다른 방식이면 지난 내용이 남아 있을 수 있음)
+    bool usedQuadtree = broadphaseMode == BroadphaseMode::Quadtree && colliders.size() > 10;
+    stats.quadtreeNodeCount = (usedQuadtree && quadtree) ? quadtree->GetNodeCount() : 0;
+
+    profiler.Commit();
+    profilingStep = false;
+}
 
-    XMFLOAT2 impulse = {impulseScalar * normal.x, impulseScalar * normal.y};
+void PhysicsSystem::GatherPairsBruteForce()
+{
+    // 단순 방식: 모든 쌍 O(N^2)
+    candidatePairs.clear();
 
-    //  ݷ  (A)
-    if (rbA && !rbA->isKinematic)
+    for (size_t i = 0; i < colliders.size(); i++)
     {
-        XMFLOAT2 newVel = rbA->GetVelocity();
-        newVel.x -= impulse.x * invMassA;
-        newVel.y -= impulse.y * invMassA;
-        rbA->SetVelocity(newVel);
-        
-        // ȸ freezeRotation false 
-        if (!rbA->freezeRotation)
+        for (size_t j = i + 1; j < colliders.size(); j++)
         {
-            rbA->angularVelocity -= rACrossN * impulseScalar * invInertiaA;
+            if (CanCollide(colliders[i], colliders[j]))
+                candidatePairs.push_back(MakeSortedPair(colliders[i], colliders[j]));
         }
     }
+}
 
-    //  ݷ  (B)
-    if (rbB && !rbB->isKinematic)
-    {
-        XMFLOAT2 newVel = rbB->GetVelocity();
-        newVel.x += impulse.x * invMassB;
-        newVel.y += impulse.y * invMassB;
-        rbB->SetVelocity(newVel);
-        
-        // ȸ freezeRotation false 
-        if (!rbB->freezeRotation)
-        {
-            rbB->angularVelocity += rBCrossN * impulseScalar * invInertiaB;
-        }
-    }
+void PhysicsSystem::GatherPairsWithQuadtree()
+{
+    // Quadtree 방식: 가까운 것들끼리만 O(N log N)
+    candidatePairs.clear();
 
-    //   ( )
-    XMFLOAT2 tangent = {-normal.y, normal.x};
-    float velocityAlongTangent = relativeVelocity.x * tangent.x + relativeVelocity.y * tangent.y;
+    // 1. Quadtree 재구축
+    if (!quadtree)
+        return;
 
-    float friction = 0.0f;
-    if (rbA) friction = (friction + rbA->friction) * 0.5f;
-    if (rbB) friction = (friction + rbB->friction) * 0.5f;
+    // 월드 크기가 바뀌었으면 영역 재설정 (PhysicsSystem 재생성 불필요)
+    if (worldWidth != quadtreeWidth || worldHeight != quadtreeHeight)
+    {
+        quadtree->Reset(AABB(
+            -worldWidth * 0.5f, -worldHeight * 0.5f,
+            worldWidth * 0.5f, worldHeight * 0.5f
+        ));
+        quadtreeWidth = worldWidth;
+        quadtreeHeight = worldHeight;
+    }
 
-    float frictionImpulseScalar = -velocityAlongTangent / denominator;
+    quadtree->Clear();
     
-    // Coulomb's Law: |ft| <=  * |fn|
-    if (fabsf(frictionImpulseScalar) > fabsf(impulseScalar) * friction)
+    for (BaseCollider* collider : colliders)
     {
-        frictionImpulseScalar = -fabsf(impulseScalar) * friction * (velocityAlongTangent < 0 ? -1.0f : 1.0f);
+        quadtree->Insert(collider);
     }
 
-    XMFLOAT2 frictionImpulse = {frictionImpulseScalar * tangent.x, frictionImpulseScalar * tangent.y};
+    ProfileMark(PhysicsPhase::BroadphaseBuild);
 
-    // A ü:  
-    if (rbA && !rbA->isKinematic)
+    // 2. 각 콜라이더마다 근처 것들만 후보로 추가
+    for (BaseCollider* collider : colliders)
     {
-        XMFLOAT2 newVel = rbA->GetVelocity();
-        newVel.x -= frictionImpulse.x * invMassA;
-        newVel.y -= frictionImpulse.y * invMassA;
-        rbA->SetVelocity(newVel);
-        
-        // ȸ freezeRotation false 
-        if (!rbA->freezeRotation)
+        queryResults.clear();
+        quadtree->QueryNearby(collider, queryResults);
+
+        for (BaseCollider* other : queryResults)
         {
-            float rACrossFriction = rA.x * tangent.y - rA.y * tangent.x;
-            rbA->angularVelocity -= rACrossFriction * frictionImpulseScalar * invInertiaA;
+            // 중복 방지 (콜라이더 ID 순서, 정렬 후 unique로 한 번 더 제거)
+            if (collider == other || other->colliderId < collider->colliderId || !CanCollide(collider, other))
+                continue;
+
+            candidatePairs.push_back(MakeSortedPair(collider, other));
         }
     }
+}
+
+void PhysicsSystem::UpdateDynamicTree(const std::vector<BaseCollider*>& activeColliders)
+{
+    stepCount++;
 
-    // B ü:  
-    if (rbB && !rbB->isKinematic)
+    for (BaseCollider* collider : activeColliders)
     {
-        XMFLOAT2 newVel = rbB->GetVelocity();
-        newVel.x += frictionImpulse.x * invMassB;
-        newVel.y += frictionImpulse.y * invMassB;
-        rbB->SetVelocity(newVel);
-        
-        // ȸ freezeRotation false 
-        if (!rbB->freezeRotation)
+        AABB aabb = ComputeColliderAABB(collider);
+        XMFLOAT2 center = aabb.GetCenter();
+
+        auto it = treeProxies.find(collider);
+        if (it == treeProxies.end())
         {
-            float rBCrossFriction = rB.x * tangent.y - rB.y * tangent.x;
-            rbB->angularVelocity += rBCrossFriction * frictionImpulseScalar * invInertiaB;
+            // 새 콜라이더 → 프록시 생성
+            TreeProxy proxy;
+            proxy.proxyId = dynamicTree.CreateProxy(aabb, collider);
+            proxy.stamp = stepCount;
+            proxy.center = center;
+            treeProxies.emplace(collider, proxy);
+            continue;
         }
+
+        // 기존 콜라이더 → Fat AABB를 벗어났을 때만 재삽입
+        TreeProxy& proxy = it->second;
+        XMFLOAT2 displacement = { center.x - proxy.center.x, center.y - proxy.center.y };
+        dynamicTree.MoveProxy(proxy.proxyId, aabb, displacement);
+
+        proxy.stamp = stepCount;
+        proxy.center = center;
     }
 
-    // ġ 
-    const float percent = 0.8f;
-    const float slop = 0.01f;
-    
-    if (penetration > slop)
+    // 이번 스텝에 없는 콜라이더(삭제/비활성) 프록시 제거 (포인터는 역참조하지 않음)
+    // 해시 순회 순서는 주소마다 달라지므로 프록시 ID 순으로 제거 (트리 모양이 실행마다 같도록)
+    staleProxies.clear();
+    for (auto it = treeProxies.begin(); it != treeProxies.end();)
     {
-        XMFLOAT2 correction;
-        float correctionAmount = (penetration - slop) * percent / (invMassA + invMassB);
-        correction.x = correctionAmount * normal.x;
-        correction.y = correctionAmount * normal.y;
-
-        if (rbA && !rbA->isKinematic && invMassA > 0.0f)
+        if (it->second.stamp != stepCount)
         {
-            if (!rbA->freezePositionX || !rbA->freezePositionY)
-            {
-                XMFLOAT2 posA = objA->transform.GetPosition();
-                if (!rbA->freezePositionX) posA.x -= correction.x * invMassA;
-                if (!rbA->freezePositionY) posA.y -= correction.y * invMassA;
-                objA->transform.SetPosition(posA.x, posA.y);
-            }
+            staleProxies.push_back(it->second.proxyId);
+            it = treeProxies.erase(it);
         }
-
-        if (rbB && !rbB->isKinematic && invMassB > 0.0f)
+        else
         {
-            if (!rbB->freezePositionX || !rbB->freezePositionY)
-            {
-                XMFLOAT2 posB = objB->transform.GetPosition();
-                if (!rbB->freezePositionX) posB.x += correction.x * invMassB;
-                if (!rbB->freezePositionY) posB.y += correction.y * invMassB;
-                objB->transform.SetPosition(posB.x, posB.y);
-            }
+            ++it;
         }
     }
+
+    std::sort(staleProxies.begin(), staleProxies.end());
+    for (int proxyId : staleProxies)
+        dynamicTree.DestroyProxy(proxyId);
 }
 
-// CCD (Continuous Collision Detection) - Swept AABB 
-bool PhysicsSystem::CheckCCDCollision(
-    BaseCollider* moving,
-    BaseCollider* target,
-    const XMFLOAT2& oldPos,
-    const XMFLOAT2& newPos,
-    float& outTOI)
+bool PhysicsSystem::IsStaticCollider(const BaseCollider* collider)
 {
-    //  Swept AABB 
-    // ̵ () target AABB 浹 ˻
-    
-    BoxCollider2D* boxMoving = dynamic_cast<BoxCollider2D*>(moving);
-    BoxCollider2D* boxTarget = dynamic_cast<BoxCollider2D*>(target);
-    
-    if (!boxMoving || !boxTarget)
-        return false;  //  : Box 
-    
-    GameObject* movingObj = moving->GetGameObject();
-    GameObject* targetObj = target->GetGameObject();
-    
-    if (!movingObj || !targetObj)
-        return false;
-    
-    // ̵ 
-    XMFLOAT2 motion;
-    motion.x = newPos.x - oldPos.x;
-    motion.y = newPos.y - oldPos.y;
-    
-    float motionLength = sqrtf(motion.x * motion.x + motion.y * motion.y);
-    if (motionLength < 0.001f)
-        return false;  //   
-    
-    // ȭ ̵ 
-    XMFLOAT2 direction;
-    direction.x = motion.x / motionLength;
-    direction.y = motion.y / motionLength;
-    
-    // Target Ȯ AABB (Minkowski Sum)
-    XMFLOAT2 scaleMoving = movingObj->transform.GetScale();
-    XMFLOAT2 scaleTarget = targetObj->transform.GetScale();
-    
-    float halfWidthMoving = boxMoving->halfSize.x * scaleMoving.x;
-    float halfHeightMoving = boxMoving->halfSize.y * scaleMoving.y;
-    float halfWidthTarget = boxTarget->halfSize.x * scaleTarget.x;
-    float halfHeightTarget = boxTarget->halfSize.y * scaleTarget.y;
-    
-    XMFLOAT2 targetPos = targetObj->transform.GetPosition();
-    
-    // Ȯ AABB
-    float expandedMinX = targetPos.x - halfWidthTarget - halfWidthMoving;
-    float expandedMaxX = targetPos.x + halfWidthTarget + halfWidthMoving;
-    float expandedMinY = targetPos.y - halfHeightTarget - halfHeightMoving;
-    float expandedMaxY = targetPos.y + halfHeightTarget + halfHeightMoving;
-    
-    // () AABB  ˻
-    float tMin = 0.0f;
-    float tMax = motionLength;
-    
-    // X ˻
-    if (fabsf(direction.x) > 0.001f)
+    return collider->attachedBody == nullptr;
+}
+
+void PhysicsSystem::UpdateStaticProxy(BaseCollider* collider)
+{
+    if (!collider->IsEnabled() || !IsStaticCollider(collider))
     {
-        float tx1 = (expandedMinX - oldPos.x) / direction.x;
-        float tx2 = (expandedMaxX - oldPos.x) / direction.x;
-        
-        tMin = (std::max)(tMin, (std::min)(tx1, tx2));
-        tMax = (std::min)(tMax, (std::max)(tx1, tx2));
+        RemoveStaticProxy(collider);
+        return;
     }
-    else
+
+    AABB aabb = ComputeColliderAABB(collider);
+
+    if (collider->staticProxyId == DynamicAABBTree::NullNode)
+    {
+        collider->staticProxyId = staticTree.CreateProxy(aabb, collider);
+        return;
+    }
+
+    // 움직이지 않으면 Fat AABB 포함 검사만 (트리 변경 없음)
+    staticTree.MoveProxy(collider->staticProxyId, aabb, { 0.0f, 0.0f });
+}
+
+void PhysicsSystem::RemoveStaticProxy(BaseCollider* collider)
+{
+    if (collider->staticProxyId == DynamicAABBTree::NullNode)
+        return;
+
+    staticTree.DestroyProxy(collider->staticProxyId);
+    collider->staticProxyId = DynamicAABBTree::NullNode;
+}
+
+void PhysicsSystem::GatherStaticPairs()
+{
+    if (staticColliders.empty())
+        return;
+
+    for (BaseCollider* collider : colliders)
+    {
+        staticTree.Query(ComputeColliderAABB(collider), [&](int proxyId)
+        {
+            BaseCollider* other = staticTree.GetCollider(proxyId);
+            if (CanCollide(collider, other))
+                candidatePairs.push_back(MakeSortedPair(collider, other));
+            return true;
+        });
+    }
+}
+
+void PhysicsSystem::SplitTriggerPairs()
+{
+    // 제자리 압축 (정렬 순서 유지)
+    triggerPairs.clear();
+    size_t solidCount = 0;
+
+    for (const ColliderPair& pair : candidatePairs)
+    {
+        if (pair.firstCollider->IsTrigger() || pair.secondCollider->IsTrigger())
+            triggerPairs.push_back(pair);
+        else
+            candidatePairs[solidCount++] = pair;
+    }
+
+    candidatePairs.resize(solidCount);
+}
+
+void PhysicsSystem::GatherPairsWithDynamicTree()
+{
+    // Dynamic AABB Tree 방식: 트리는 유지하고 Fat AABB를 벗어난 프록시만 갱신
+    candidatePairs.clear();
+
+    // 1. 트리 동기화
+    UpdateDynamicTree(colliders);
+    ProfileMark(PhysicsPhase::BroadphaseBuild);
+
+    // 2. 후보 쌍 수집 (Fat AABB 겹침)
+    for (BaseCollider* collider : colliders)
+    {
+        int proxyId = treeProxies[collider].proxyId;
+        const AABB& fatAABB = dynamicTree.GetFatAABB(proxyId);
+
+        dynamicTree.Query(fatAABB, [&](int otherProxyId)
+        {
+            // 중복 방지 (프록시 ID 순서)
+            if (otherProxyId > proxyId)
+            {
+                BaseCollider* other = dynamicTree.GetCollider(otherProxyId);
+                if (CanCollide(collider, other))
+                    candidatePairs.push_back(MakeSortedPair(collider, other));
+            }
+            return true;
+        });
+    }
+}
+
+void PhysicsSystem::GatherPairsWithSweepAndPrune()
+{
+    // Sweep and Prune 방식: 끝점은 삽입 정렬로 갱신, 정렬 축 순서대로 훑기
+    candidatePairs.clear();
+
+    sweepAndPrune.Update(colliders);
+    ProfileMark(PhysicsPhase::BroadphaseBuild);
+    sweepAndPrune.ComputePairs();
+
+    for (const auto& pair : sweepAndPrune.GetPairs())
+    {
+        if (CanCollide(pair.first, pair.second))
+            candidatePairs.push_back(MakeSortedPair(pair.first, pair.second));
+    }
+}
+
+void PhysicsSystem::GatherPairsWithSpatialHash()
+{
+    // Spatial Hash 방식: 셀 키 해시 테이블 재구성 후 같은 셀 안에서만 검사
+    candidatePairs.clear();
+
+    spatialHash.Build(colliders);
+    ProfileMark(PhysicsPhase::BroadphaseBuild);
+    spatialHash.ComputePairs();
+
+    for (const auto& pair : spatialHash.GetPairs())
+    {
+        if (CanCollide(pair.first, pair.second))
+            candidatePairs.push_back(MakeSortedPair(pair.first, pair.second));
+    }
+}
+
+int PhysicsSystem::PrepareNarrowphaseSlices(size_t pairCount)
+{
+    // 쌍이 적으면 스레드 동기화 비용이 더 큼
+    const size_t MinPairsPerSlice = 64;
+
+    int workerCount = threadCount;
+    if (workerCount <= 0)
+        workerCount = static_cast<int>(std::thread::hardware_concurrency());
+    if (workerCount < 1)
+        workerCount = 1;
+
+    workerPool.Resize(workerCount);
+
+    int sliceCount = static_cast<int>((std::min)(static_cast<size_t>(workerCount), pairCount / MinPairsPerSlice));
+    if (sliceCount < 1)
+        sliceCount = 1;
+
+    if (static_cast<int>(narrowphaseBuffers.size()) < sliceCount)
+        narrowphaseBuffers.resize(sliceCount);
+
+    return sliceCount;
+}
+
+void PhysicsSystem::RunNarrowphase()
+{
+    // 1. 구간 수 결정
+    size_t pairCount = candidatePairs.size();
+    int sliceCount = PrepareNarrowphaseSlices(pairCount);
+
+    // 2. 연속 구간별 판정 (각 워커는 자기 버퍼에만 기록)
+    workerPool.Run(sliceCount, [this, pairCount, sliceCount](int slice)
+    {
+        size_t begin = pairCount * slice / sliceCount;
+        size_t end = pairCount * (slice + 1) / sliceCount;
+        NarrowphaseRange(begin, end, narrowphaseBuffers[slice]);
+    });
+
+    // 3. 구간 순서대로 병합 (후보 쌍이 정렬되어 있으므로 접촉 쌍도 정렬됨)
+    currentCollisionPairs.clear();
+
+    for (int slice = 0; slice < sliceCount; slice++)
+    {
+        const std::vector<ColliderPair>& touchingPairs = narrowphaseBuffers[slice].touchingPairs;
+        currentCollisionPairs.insert(currentCollisionPairs.end(), touchingPairs.begin(), touchingPairs.end());
+    }
+
+    // 사용하지 않은 버퍼는 비워 둠 (SolveContacts가 모든 버퍼를 순회)
+    for (size_t slice = sliceCount; slice < narrowphaseBuffers.size(); slice++)
+    {
+        narrowphaseBuffers[slice].touchingPairs.clear();
+        narrowphaseBuffers[slice].manifolds.clear();
+    }
+}
+
+void PhysicsSystem::NarrowphaseRange(size_t begin, size_t end, NarrowphaseBuffer& outBuffer) const
+{
+    outBuffer.touchingPairs.clear();
+    outBuffer.manifolds.clear();
+
+    ContactManifold manifold;
+
+    for (size_t i = begin; i < end; i++)
+    {
+        const ColliderPair& pair = candidatePairs[i];
+
+        // 잠든 쌍은 판정 생략 (움직이지 않았으므로 이전 스텝 결과 유지)
+        bool sleeping = IsSleepingPair(pair);
+
+        // 솔버용 접촉 (잠든 쌍은 pointCount = 0, SolveContacts에서 이전 접촉 유지)
+        // 스냅샷 복원 직후에는 이전 접촉에 충격량만 있으므로 잠든 쌍도 접촉점을 다시 계산 (움직이지 않았으므로 같은 값)
+        ContactBuildResult result = BuildContact(pair, sleeping && !rebuildSleepingContacts, manifold);
+        if (result == ContactBuildResult::Touching)
+        {
+            manifold.sleeping = sleeping;
+            outBuffer.manifolds.push_back(manifold);
+        }
+
+        // 이벤트용 겹침 (접촉을 만든 쌍은 그 결과, 솔버 대상이 아닌 쌍만 따로 판정)
+        bool touching;
+        if (sleeping)
+            touching = std::binary_search(previousCollisionPairs.begin(), previousCollisionPairs.end(), pair);
+        else if (result == ContactBuildResult::NotSolved)
+            touching = pair.firstCollider->Intersects(pair.secondCollider);
+        else
+            touching = result == ContactBuildResult::Touching;
+
+        if (touching)
+            outBuffer.touchingPairs.push_back(pair);
+    }
+}
+
+void PhysicsSystem::UpdateTriggerOverlaps()
+{
+    // 1. 내로우페이즈와 같은 방식으로 구간을 나눠 겹침만 판정 (접촉점/법선 없음)
+    size_t pairCount = triggerPairs.size();
+    int sliceCount = PrepareNarrowphaseSlices(pairCount);
+
+    workerPool.Run(sliceCount, [this, pairCount, sliceCount](int slice)
+    {
+        size_t begin = pairCount * slice / sliceCount;
+        size_t end = pairCount * (slice + 1) / sliceCount;
+        TriggerRange(begin, end, narrowphaseBuffers[slice].triggerTouchingPairs);
+    });
+
+    // 2. 접촉 쌍에 병합 (둘 다 정렬, 겹치는 쌍 없음 → 이벤트 비교는 한 배열로)
+    size_t middle = currentCollisionPairs.size();
+
+    for (int slice = 0; slice < sliceCount; slice++)
+    {
+        const std::vector<ColliderPair>& touchingPairs = narrowphaseBuffers[slice].triggerTouchingPairs;
+        currentCollisionPairs.insert(currentCollisionPairs.end(), touchingPairs.begin(), touchingPairs.end());
+    }
+
+    if (currentCollisionPairs.size() > middle)
+        std::inplace_merge(currentCollisionPairs.begin(), currentCollisionPairs.begin() + middle, currentCollisionPairs.end());
+}
+
+void PhysicsSystem::TriggerRange(size_t begin, size_t end, std::vector<ColliderPair>& outTouchingPairs) const
+{
+    outTouchingPairs.clear();
+
+    for (size_t i = begin; i < end; i++)
+    {
+        const ColliderPair& pair = triggerPairs[i];
+
+        // 잠든 쌍은 이전 스텝 결과 유지
+        bool touching = IsSleepingPair(pair)
+            ? std::binary_search(previousCollisionPairs.begin(), previousCollisionPairs.end(), pair)
+            : pair.firstCollider->Intersects(pair.secondCollider);
+
+        if (touching)
+            outTouchingPairs.push_back(pair);
+    }
+}
+
+bool PhysicsSystem::IsSleepingPair(const ColliderPair& pair) const
+{
+    // 양쪽 모두 잠들었거나 정적이고, 적어도 한쪽은 잠든 강체
+    bool hasSleepingBody = false;
+
+    for (BaseCollider* collider : { pair.firstCollider, pair.secondCollider })
     {
-        // : X  
-        if (oldPos.x < expandedMinX || oldPos.x > expandedMaxX)
+        Rigidbody2D* body = collider->GetAttachedRigidbody();
+        if (body == nullptr)
+            continue;
+
+        if (body->world != this || !bodies.IsSleeping(body->bodyIndex))
             return false;
+
+        hasSleepingBody = true;
     }
-    
-    // Y ˻
-    if (fabsf(direction.y) > 0.001f)
+
+    return hasSleepingBody;
+}
+
+PhysicsSystem::ContactBuildResult PhysicsSystem::BuildContact(const ColliderPair& pair, bool keepPrevious, ContactManifold& outManifold) const
+{
+    BaseCollider* colliderA = pair.firstCollider;
+    BaseCollider* colliderB = pair.secondCollider;
+
+    // 둘 다 Rigidbody가 없거나 같은 Rigidbody의 콜라이더끼리면 반발 없음
+    Rigidbody2D* rbA = colliderA->GetAttachedRigidbody();
+    Rigidbody2D* rbB = colliderB->GetAttachedRigidbody();
+
+    if ((!rbA && !rbB) || rbA == rbB)
+        return ContactBuildResult::NotSolved;
+
+    outManifold = ContactManifold();
+    SetupManifoldBody(colliderA, rbA, outManifold.bodyA, outManifold.centerA, outManifold.inverseMassA, outManifold.inverseInertiaA);
+    SetupManifoldBody(colliderB, rbB, outManifold.bodyB, outManifold.centerB, outManifold.inverseMassB, outManifold.inverseInertiaB);
+
+    // 둘 다 움직일 수 없으면 (Kinematic/정적) 풀 필요 없음
+    if (outManifold.inverseMassA + outManifold.inverseMassB + outManifold.inverseInertiaA + outManifold.inverseInertiaB <= 0.0f)
+        return ContactBuildResult::NotSolved;
+
+    if (keepPrevious)
     {
-        float ty1 = (expandedMinY - oldPos.y) / direction.y;
-        float ty2 = (expandedMaxY - oldPos.y) / direction.y;
-        
-        tMin = (std::max)(tMin, (std::min)(ty1, ty2));
-        tMax = (std::min)(tMax, (std::max)(ty1, ty2));
+        outManifold.colliderA = colliderA;
+        outManifold.colliderB = colliderB;
     }
-    else
+    else if (!ContactSolver::Collide(colliderA, colliderB, outManifold))
+    {
+        return ContactBuildResult::Separated;
+    }
+    outManifold.pairKey = pair.key;
+
+    // 재질 혼합 (있는 Rigidbody 값의 평균)
+    float friction = 0.0f;
+    float restitution = 0.0f;
+    int materialCount = 0;
+
+    if (rbA) { friction += rbA->friction; restitution += rbA->restitution; materialCount++; }
+    if (rbB) { friction += rbB->friction; restitution += rbB->restitution; materialCount++; }
+
+    outManifold.friction = friction / materialCount;
+    outManifold.restitution = restitution / materialCount;
+    return ContactBuildResult::Touching;
+}
+
+void PhysicsSystem::SolveContacts(float deltaTime)
+{
+    // 1. 접촉 추가 (구간 순서 = 후보 쌍 정렬 순서 → 이전 스텝 접촉과 병합 매칭)
+    contactSolver.BeginStep();
+
+    for (const NarrowphaseBuffer& buffer : narrowphaseBuffers)
+    {
+        for (const ContactManifold& manifold : buffer.manifolds)
+        {
+            if (manifold.sleeping)
+                contactSolver.KeepManifold(manifold);
+            else
+                contactSolver.AddManifold(manifold);
+        }
+    }
+
+    rebuildSleepingContacts = false;
+
+    // 2. 섬 구성 후 깨어 있는 강체와 닿은 섬은 전체를 깨움
+    WakeIslands();
+
+    // 3. 속도 제약 반복 풀이 (Warm Starting, 잠든 섬은 생략)
+    contactSolver.Solve(bodies, deltaTime, solverSettings);
+
+    // 4. 최종 속도로 수면 타이머 갱신 (이벤트 콜백이 강체를 추가/제거하기 전)
+    UpdateSleep(deltaTime);
+}
+
+void PhysicsSystem::WakeIslands()
+{
+    islands.Build(bodies, contactSolver.GetManifolds());
+
+    const int bodyCount = bodies.GetCount();
+    const int islandCount = islands.GetIslandCount();
+
+    // 1. 섬에 깨어 있는 강체가 하나라도 있으면 섬 전체가 깨어 있음
+    islandAwake.assign(islandCount, 0);
+
+    for (int i = 0; i < bodyCount; i++)
+    {
+        int island = islands.GetIsland(i);
+        if (island >= 0 && (!bodies.IsSleeping(i) || islands.TouchesKinematic(island)))
+            islandAwake[island] = 1;
+    }
+
+    // 2. 깨우기 + 이번 스텝에 건너뛸 강체 수
+    sleepingBodyCount = 0;
+
+    for (int i = 0; i < bodyCount; i++)
+    {
+        if (!bodies.IsSleeping(i))
+            continue;
+
+        int island = islands.GetIsland(i);
+        if (island >= 0 && islandAwake[island])
+            bodies.Wake(i);
+        else
+            sleepingBodyCount++;
+    }
+}
+
+void PhysicsSystem::WakeAttachedBody(BaseCollider* collider)
+{
+    Rigidbody2D* body = collider->GetAttachedRigidbody();
+    if (body && body->world == this)
+        bodies.Wake(body->bodyIndex);
+}
+
+void PhysicsSystem::UpdateSleep(float deltaTime)
+{
+    const int bodyCount = bodies.GetCount();
+    const int islandCount = islands.GetIslandCount();
+
+    if (!allowSleeping)
+        return;
+
+    // 1. 강체별 타이머 (속도가 기준 이하로 유지된 시간)
+    const float linearToleranceSq = sleepLinearVelocity * sleepLinearVelocity;
+    const float angularToleranceSq = sleepAngularVelocity * sleepAngularVelocity;
+
+    islandSleepTime.assign(islandCount, timeToSleep);
+
+    for (int i = 0; i < bodyCount; i++)
+    {
+        int island = islands.GetIsland(i);
+        if (island < 0 || bodies.IsSleeping(i))
+            continue;
+
+        float speedSq = bodies.velocityX[i] * bodies.velocityX[i] + bodies.velocityY[i] * bodies.velocityY[i];
+        float angularSpeedSq = bodies.angularVelocity[i] * bodies.angularVelocity[i];
+
+        if (speedSq > linearToleranceSq || angularSpeedSq > angularToleranceSq)
+            bodies.sleepTime[i] = 0.0f;
+        else
+            bodies.sleepTime[i] += deltaTime;
+
+        // 섬의 최소 시간
+        islandSleepTime[island] = (std::min)(islandSleepTime[island], bodies.sleepTime[i]);
+    }
+
+    // 2. 섬 전체가 충분히 오래 멈춰 있으면 함께 재움
+    for (int i = 0; i < bodyCount; i++)
+    {
+        int island = islands.GetIsland(i);
+        if (island < 0 || bodies.IsSleeping(i))
+            continue;
+
+        if (islandSleepTime[island] < timeToSleep || islands.TouchesKinematic(island))
+            continue;
+
+        bodies.flags[i] |= BodyFlag_Sleeping;
+        bodies.velocityX[i] = 0.0f;
+        bodies.velocityY[i] = 0.0f;
+        bodies.angularVelocity[i] = 0.0f;
+        bodies.forceX[i] = 0.0f;
+        bodies.forceY[i] = 0.0f;
+        bodies.torque[i] = 0.0f;
+    }
+}
+
+void PhysicsSystem::SetupManifoldBody(BaseCollider* collider, Rigidbody2D* body, int& outIndex, XMFLOAT2& outCenter,
+                                      float& outInverseMass, float& outInverseInertia) const
+{
+    // 비활성/미등록 Rigidbody는 정적 물체로 취급
+    if (body && body->world == this && (bodies.flags[body->bodyIndex] & BodyFlag_Active))
+    {
+        int index = body->bodyIndex;
+        uint32_t flags = bodies.flags[index];
+
+        outIndex = index;
+        outCenter = { bodies.positionX[index], bodies.positionY[index] };
+        outInverseMass = bodies.inverseMass[index];
+        outInverseInertia = (outInverseMass > 0.0f && !(flags & BodyFlag_FreezeRotation))
+            ? ContactSolver::ComputeInverseInertia(collider, body->mass)
+            : 0.0f;
+        return;
+    }
+
+    outIndex = -1;
+    outCenter = collider->GetGameObject()->transform.GetPosition();
+    outInverseMass = 0.0f;
+    outInverseInertia = 0.0f;
+}
+
+void PhysicsSystem::CollectContactEvents()
+{
+    // 1. 이번 스텝 실제 접촉 쌍은 RunNarrowphase에서 정렬 상태로 수집됨
+    contactEvents.clear();
+
+    // 2. 현재 콜라이더 목록 ID 정렬 (삭제된 콜라이더 보호용 이진 탐색, 쌍의 ID로 찾으므로 역참조 없음)
+    auto idLess = [](const BaseCollider* a, const BaseCollider* b) { return a->colliderId < b->colliderId; };
+    std::sort(colliders.begin(), colliders.end(), idLess);
+    std::sort(staticColliders.begin(), staticColliders.end(), idLess);
+
+    auto isAlive = [this](uint32_t colliderId)
+    {
+        auto contains = [colliderId](const std::vector<BaseCollider*>& sorted)
+        {
+            auto it = std::lower_bound(sorted.begin(), sorted.end(), colliderId,
+                                       [](const BaseCollider* collider, uint32_t id) { return collider->colliderId < id; });
+            return it != sorted.end() && (*it)->colliderId == colliderId;
+        };
+        return contains(colliders) || contains(staticColliders);
+    };
+
+    // 3. 이전/현재 정렬 배열 병합 비교
+    //    현재에만 있음 → Enter, 둘 다 있음 → Stay, 이전에만 있음 → Exit
+    size_t previousIndex = 0;
+    size_t currentIndex = 0;
+
+    while (previousIndex < previousCollisionPairs.size() || currentIndex < currentCollisionPairs.size())
+    {
+        bool hasPrevious = previousIndex < previousCollisionPairs.size();
+        bool hasCurrent = currentIndex < currentCollisionPairs.size();
+
+        if (hasCurrent && (!hasPrevious || currentCollisionPairs[currentIndex] < previousCollisionPairs[previousIndex]))
+        {
+            const ColliderPair& pair = currentCollisionPairs[currentIndex++];
+            QueueEvent(pair.firstCollider, pair.secondCollider, ContactEventType::Enter);
+        }
+        else if (hasPrevious && (!hasCurrent || previousCollisionPairs[previousIndex] < currentCollisionPairs[currentIndex]))
+        {
+            const ColliderPair& pair = previousCollisionPairs[previousIndex++];
+            bool firstAlive = isAlive(pair.GetFirstId());
+            bool secondAlive = isAlive(pair.GetSecondId());
+
+            // 접촉이 끝나면 남은 쪽 강체를 깨움 (받치던 물체가 치워지거나 삭제된 경우)
+            if (firstAlive)
+                WakeAttachedBody(pair.firstCollider);
+            if (secondAlive)
+                WakeAttachedBody(pair.secondCollider);
+
+            // 콜라이더가 삭제되지 않았을 때만 Exit 이벤트 발생
+            if (firstAlive && secondAlive)
+                QueueEvent(pair.firstCollider, pair.secondCollider, ContactEventType::Exit);
+        }
+        else
+        {
+            const ColliderPair& pair = currentCollisionPairs[currentIndex];
+            QueueEvent(pair.firstCollider, pair.secondCollider, ContactEventType::Stay);
+            previousIndex++;
+            currentIndex++;
+        }
+    }
+
+    // 버퍼 교환 (할당 재사용)
+    previousCollisionPairs.swap(currentCollisionPairs);
+}
+
+void PhysicsSystem::QueueEvent(BaseCollider* colliderA, BaseCollider* colliderB, ContactEventType type)
+{
+    if (colliderA == nullptr || colliderB == nullptr)
+        return;
+
+    // Unity 스타일: 하나라도 Trigger면 OnTrigger (물리 연산 X, 가벼운 감지), 아니면 OnCollision
+    static const uint32_t CollisionCallbacks[3] =
+        { CollisionCallback_CollisionEnter, CollisionCallback_CollisionStay, CollisionCallback_CollisionExit };
+    static const uint32_t TriggerCallbacks[3] =
+        { CollisionCallback_TriggerEnter, CollisionCallback_TriggerStay, CollisionCallback_TriggerExit };
+
+    bool isTriggerEvent = colliderA->IsTrigger() || colliderB->IsTrigger();
+    uint32_t callback = (isTriggerEvent ? TriggerCallbacks : CollisionCallbacks)[static_cast<int>(type)];
+
+    // 양쪽 모두 받을 컴포넌트가 없으면 버퍼에 넣지 않음 (대부분의 Stay)
+    uint32_t listeners = colliderA->GetGameObject()->GetCollisionListeners() |
+                         colliderB->GetGameObject()->GetCollisionListeners();
+    if ((listeners & callback) == 0)
+        return;
+
+    contactEvents.push_back({ colliderA, colliderB, callback });
+}
+
+void PhysicsSystem::DispatchContactEvents()
+{
+    if (contactEvents.empty())
+        return;
+
+    dispatchingEvents = true;
+
+    // 콜백이 Clear를 호출할 수 있으므로 매번 크기 확인
+    for (size_t i = 0; i < contactEvents.size(); i++)
+    {
+        ContactEvent event = contactEvents[i];
+
+        if (IsRemovedDuringDispatch(event.colliderA) || IsRemovedDuringDispatch(event.colliderB))
+            continue;
+        NotifyEvent(event.colliderA, event.colliderB, event.callback);
+
+        // A쪽 콜백이 B를 제거했을 수 있음
+        if (IsRemovedDuringDispatch(event.colliderA) || IsRemovedDuringDispatch(event.colliderB))
+            continue;
+        NotifyEvent(event.colliderB, event.colliderA, event.callback);
+    }
+
+    dispatchingEvents = false;
+    removedDuringDispatch.clear();
+}
+
+bool PhysicsSystem::IsRemovedDuringDispatch(BaseCollider* collider) const
+{
+    // 전달 중 제거는 드물어 선형 탐색
+    return !removedDuringDispatch.empty() &&
+           std::find(removedDuringDispatch.begin(), removedDuringDispatch.end(), collider) != removedDuringDispatch.end();
+}
+
+void PhysicsSystem::NotifyEvent(BaseCollider* collider, BaseCollider* other, uint32_t callback)
+{
+    switch (callback)
+    {
+    case CollisionCallback_CollisionEnter: collider->NotifyCollisionEnter(other); break;
+    case CollisionCallback_CollisionStay:  collider->NotifyCollisionStay(other);  break;
+    case CollisionCallback_CollisionExit:  collider->NotifyCollisionExit(other);  break;
+    case CollisionCallback_TriggerEnter:   collider->NotifyTriggerEnter(other);   break;
+    case CollisionCallback_TriggerStay:    collider->NotifyTriggerStay(other);    break;
+    case CollisionCallback_TriggerExit:    collider->NotifyTriggerExit(other);    break;
+    default: break;
+    }
+}
+
+// ========== 공간 쿼리 ==========
+
+namespace
+{
+    // 방향 정규화 (0 벡터면 false)
+    bool NormalizeDirection(const XMFLOAT2& direction, XMFLOAT2& outDirection)
     {
-        // : Y  
-        if (oldPos.y < expandedMinY || oldPos.y > expandedMaxY)
+        float length = sqrtf(direction.x * direction.x + direction.y * direction.y);
+        if (length <= 0.0f)
             return false;
+
+        outDirection = { direction.x / length, direction.y / length };
+        return true;
     }
-    
-    //  
-    if (tMin > tMax || tMax < 0.0f)
-        return false;  // 浹 
-    
-    // Time of Impact (0~1)
-    outTOI = tMin / motionLength;
-    if (outTOI < 0.0f) outTOI = 0.0f;
-    if (outTOI > 1.0f) outTOI = 1.0f;
-    
-    return true;  // CCD 浹 !
+}
+
+void PhysicsSystem::SyncTransforms()
+{
+    // 스텝용 colliders 버퍼는 이벤트 중(콜백 안 쿼리)에도 쓰이므로 별도 버퍼 사용
+    queryColliders.clear();
+
+    for (BaseCollider* collider : registeredColliders)
+    {
+        if (collider->IsEnabled() && !IsStaticCollider(collider))
+            queryColliders.push_back(collider);
+
+        UpdateStaticProxy(collider);
+    }
+
+    UpdateDynamicTree(queryColliders);
+    queryTreeDirty = false;
+}
+
+void PhysicsSystem::EnsureQueryTree()
+{
+    if (queryTreeDirty)
+        SyncTransforms();
+}
+
+bool PhysicsSystem::PassesQueryFilter(BaseCollider* collider, uint32_t layerMask) const
+{
+    if ((collider->GetLayerBit() & layerMask) == 0)
+        return false;
+
+    if (!collider->IsEnabled())
+        return false;
+
+    return queriesHitTriggers || !collider->IsTrigger();
+}
+
+template<typename CastFunc>
+bool PhysicsSystem::CastClosest(const XMFLOAT2& origin, const XMFLOAT2& direction, float maxDistance,
+                                const XMFLOAT2& extents, uint32_t layerMask, RaycastHit& outHit, CastFunc&& cast)
+{
+    XMFLOAT2 unitDirection;
+    if (maxDistance < 0.0f || !NormalizeDirection(direction, unitDirection))
+        return false;
+
+    EnsureQueryTree();
+
+    bool found = false;
+    RaycastHit hit;
+    QueryShape shape;
+
+    // 히트할 때마다 탐색 거리를 줄여 더 먼 노드는 건너뜀 (정적 트리는 동적 트리 히트 거리부터)
+    for (const DynamicAABBTree* tree : { &dynamicTree, &staticTree })
+    {
+        float treeMaxDistance = found ? outHit.distance : maxDistance;
+
+        tree->RayCast(origin, unitDirection, treeMaxDistance, extents, [&](int proxyId, float currentMax)
+        {
+            BaseCollider* collider = tree->GetCollider(proxyId);
+            if (!PassesQueryFilter(collider, layerMask) || !QueryShape::FromCollider(collider, shape))
+                return currentMax;
+
+            if (!cast(shape, unitDirection, currentMax, hit))
+                return currentMax;
+
+            hit.collider = collider;
+            hit.fraction = (maxDistance > 0.0f) ? hit.distance / maxDistance : 0.0f;
+
+            // 같은 거리면 먼저 찾은 히트 유지
+            if (!found || hit.distance < outHit.distance)
+            {
+                outHit = hit;
+                found = true;
+            }
+
+            return outHit.distance;
+        });
+    }
+
+    return found;
+}
+
+template<typename TestFunc>
+int PhysicsSystem::OverlapShape(const AABB& bounds, uint32_t layerMask, BaseCollider** outColliders, int maxColliders,
+                                TestFunc&& test)
+{
+    if (outColliders == nullptr || maxColliders <= 0)
+        return 0;
+
+    EnsureQueryTree();
+
+    int count = 0;
+    QueryShape shape;
+
+    for (const DynamicAABBTree* tree : { &dynamicTree, &staticTree })
+    {
+        tree->Query(bounds, [&](int proxyId)
+        {
+            BaseCollider* collider = tree->GetCollider(proxyId);
+            if (PassesQueryFilter(collider, layerMask) && QueryShape::FromCollider(collider, shape) && test(shape))
+                outColliders[count++] = collider;
+
+            // 버퍼가 차면 중단
+            return count < maxColliders;
+        });
+
+        if (count == maxColliders)
+            break;
+    }
+
+    return count;
+}
+
+bool PhysicsSystem::Raycast(const XMFLOAT2& origin, const XMFLOAT2& direction, float maxDistance,
+                            RaycastHit& outHit, uint32_t layerMask)
+{
+    return CastClosest(origin, direction, maxDistance, { 0.0f, 0.0f }, layerMask, outHit,
+        [&](const QueryShape& shape, const XMFLOAT2& unitDirection, float distance, RaycastHit& hit)
+        {
+            return ShapeQuery::Raycast(shape, origin, unitDirection, distance, hit);
+        });
+}
+
+int PhysicsSystem::RaycastAll(const XMFLOAT2& origin, const XMFLOAT2& direction, float maxDistance,
+                              RaycastHit* outHits, int maxHits, uint32_t layerMask)
+{
+    XMFLOAT2 unitDirection;
+    if (outHits == nullptr || maxHits <= 0 || maxDistance < 0.0f || !NormalizeDirection(direction, unitDirection))
+        return 0;
+
+    EnsureQueryTree();
+
+    int count = 0;
+    RaycastHit hit;
+    QueryShape shape;
+
+    for (const DynamicAABBTree* tree : { &dynamicTree, &staticTree })
+    {
+        float treeMaxDistance = (count == maxHits) ? outHits[maxHits - 1].distance : maxDistance;
+
+        tree->RayCast(origin, unitDirection, treeMaxDistance, { 0.0f, 0.0f }, [&](int proxyId, float currentMax)
+        {
+            BaseCollider* collider = tree->GetCollider(proxyId);
+            if (!PassesQueryFilter(collider, layerMask) || !QueryShape::FromCollider(collider, shape))
+                return currentMax;
+
+            if (!ShapeQuery::Raycast(shape, origin, unitDirection, currentMax, hit))
+                return currentMax;
+
+            hit.collider = collider;
+
+            // 거리순 삽입 (버퍼가 차 있으면 가장 먼 히트를 밀어냄)
+            int index;
+            if (count < maxHits)
+            {
+                index = count++;
+            }
+            else
+            {
+                if (outHits[maxHits - 1].distance <= hit.distance)
+                    return currentMax;
+                index = maxHits - 1;
+            }
+
+            while (index > 0 && outHits[index - 1].distance > hit.distance)
+            {
+                outHits[index] = outHits[index - 1];
+                index--;
+            }
+            outHits[index] = hit;
+
+            // 버퍼가 차면 가장 먼 히트보다 먼 노드는 건너뜀
+            return (count == maxHits) ? outHits[maxHits - 1].distance : currentMax;
+        });
+    }
+
+    return count;
+}
+
+bool PhysicsSystem::CircleCast(const XMFLOAT2& origin, float radius, const XMFLOAT2& direction, float maxDistance,
+                               RaycastHit& outHit, uint32_t layerMask)
+{
+    return CastClosest(origin, direction, maxDistance, { radius, radius }, layerMask, outHit,
+        [&](const QueryShape& shape, const XMFLOAT2& unitDirection, float distance, RaycastHit& hit)
+        {
+            return ShapeQuery::CircleCast(shape, origin, radius, unitDirection, distance, hit);
+        });
+}
+
+bool PhysicsSystem::BoxCast(const XMFLOAT2& center, const XMFLOAT2& halfSize, float angle, const XMFLOAT2& direction,
+                            float maxDistance, RaycastHit& outHit, uint32_t layerMask)
+{
+    QueryShape box = QueryShape::MakeBox(center, halfSize, angle);
+
+    return CastClosest(center, direction, maxDistance, box.GetAABBExtents(), layerMask, outHit,
+        [&](const QueryShape& shape, const XMFLOAT2& unitDirection, float distance, RaycastHit& hit)
+        {
+            return ShapeQuery::BoxCast(shape, box, unitDirection, distance, hit);
+        });
+}
+
+int PhysicsSystem::OverlapPoint(const XMFLOAT2& point, BaseCollider** outColliders, int maxColliders, uint32_t layerMask)
+{
+    AABB bounds(point.x, point.y, point.x, point.y);
+
+    return OverlapShape(bounds, layerMask, outColliders, maxColliders, [&](const QueryShape& shape)
+    {
+        return ShapeQuery::ContainsPoint(shape, point);
+    });
+}
+
+int PhysicsSystem::OverlapCircle(const XMFLOAT2& center, float radius, BaseCollider** outColliders, int maxColliders,
+                                 uint32_t layerMask)
+{
+    QueryShape circle = QueryShape::MakeCircle(center, radius);
+    AABB bounds(center.x - radius, center.y - radius, center.x + radius, center.y + radius);
+
+    return OverlapShape(bounds, layerMask, outColliders, maxColliders, [&](const QueryShape& shape)
+    {
+        return ShapeQuery::Overlaps(shape, circle);
+    });
+}
+
+int PhysicsSystem::OverlapBox(const XMFLOAT2& center, const XMFLOAT2& halfSize, float angle, BaseCollider** outColliders,
+                              int maxColliders, uint32_t layerMask)
+{
+    QueryShape box = QueryShape::MakeBox(center, halfSize, angle);
+    XMFLOAT2 extents = box.GetAABBExtents();
+    AABB bounds(center.x - extents.x, center.y - extents.y, center.x + extents.x, center.y + extents.y);
+
+    return OverlapShape(bounds, layerMask, outColliders, maxColliders, [&](const QueryShape& shape)
+    {
+        return ShapeQuery::Overlaps(shape, box);
+    });
+}
+
+// ========== CCD (Continuous Collision Detection) ==========
+
+void PhysicsSystem::SolveContinuous(float deltaTime)
+{
+    ccdHitCount = 0;
+    ccdHitPairs.clear();
+    ccdColliders.clear();
+    ccdHasDynamicTargets = false;
+
+    // 1. 움직이는 CCD 강체의 콜라이더 (트리거 제외)
+    for (BaseCollider* collider : colliders)
+    {
+        if (collider->IsTrigger())
+            continue;
+
+        Rigidbody2D* body = collider->GetAttachedRigidbody();
+        if (body == nullptr || body->world != this)
+        {
+            ccdHasDynamicTargets = true;
+            continue;
+        }
+
+        int index = body->bodyIndex;
+        uint32_t flags = bodies.flags[index];
+        if ((flags & BodyFlag_UseCCD) && (flags & BodyFlag_Active) &&
+            !(flags & (BodyFlag_Kinematic | BodyFlag_Sleeping)) && bodies.inverseMass[index] > 0.0f)
+        {
+            ccdColliders.push_back(collider);
+        }
+        else
+        {
+            ccdHasDynamicTargets = true;
+        }
+    }
+
+    if (ccdColliders.empty())
+        return;
+
+    // 대상 스윕 캐시는 이번 단계 stamp인 항목만 유효 (0은 비워 둠)
+    if (++ccdSweepStamp == 0)
+    {
+        for (CCDTargetSweep& entry : ccdTargetSweeps)
+            entry.stamp = 0;
+        ccdSweepStamp = 1;
+    }
+    if (ccdTargetSweeps.size() < collidersById.size())
+        ccdTargetSweeps.resize(collidersById.size());
+
+    // 강체별로 묶음 (한 강체의 콜라이더가 연속 구간)
+    std::sort(ccdColliders.begin(), ccdColliders.end(), [](const BaseCollider* a, const BaseCollider* b)
+    {
+        return a->attachedBody->bodyIndex < b->attachedBody->bodyIndex;
+    });
+
+    // 2. 콜라이더별 스텝 스윕 범위 트리 (다른 CCD 강체의 후보 검색용, 처리 후 실제 이동으로 갱신)
+    ccdSweepTree.Clear();
+    ccdSweepProxies.clear();
+
+    for (BaseCollider* collider : ccdColliders)
+    {
+        const CCDTargetSweep& entry = UpdateCCDTargetSweep(collider, true);
+        ccdSweepProxies.push_back(ccdSweepTree.CreateProxy(ComputeSweptBounds(entry.sweep, solverSettings.linearSlop), collider));
+    }
+
+    // 3. 후보 검색용 동적 트리 (DynamicTree 브로드페이즈면 이번 스텝에 이미 갱신됨, 대상이 모두 CCD면 생략)
+    if (ccdHasDynamicTargets && (broadphaseMode != BroadphaseMode::DynamicTree || colliders.size() <= 10))
+        UpdateDynamicTree(colliders);
+
+    // 4. 강체마다 첫 충돌 시점까지 서브스텝
+    for (size_t begin = 0; begin < ccdColliders.size();)
+    {
+        int index = ccdColliders[begin]->attachedBody->bodyIndex;
+        size_t end = begin + 1;
+        while (end < ccdColliders.size() && ccdColliders[end]->attachedBody->bodyIndex == index)
+            end++;
+
+        if (AdvanceContinuousBody(index, begin, end, deltaTime))
+        {
+            for (size_t i = begin; i < end; i++)
+            {
+                const CCDTargetSweep& entry = UpdateCCDTargetSweep(ccdColliders[i], true);
+                ccdSweepTree.MoveProxy(ccdSweepProxies[i], ComputeSweptBounds(entry.sweep, solverSettings.linearSlop), { 0.0f, 0.0f });
+            }
+        }
+        begin = end;
+    }
+
+    // 5. 충돌 쌍을 이번 스텝 접촉 쌍에 합침 (Enter 이벤트, 다음 스텝에 떨어져 있으면 Exit)
+    if (!ccdHitPairs.empty())
+    {
+        std::sort(ccdHitPairs.begin(), ccdHitPairs.end());
+
+        size_t middle = currentCollisionPairs.size();
+        currentCollisionPairs.insert(currentCollisionPairs.end(), ccdHitPairs.begin(), ccdHitPairs.end());
+        std::inplace_merge(currentCollisionPairs.begin(), currentCollisionPairs.begin() + middle, currentCollisionPairs.end());
+        currentCollisionPairs.erase(std::unique(currentCollisionPairs.begin(), currentCollisionPairs.end()), currentCollisionPairs.end());
+    }
+}
+
+bool PhysicsSystem::AdvanceContinuousBody(int index, size_t colliderBegin, size_t colliderEnd, float deltaTime)
+{
+    const uint32_t flags = bodies.flags[index];
+    const Rigidbody2D* body = bodies.owners[index];
+    const Transform& transform = body->GetGameObject()->transform;
+
+    // 스텝 시작 자세 (Transform은 아직 기록 전 = 콜라이더 월드 형태 캐시와 같은 자세)
+    const XMFLOAT2 startPosition = transform.GetPosition();
+    const float startRotation = transform.GetRotation();
+
+    const float targetSeparation = solverSettings.linearSlop;
+    const float tolerance = 0.25f * solverSettings.linearSlop;
+
+    // 트리 AABB는 스텝 시작 위치이므로 CCD가 아닌 대상이 한 스텝에 움직일 수 있는 거리만큼 더 확장
+    const float targetMargin = maxVelocity * deltaTime;
+
+    // 서브스텝 (스텝 비율 elapsed부터 남은 시간 동안 스윕 → 첫 충돌 시점까지 이동 → 속도 반응)
+    XMFLOAT2 position = startPosition;
+    float rotation = startRotation;
+    float elapsed = 0.0f;
+    bool advanced = false;
+
+    for (int subStep = 0; subStep < maxCCDSubSteps; subStep++)
+    {
+        // 첫 서브스텝은 적분한 이동 그대로 (앞서 처리한 CCD 강체가 이 강체 속도를 바꿨을 수 있음)
+        // 충돌 후에는 반응한 속도로 남은 시간만큼
+        XMFLOAT2 translation{ bodies.positionX[index] - startPosition.x, bodies.positionY[index] - startPosition.y };
+        float turn = bodies.rotation[index] - startRotation;
+
+        if (advanced)
+        {
+            float remainingTime = (1.0f - elapsed) * deltaTime;
+
+            translation = { 0.0f, 0.0f };
+            if (!(flags & BodyFlag_FreezePositionX))
+                translation.x = bodies.velocityX[index] * remainingTime;
+            if (!(flags & BodyFlag_FreezePositionY))
+                translation.y = bodies.velocityY[index] * remainingTime;
+            turn = (flags & BodyFlag_FreezeRotation) ? 0.0f : bodies.angularVelocity[index] * remainingTime;
+        }
+
+        TimeOfImpactResult first;
+        BaseCollider* hitCollider = nullptr;
+        BaseCollider* hitTarget = nullptr;
+
+        for (size_t i = colliderBegin; i < colliderEnd; i++)
+        {
+            BaseCollider* collider = ccdColliders[i];
+
+            // 시작 자세 형태 (이 강체를 처리하는 동안 캐시는 스텝 시작 → 적분 후 스윕 그대로)
+            const CCDTargetSweep& self = ccdTargetSweeps[collider->colliderId];
+            if (!self.valid)
+                continue;
+
+            // 자기 두께의 절반도 못 움직이면 이산 충돌로 충분 (붙어 있는 접촉에 서브스텝을 쓰지 않음)
+            const float motionThreshold = FastMotionRatio * self.minExtent;
+            const float turnReach = fabsf(turn) * self.rotationReach;
+            if (sqrtf(translation.x * translation.x + translation.y * translation.y) + turnReach < motionThreshold)
+                continue;
+
+            // 시작 자세 형태를 현재 자세로 옮긴 뒤 남은 이동으로 스윕
+            ShapeSweep fromStart = self.sweep;
+            fromStart.translation = { position.x - startPosition.x, position.y - startPosition.y };
+            fromStart.rotation = rotation - startRotation;
+
+            ShapeSweep sweep;
+            sweep.shape = fromStart.GetShape(1.0f);
+            sweep.pivot = position;
+            sweep.translation = translation;
+            sweep.rotation = turn;
+
+            // 중심부 형태로 충돌 시점 계산 (이산 솔버가 남긴 얕은 겹침에서도 더 파고드는 이동을 막음)
+            const float inset = CoreFraction * self.minExtent;
+            ShapeSweep core = sweep.GetCore(inset);
+            ShapeSweep centroid = sweep.GetCore(FLT_MAX);
+
+            // 후보: 스윕 범위와 겹치는 동적(CCD 제외)/정적 트리 프록시 + 스윕 범위가 겹치는 CCD 콜라이더 (트리끼리 겹치지 않음)
+            AABB sweptBounds = ComputeSweptBounds(sweep, targetSeparation);
+
+            ccdCandidates.clear();
+
+            if (ccdHasDynamicTargets)
+            {
+                AABB queryBounds(sweptBounds.min.x - targetMargin, sweptBounds.min.y - targetMargin,
+                                 sweptBounds.max.x + targetMargin, sweptBounds.max.y + targetMargin);
+                dynamicTree.Query(queryBounds, [this](int proxyId)
+                {
+                    BaseCollider* candidate = dynamicTree.GetCollider(proxyId);
+                    const CCDTargetSweep& entry = ccdTargetSweeps[candidate->colliderId];
+                    if (entry.stamp != ccdSweepStamp || !entry.continuous)
+                        ccdCandidates.push_back(candidate);
+                    return true;
+                });
+            }
+
+            staticTree.Query(sweptBounds, [this](int proxyId)
+            {
+                ccdCandidates.push_back(staticTree.GetCollider(proxyId));
+                return true;
+            });
+
+            ccdSweepTree.Query(sweptBounds, [this](int proxyId)
+            {
+                ccdCandidates.push_back(ccdSweepTree.GetCollider(proxyId));
+                return true;
+            });
+
+            ShapeSweep advancedTarget;
+            for (BaseCollider* target : ccdCandidates)
+            {
+                if (target->GetAttachedRigidbody() == body || target->IsTrigger() || !CanCollide(collider, target))
+                    continue;
+
+                const CCDTargetSweep& targetEntry = GetCCDTargetSweep(target);
+                if (!targetEntry.valid || !sweptBounds.Intersects(targetEntry.bounds))
+                    continue;
+
+                // 대상의 남은 스윕 (충돌 후 서브스텝이면 elapsed부터)
+                const ShapeSweep* remainingSweep = &targetEntry.sweep;
+                if (targetEntry.moving && elapsed > 0.0f)
+                {
+                    advancedTarget = targetEntry.sweep.GetRemaining(elapsed);
+                    remainingSweep = &advancedTarget;
+                }
+                const ShapeSweep& remaining = *remainingSweep;
+
+                // 움직이는 대상: 상대 이동이 자기 두께의 절반도 안 되면 이산 충돌로 충분
+                if (targetEntry.moving)
+                {
+                    XMFLOAT2 relative{ translation.x - remaining.translation.x, translation.y - remaining.translation.y };
+                    float relativeReach = sqrtf(relative.x * relative.x + relative.y * relative.y) + turnReach +
+                                          fabsf(remaining.rotation) * targetEntry.rotationReach;
+                    if (relativeReach < motionThreshold)
+                        continue;
+                }
+
+                // 두 회전 중심을 감싸는 원이 상대 이동 동안 가장 가까워져도 떨어져 있으면 충돌 없음
+                {
+                    XMFLOAT2 offset{ remaining.pivot.x - sweep.pivot.x, remaining.pivot.y - sweep.pivot.y };
+                    XMFLOAT2 motion{ remaining.translation.x - translation.x, remaining.translation.y - translation.y };
+                    float motionSq = motion.x * motion.x + motion.y * motion.y;
+                    float t = motionSq > 0.0f ? -(offset.x * motion.x + offset.y * motion.y) / motionSq : 0.0f;
+                    t = (std::max)(0.0f, (std::min)(1.0f, t));
+
+                    float closestX = offset.x + motion.x * t;
+                    float closestY = offset.y + motion.y * t;
+                    float reach = self.boundingRadius + targetEntry.boundingRadius + targetSeparation + tolerance;
+                    if (closestX * closestX + closestY * closestY > reach * reach)
+                        continue;
+                }
+
+                // 이번 스텝 이산 접촉이 있는 대상: 접촉 법선(이 콜라이더 → 대상) 방향으로 파고드는 상대 이동이
+                // 자기 반 두께보다 작으면 중심이 대상을 넘지 않으므로 이산 솔버에 맡김 (붙어 있는 쌍에 CCD 생략)
+                const ContactManifold* contact = contactSolver.FindManifold(MakeSortedPair(collider, target).key);
+                XMFLOAT2 contactNormal{ 0.0f, 0.0f };
+                if (contact)
+                {
+                    float sign = collider->colliderId < target->colliderId ? 1.0f : -1.0f;
+                    contactNormal = { contact->normal.x * sign, contact->normal.y * sign };
+
+                    float closing = (translation.x - remaining.translation.x) * contactNormal.x +
+                                    (translation.y - remaining.translation.y) * contactNormal.y;
+                    if (closing < self.minExtent)
+                        continue;
+                }
+
+                // 중심부까지 겹쳐 있으면 형태 중심점만으로 (중심이 대상을 넘어가는 이동만 막음)
+                TimeOfImpactResult result;
+                bool hit = TimeOfImpact::Solve(core, remaining, targetSeparation + inset, tolerance, result);
+                if (!hit && result.overlapped)
+                    hit = TimeOfImpact::Solve(centroid, remaining, targetSeparation, tolerance, result);
+
+                // 중심점까지 파고든 채 이산 접촉 법선 방향으로 더 들어가는 중 (쌓인 강체에 눌린 경우): 그 자리에서 멈춤
+                if (!hit && result.overlapped && contact)
+                {
+                    hit = true;
+                    result.fraction = 0.0f;
+                    result.normal = contactNormal;
+                }
+
+                // 충돌 시점이 같으면 ID가 작은 대상 (후보 순서와 무관)
+                if (hit && (result.fraction < first.fraction ||
+                            (result.fraction == first.fraction && hitTarget && target->colliderId < hitTarget->colliderId)))
+                {
+                    first = result;
+                    hitCollider = collider;
+                    hitTarget = target;
+                }
+            }
+        }
+
+        // 충돌이 없으면 적분 위치 그대로 (첫 서브스텝) 또는 남은 이동 끝까지
+        if (hitTarget == nullptr)
+        {
+            if (advanced)
+            {
+                position.x += translation.x;
+                position.y += translation.y;
+                rotation += turn;
+            }
+            break;
+        }
+
+        position.x += translation.x * first.fraction;
+        position.y += translation.y * first.fraction;
+        rotation += turn * first.fraction;
+        elapsed += (1.0f - elapsed) * first.fraction;
+        advanced = true;
+
+        ApplyContinuousImpulse(index, hitTarget, first.normal);
+        ccdHitPairs.push_back(MakeSortedPair(hitCollider, hitTarget));
+        ccdHitCount++;
+    }
+
+    // 서브스텝을 다 쓰면 마지막 충돌 시점에 멈춤 (남은 시간은 버림)
+    if (!advanced)
+        return false;
+
+    bodies.positionX[index] = position.x;
+    bodies.positionY[index] = position.y;
+    bodies.rotation[index] = rotation;
+    return true;
+}
+
+bool PhysicsSystem::MakeTargetSweep(BaseCollider* target, ShapeSweep& outSweep) const
+{
+    if (!QueryShape::FromCollider(target, outSweep.shape))
+        return false;
+
+    // 스텝 시작 자세 → 적분(또는 CCD 처리) 후 자세, 정적/Kinematic/잠든 강체는 이동 없음
+    const Transform& transform = target->GetGameObject()->transform;
+    outSweep.pivot = transform.GetPosition();
+    outSweep.translation = { 0.0f, 0.0f };
+    outSweep.rotation = 0.0f;
+
+    Rigidbody2D* body = target->GetAttachedRigidbody();
+    if (body && body->world == this)
+    {
+        int index = body->bodyIndex;
+        uint32_t flags = bodies.flags[index];
+        if ((flags & BodyFlag_Active) && !(flags & (BodyFlag_Kinematic | BodyFlag_Sleeping)))
+        {
+            outSweep.translation = { bodies.positionX[index] - outSweep.pivot.x, bodies.positionY[index] - outSweep.pivot.y };
+            outSweep.rotation = bodies.rotation[index] - transform.GetRotation();
+        }
+    }
+
+    return true;
+}
+
+PhysicsSystem::CCDTargetSweep& PhysicsSystem::UpdateCCDTargetSweep(BaseCollider* target, bool continuous)
+{
+    CCDTargetSweep& entry = ccdTargetSweeps[target->colliderId];
+    entry.stamp = ccdSweepStamp;
+    entry.continuous = continuous;
+    entry.valid = MakeTargetSweep(target, entry.sweep);
+    if (!entry.valid)
+        return entry;
+
+    const ShapeSweep& sweep = entry.sweep;
+    entry.moving = sweep.translation.x != 0.0f || sweep.translation.y != 0.0f || sweep.rotation != 0.0f;
+    entry.bounds = ComputeSweptBounds(sweep, 0.0f);
+    entry.rotationReach = sweep.GetRotationReach();
+    entry.boundingRadius = entry.rotationReach + (sweep.shape.type == QueryShape::Type::Circle ? fabsf(sweep.shape.radius) : 0.0f);
+    entry.minExtent = sweep.GetMinExtent();
+    return entry;
+}
+
+const PhysicsSystem::CCDTargetSweep& PhysicsSystem::GetCCDTargetSweep(BaseCollider* target)
+{
+    // CCD가 아닌 대상은 CCD 단계 동안 움직이지 않으므로 처음 찾을 때 한 번만 계산
+    CCDTargetSweep& entry = ccdTargetSweeps[target->colliderId];
+    if (entry.stamp == ccdSweepStamp)
+        return entry;
+
+    return UpdateCCDTargetSweep(target, false);
+}
+
+void PhysicsSystem::ApplyContinuousImpulse(int index, BaseCollider* target, const XMFLOAT2& normal)
+{
+    const Rigidbody2D* body = bodies.owners[index];
+
+    // 대상 강체 (비활성/Kinematic/미등록은 정적 취급)
+    Rigidbody2D* targetBody = target->GetAttachedRigidbody();
+    int targetIndex = -1;
+    float targetInverseMass = 0.0f;
+
+    if (targetBody && targetBody->world == this)
+    {
+        uint32_t flags = bodies.flags[targetBody->bodyIndex];
+        if ((flags & BodyFlag_Active) && !(flags & BodyFlag_Kinematic))
+        {
+            targetIndex = targetBody->bodyIndex;
+            targetInverseMass = bodies.inverseMass[targetIndex];
+        }
+    }
+
+    // 법선 방향 접근 속도 (A → B, 양수 = 가까워지는 중)
+    float relativeX = bodies.velocityX[index] - (targetIndex >= 0 ? bodies.velocityX[targetIndex] : 0.0f);
+    float relativeY = bodies.velocityY[index] - (targetIndex >= 0 ? bodies.velocityY[targetIndex] : 0.0f);
+    float approachSpeed = relativeX * normal.x + relativeY * normal.y;
+    if (approachSpeed <= 0.0f)
+        return;
+
+    // 재질 (있는 Rigidbody 값의 평균, BuildContact와 같음) + 느린 충돌은 반발 없음
+    float restitution = targetBody ? (body->restitution + targetBody->restitution) * 0.5f : body->restitution;
+    if (approachSpeed < solverSettings.restitutionThreshold)
+        restitution = 0.0f;
+
+    float inverseMass = bodies.inverseMass[index];
+    float impulse = (1.0f + restitution) * approachSpeed / (inverseMass + targetInverseMass);
+
+    bodies.velocityX[index] -= normal.x * impulse * inverseMass;
+    bodies.velocityY[index] -= normal.y * impulse * inverseMass;
+
+    if (targetIndex >= 0 && targetInverseMass > 0.0f)
+    {
+        bodies.Wake(targetIndex);
+        bodies.velocityX[targetIndex] += normal.x * impulse * targetInverseMass;
+        bodies.velocityY[targetIndex] += normal.y * impulse * targetInverseMass;
+    }
+}
+
+// ========== 스냅샷 ==========
+
+namespace
+{
+    const uint32_t SnapshotVersion = 3;
+
+    struct SnapshotHeader
+    {
+        uint32_t version = SnapshotVersion;
+        uint32_t bodyCount = 0;
+        uint32_t colliderCount = 0;
+        uint32_t manifoldCount = 0;
+        uint32_t contactCount = 0;
+        uint32_t pairCount = 0;
+        int32_t sleepingBodyCount = 0;
+        uint32_t registryVersion = 0;  // 등록/해제 횟수 + 다음 콜라이더 ID (같은 등록 상태인지 확인)
+        uint32_t nextColliderId = 0;
+    };
+
+    // 접촉점 하나의 Warm Starting 값 (같은 pairKey가 연속이면 한 매니폴드)
+    struct SnapshotContact
+    {
+        uint64_t pairKey = 0;
+        uint32_t featureId = 0;
+        float normalImpulse = 0.0f;
+        float tangentImpulse = 0.0f;
+    };
+
+    // 스냅샷에 담는 BodyStore 실수 배열 (물성은 매 스텝 컴포넌트에서 다시 읽으므로 제외)
+    std::vector<float> BodyStore::* const SnapshotFloatArrays[] =
+    {
+        &BodyStore::positionX, &BodyStore::positionY, &BodyStore::rotation,
+        &BodyStore::previousX, &BodyStore::previousY,
+        &BodyStore::velocityX, &BodyStore::velocityY, &BodyStore::angularVelocity,
+        &BodyStore::forceX, &BodyStore::forceY, &BodyStore::torque,
+        &BodyStore::sleepTime
+    };
+
+    const size_t SnapshotFloatArrayCount = sizeof(SnapshotFloatArrays) / sizeof(SnapshotFloatArrays[0]);
+
+    // 헤더 기준 전체 크기
+    size_t ComputeSnapshotSize(const SnapshotHeader& header)
+    {
+        return sizeof(SnapshotHeader) +
+               sizeof(float) * SnapshotFloatArrayCount * header.bodyCount +
+               sizeof(uint32_t) * header.bodyCount +
+               sizeof(SnapshotContact) * header.contactCount +
+               sizeof(uint64_t) * header.pairCount;
+    }
+
+    template<typename T>
+    void WriteBytes(uint8_t*& cursor, const T* source, size_t count)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "snapshot data must be trivially copyable");
+        if (count > 0)
+            memcpy(cursor, source, sizeof(T) * count);
+        cursor += sizeof(T) * count;
+    }
+
+    template<typename T>
+    void ReadBytes(const uint8_t*& cursor, T* destination, size_t count)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "snapshot data must be trivially copyable");
+        if (count > 0)
+            memcpy(destination, cursor, sizeof(T) * count);
+        cursor += sizeof(T) * count;
+    }
+}
+
+void PhysicsSystem::SaveSnapshot(PhysicsSnapshot& outSnapshot) const
+{
+    const std::vector<ContactManifold>& manifolds = contactSolver.GetManifolds();
+
+    SnapshotHeader header;
+    header.bodyCount = static_cast<uint32_t>(bodies.GetCount());
+    header.colliderCount = static_cast<uint32_t>(registeredColliders.size());
+    header.pairCount = static_cast<uint32_t>(previousCollisionPairs.size());
+    header.sleepingBodyCount = sleepingBodyCount;
+    header.registryVersion = registryVersion;
+    header.nextColliderId = nextColliderId;
+
+    for (const ContactManifold& manifold : manifolds)
+    {
+        if (manifold.pointCount > 0)
+            header.manifoldCount++;
+        header.contactCount += static_cast<uint32_t>(manifold.pointCount);
+    }
+
+    const size_t bodyCount = header.bodyCount;
+
+    // 크기가 같으면 기존 버퍼 재사용
+    outSnapshot.data.resize(ComputeSnapshotSize(header));
+    uint8_t* cursor = outSnapshot.data.data();
+
+    WriteBytes(cursor, &header, 1);
+
+    for (std::vector<float> BodyStore::* field : SnapshotFloatArrays)
+        WriteBytes(cursor, (bodies.*field).data(), bodyCount);
+    WriteBytes(cursor, bodies.flags.data(), bodyCount);
+
+    // 접촉 캐시: 접촉점별 쌍 키/특징 ID/누적 충격량만 (접촉점 위치, 강체 정보, 재질은 다음 스텝에 다시 계산)
+    for (const ContactManifold& manifold : manifolds)
+    {
+        for (int i = 0; i < manifold.pointCount; i++)
+        {
+            SnapshotContact contact;
+            contact.pairKey = manifold.pairKey;
+            contact.featureId = manifold.points[i].featureId;
+            contact.normalImpulse = manifold.points[i].normalImpulse;
+            contact.tangentImpulse = manifold.points[i].tangentImpulse;
+            WriteBytes(cursor, &contact, 1);
+        }
+    }
+
+    // 이전 접촉 쌍 (이벤트/잠든 쌍 판정) - 키만
+    for (const ColliderPair& pair : previousCollisionPairs)
+        WriteBytes(cursor, &pair.key, 1);
+}
+
+bool PhysicsSystem::RestoreSnapshot(const PhysicsSnapshot& snapshot)
+{
+    if (snapshot.data.size() < sizeof(SnapshotHeader))
+        return false;
+
+    const uint8_t* cursor = snapshot.data.data();
+
+    SnapshotHeader header;
+    ReadBytes(cursor, &header, 1);
+
+    // 같은 강체/콜라이더가 같은 순서, 같은 ID로 등록되어 있어야 함 (접촉/쌍 키가 ID, 강체 인덱스 기준)
+    const size_t bodyCount = header.bodyCount;
+    if (header.version != SnapshotVersion ||
+        snapshot.data.size() != ComputeSnapshotSize(header) ||
+        bodyCount != static_cast<size_t>(bodies.GetCount()) ||
+        header.colliderCount != registeredColliders.size() ||
+        header.registryVersion != registryVersion ||
+        header.nextColliderId != nextColliderId)
+        return false;
+
+    // 쌍 키 → 콜라이더 포인터
+    auto makePair = [this](uint64_t key)
+    {
+        ColliderPair pair;
+        pair.key = key;
+        pair.firstCollider = collidersById[pair.GetFirstId()];
+        pair.secondCollider = collidersById[pair.GetSecondId()];
+        return pair;
+    };
+
+    for (std::vector<float> BodyStore::* field : SnapshotFloatArrays)
+        ReadBytes(cursor, (bodies.*field).data(), bodyCount);
+    ReadBytes(cursor, bodies.flags.data(), bodyCount);
+
+    // Transform은 SoA 자세로 (스텝이 끝나면 WriteBackBodies/SyncBodies로 같은 값, 다음 스텝 SyncBodies가 읽음)
+    for (size_t i = 0; i < bodyCount; i++)
+    {
+        Transform& transform = *bodies.transforms[i];
+        transform.SetPosition(bodies.positionX[i], bodies.positionY[i]);
+        transform.SetRotation(bodies.rotation[i]);
+    }
+
+    // 접촉점을 쌍 키로 묶어 매니폴드 복원 (충격량만, 다음 스텝이 접촉점을 다시 계산해 이어 받음)
+    // 다음 내로우페이즈가 읽는 값(쌍 키, 콜라이더, 접촉점 특징 ID/충격량)만 채움 (나머지는 다시 계산되므로 초기화하지 않음)
+    ContactManifold* manifolds = contactSolver.ResetManifolds(header.manifoldCount);
+    ContactManifold* manifold = nullptr;
+
+    for (size_t i = 0; i < header.contactCount; i++)
+    {
+        SnapshotContact contact;
+        ReadBytes(cursor, &contact, 1);
+
+        if (manifold == nullptr || contact.pairKey != manifold->pairKey)
+        {
+            manifold = (manifold == nullptr) ? manifolds : manifold + 1;
+            if (manifold == manifolds + header.manifoldCount)
+                return false;
+            ColliderPair pair = makePair(contact.pairKey);
+            manifold->pairKey = contact.pairKey;
+            manifold->colliderA = pair.firstCollider;
+            manifold->colliderB = pair.secondCollider;
+            manifold->pointCount = 0;
+        }
+
+        ContactPoint& point = manifold->points[manifold->pointCount++];
+        point.featureId = contact.featureId;
+        point.normalImpulse = contact.normalImpulse;
+        point.tangentImpulse = contact.tangentImpulse;
+    }
+
+    previousCollisionPairs.resize(header.pairCount);
+    for (ColliderPair& pair : previousCollisionPairs)
+    {
+        uint64_t key;
+        ReadBytes(cursor, &key, 1);
+        pair = makePair(key);
+    }
+
+    sleepingBodyCount = header.sleepingBodyCount;
+    contactEvents.clear();
+    queryTreeDirty = true;
+    rebuildSleepingContacts = true;
+    return true;
+}
+
+// ========== 결정적 실행 ==========
+
+uint64_t PhysicsSystem::ComputeStateChecksum() const
+{
+    // FNV-1a (32비트 값 단위), 실수는 비트 그대로 (0.0/-0.0도 구분)
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](uint32_t value)
+    {
+        hash = (hash ^ value) * 1099511628211ull;
+    };
+
+    const int bodyCount = bodies.GetCount();
+    mix(static_cast<uint32_t>(bodyCount));
+
+    for (const std::vector<float>* values : { &bodies.positionX, &bodies.positionY, &bodies.rotation,
+                                              &bodies.velocityX, &bodies.velocityY, &bodies.angularVelocity })
+    {
+        for (int i = 0; i < bodyCount; i++)
+        {
+            uint32_t bits;
+            memcpy(&bits, &(*values)[i], sizeof(bits));
+            mix(bits);
+        }
+    }
+
+    for (int i = 0; i < bodyCount; i++)
+        mix(bodies.flags[i]);
+
+    // 접촉 쌍 (콜라이더 ID)
+    mix(static_cast<uint32_t>(previousCollisionPairs.size()));
+    for (const ColliderPair& pair : previousCollisionPairs)
+    {
+        mix(pair.GetFirstId());
+        mix(pair.GetSecondId());
+    }
+
+    return hash;
+}
+
+void PhysicsSystem::SetStrictMath(bool enable)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+    // x64 UCRT는 FMA3 지원 CPU에서 초월 함수에 다른 구현을 사용 (마지막 비트가 머신마다 달라질 수 있음)
+    _set_FMA3_enable(enable ? 0 : 1);
+#else
+    (void)enable;
+#endif
 }
@@ -1,87 +1,519 @@
 #pragma once
-#include <unordered_set>
+#include <unordered_map>
 #include <vector>
 #include <DirectXMath.h>
+#include "Physics/BodyIntegrator.h"
+#include "Physics/BodyStore.h"
+#include "Physics/ContactSolver.h"
+#include "Physics/DynamicAABBTree.h"
+#include "Physics/IslandBuilder.h"
+#include "Physics/PhysicsProfiler.h"
+#include "Physics/PhysicsWorkerPool.h"
+#include "Physics/ShapeQuery.h"
+#include "Physics/SweepAndPrune.h"
+#include "Physics/SpatialHashGrid.h"
+#include "Physics/TimeOfImpact.h"
 
 using namespace DirectX;
 
 class GameObject;
+class Component;
 class BaseCollider;
 class Rigidbody2D;
 class Quadtree;
 
+// 브로드페이즈 방식
+enum class BroadphaseMode
+{
+    BruteForce,     // 모든 쌍 검사 O(N^2)
+    Quadtree,       // 매 스텝 재구축하는 Quadtree
+    DynamicTree,    // 증분 업데이트 동적 AABB 트리 (Fat AABB)
+    SweepAndPrune,  // 한 축 끝점 정렬 유지 (삽입 정렬, 횡스크롤용)
+    SpatialHash     // 균일 격자 공간 해시 (크기가 비슷한 다수의 작은 오브젝트용)
+};
+
+// 물리 상태 스냅샷 (PhysicsSystem::SaveSnapshot/RestoreSnapshot, 같은 등록 상태의 월드에서만 유효한 바이너리)
+// 롤백 넷코드처럼 매 프레임 저장할 때는 같은 객체를 재사용하면 할당이 없음
+struct PhysicsSnapshot
+{
+    std::vector<uint8_t> data;
+};
+
 class PhysicsSystem
 {
 public:
     PhysicsSystem();
     ~PhysicsSystem();
 
-    // Scene  GameObject Ʈ ޾  ùķ̼ 
-    void Step(const std::vector<GameObject*>& gameObjects, float deltaTime);
+    // 등록된 강체/콜라이더로 물리 시뮬레이션 수행 (GameObject 순회 없음)
+    void Step(float deltaTime);
 
+    // 등록 해제 + 모든 상태 초기화 (등록된 GameObject의 물리 월드 포인터도 해제)
     void Clear();
 
-    //  
-    float gravity = 500.0f;  // ߷ ӵ (ȼ/s^2)
-    
-    // Quadtree  
-    bool useQuadtree = true;  // ⺻ Ȱȭ
-    
-    // Quadtree 
-    float worldWidth = 4000.0f;   //  ʺ
-    float worldHeight = 4000.0f;  //  
+    // GameObject 등록/해제 (Scene에서 호출, 자식은 각각 등록)
+    // 등록된 GameObject에 이후 추가/제거되는 컴포넌트는 자동으로 반영됨
+    void AddGameObject(GameObject* gameObject);
+    void RemoveGameObject(GameObject* gameObject);
+
+    // 컴포넌트 등록/해제 (GameObject::AddComponent/RemoveComponent에서 호출)
+    // Rigidbody2D, BaseCollider, TilemapCollider(생성한 박스 전체) 외의 컴포넌트는 무시
+    void RegisterComponent(Component* component);
+    void UnregisterComponent(Component* component);
+
+    // 강체 상태 SoA 저장소 (Rigidbody2D 핸들이 접근)
+    BodyStore& GetBodyStore() { return bodies; }
+    const BodyStore& GetBodyStore() const { return bodies; }
+
+    int GetBodyCount() const { return bodies.GetCount(); }
+    int GetColliderCount() const { return static_cast<int>(registeredColliders.size()); }
+
+    // 물리 설정
+    float gravity = 500.0f;  // 중력 가속도 (픽셀/s^2)
+    float maxVelocity = 1000.0f;  // 최대 속도 (터널링 방지, CCD 강체는 제외)
+
+    // CCD (Rigidbody2D::useCCD 강체만, 이들은 maxVelocity 제한을 받지 않음)
+    // - 위치 적분 후 스윕 AABB로 동적/정적 AABB 트리에서 후보를 찾고 Conservative Advancement로 충돌 시점 계산
+    // - 첫 충돌 시점까지 이동 → 법선 방향 속도 반응 → 남은 시간으로 다시 스윕 (최대 maxCCDSubSteps회)
+    // - 자기 두께의 절반도 못 움직이는 강체는 건너뜀, 얕게 겹친 상태면 형태 중심부(없으면 중심점)로 계산
+    // - 이번 스텝 이산 접촉이 있는 대상은 접촉 법선 방향으로 자기 반 두께 이상 파고들 때만 검사
+    // - 충돌 쌍은 그 스텝의 접촉 이벤트에 포함됨
+    int maxCCDSubSteps = 4;
+
+    // 지난 스텝 CCD 충돌 수
+    int GetCCDHitCount() const { return ccdHitCount; }
+
+    // 강체 적분을 SSE로 4개씩 처리 (false = 스칼라, 결과 동일)
+    bool useSIMDIntegration = true;
+
+    // 접촉 솔버 설정 (속도 반복 횟수, Warm Starting, 침투 보정)
+    ContactSolverSettings solverSettings;
+
+    // ========== 충돌 레이어 ==========
+    // - 두 콜라이더는 레이어 충돌 행렬이 허용하고, 서로의 collisionMask에 상대 레이어가 있을 때만 판정
+    // - 브로드페이즈 후보 단계에서 비트 AND로 걸러 내로우페이즈(타입 판별, SAT)에 넘기지 않음
+    // - 행렬은 대칭 (기본 전체 허용), Clear로 초기화되지 않음
+    static const int MaxLayers = 32;
+
+    void SetLayerCollision(int layerA, int layerB, bool collide);
+    bool GetLayerCollision(int layerA, int layerB) const;
+
+    // 행렬 한 행 (layer와 충돌하는 레이어 비트, 설정 시 대칭으로 반영)
+    void SetLayerCollisionMask(int layer, uint32_t mask);
+    uint32_t GetLayerCollisionMask(int layer) const;
+
+    // 지난 스텝 후보 쌍 수 (레이어 필터 후, 트리거 쌍 제외 = 내로우페이즈 판정 수)
+    int GetCandidatePairCount() const { return static_cast<int>(candidatePairs.size()); }
+
+    // 지난 스텝 트리거 후보 쌍 수 (한쪽이라도 Trigger, 겹침만 판정)
+    int GetTriggerPairCount() const { return static_cast<int>(triggerPairs.size()); }
+
+    // ========== 충돌 이벤트 ==========
+    // - 스텝 중에는 접촉 쌍 비교 결과(Enter/Stay/Exit)만 이벤트 버퍼에 모으고,
+    //   Transform 기록까지 끝난 스텝 마지막에 한 번에 전달 (솔버 도중 콜백 없음)
+    // - 양쪽 GameObject 모두 해당 콜백을 재정의한 컴포넌트가 없으면 버퍼에 넣지 않음
+    // - 콜백 안에서 콜라이더/GameObject를 제거하면 남은 이벤트 중 그 콜라이더의 것은 건너뜀
+
+    // 지난 스텝 전달한 이벤트 수 (콜라이더 쌍 단위)
+    int GetContactEventCount() const { return static_cast<int>(contactEvents.size()); }
+
+    // ========== 공간 쿼리 ==========
+    // - 동적/정적 AABB 트리로 후보를 찾은 뒤 형태 판정 (브로드페이즈 방식과 무관)
+    // - 트리는 스텝 후 첫 쿼리에서 한 번 갱신, 그 사이 Transform을 직접 옮겼으면 SyncTransforms 호출
+    // - 결과는 호출자 버퍼에 기록 (할당 없음), layerMask = 검사할 레이어 비트 조합
+    // - direction은 정규화해서 사용 (0 벡터면 히트 없음)
+    static const uint32_t AllLayers = 0xFFFFFFFFu;
+
+    // 가장 가까운 히트
+    bool Raycast(const XMFLOAT2& origin, const XMFLOAT2& direction, float maxDistance,
+                 RaycastHit& outHit, uint32_t layerMask = AllLayers);
+
+    // 모든 히트 (가까운 순 최대 maxHits개, 반환값 = 기록한 개수)
+    int RaycastAll(const XMFLOAT2& origin, const XMFLOAT2& direction, float maxDistance,
+                   RaycastHit* outHits, int maxHits, uint32_t layerMask = AllLayers);
+
+    // 원/박스를 direction으로 이동시켜 처음 닿는 콜라이더 (박스는 회전 고정)
+    bool CircleCast(const XMFLOAT2& origin, float radius, const XMFLOAT2& direction, float maxDistance,
+                    RaycastHit& outHit, uint32_t layerMask = AllLayers);
+    bool BoxCast(const XMFLOAT2& center, const XMFLOAT2& halfSize, float angle, const XMFLOAT2& direction,
+                 float maxDistance, RaycastHit& outHit, uint32_t layerMask = AllLayers);
+
+    // 겹치는 콜라이더 (반환값 = 기록한 개수)
+    int OverlapPoint(const XMFLOAT2& point, BaseCollider** outColliders, int maxColliders,
+                     uint32_t layerMask = AllLayers);
+    int OverlapCircle(const XMFLOAT2& center, float radius, BaseCollider** outColliders, int maxColliders,
+                      uint32_t layerMask = AllLayers);
+    int OverlapBox(const XMFLOAT2& center, const XMFLOAT2& halfSize, float angle, BaseCollider** outColliders,
+                   int maxColliders, uint32_t layerMask = AllLayers);
+
+    // 쿼리 트리를 현재 Transform 기준으로 갱신
+    void SyncTransforms();
+
+    // 쿼리가 Trigger 콜라이더도 검사할지
+    bool queriesHitTriggers = true;
+
+    // 수면 (접촉 섬 전체가 timeToSleep 동안 기준 속도 이하이면 함께 재움)
+    // 잠든 섬은 적분/접촉 판정/풀이를 생략하고, 힘/속도 설정, Transform 변경,
+    // 깨어 있는 강체와의 접촉으로 깨어남
+    bool allowSleeping = true;
+    float sleepLinearVelocity = 2.0f;     // 픽셀/s
+    float sleepAngularVelocity = 0.05f;   // rad/s
+    float timeToSleep = 0.5f;             // 초
+
+    // 지난 스텝에서 잠들어 건너뛴 강체 수 / 섬 수
+    int GetSleepingBodyCount() const { return sleepingBodyCount; }
+    int GetIslandCount() const { return islands.GetIslandCount(); }
+
+    // 내로우페이즈 스레드 수 (0 = 하드웨어 스레드 수, 1 = 단일 스레드 디버깅용)
+    // 스레드 수와 관계없이 접촉/이벤트 순서는 후보 쌍 정렬 순서로 동일
+    int threadCount = 0;
+
+    // 이번 스텝 접촉 매니폴드 (디버그/통계용)
+    const std::vector<ContactManifold>& GetContactManifolds() const { return contactSolver.GetManifolds(); }
+
+    // ========== 스냅샷 ==========
+    // - 강체 SoA 상태(위치, 속도, 누적 힘, 수면 플래그/타이머, 복원 시 Transform에도 기록)와
+    //   접촉 캐시(접촉점별 쌍 키/특징 ID/누적 충격량, 이전 접촉 쌍 키)를 배열 단위 memcpy로 저장/복원 (JSON 거치지 않음)
+    // - 물성(질량, 마찰 등), 접촉점 위치, 브로드페이즈 트리는 저장하지 않음 (다음 스텝에 다시 계산, 트리는 결과에 영향 없음)
+    // - 저장 때와 같은 강체/콜라이더가 같은 순서, 같은 ID로 등록되어 있어야 복원 (아니면 false, 상태 변경 없음)
+    // - 복원 후 같은 입력으로 스텝하면 저장 이후와 비트 단위로 같은 결과 (스텝 밖에서 호출)
+    void SaveSnapshot(PhysicsSnapshot& outSnapshot) const;
+    bool RestoreSnapshot(const PhysicsSnapshot& snapshot);
+
+    // ========== 결정적 실행 (락스텝) ==========
+    // - 후보/접촉 쌍, 접촉 매니폴드, CCD 후보는 콜라이더 등록 ID 순, 강체는 BodyStore 인덱스(등록 순)로 처리
+    //   (포인터 주소, 해시 순회 순서, 스레드 수와 무관) → 같은 순서로 등록하고 같은 입력을 주면 실행마다 같은 결과
+    // - 다른 머신과 맞출 때는 같은 빌드(x64, /fp:precise)에서 SetStrictMath(true) 후 실행
+    // - ComputeStateChecksum: 강체 위치/회전/속도/플래그와 접촉 쌍의 해시 (스텝마다 비교해 처음 어긋난 프레임 확인)
+    uint64_t ComputeStateChecksum() const;
+
+    // CRT 수학 함수(sinf, cosf 등)가 CPU 기능(FMA3)에 따라 다른 구현을 고르지 않도록 고정 (프로세스 전역, MSVC x64만)
+    static void SetStrictMath(bool enable);
+
+    // ========== 스텝 프로파일러 ==========
+    // - 켜면 스텝마다 구간별 시간(적분, 수집, 브로드페이즈 구축/쿼리, 내로우페이즈, 풀이, CCD, 이벤트)과
+    //   카운터(강체, 콜라이더, 후보 쌍, 접촉, 이벤트, Quadtree 노드 수 등)를 최근 N스텝 링 버퍼에 기록
+    // - 끄면 구간마다 bool 검사 하나 외에 비용 없음 (시계 읽기/기록 없음)
+    // - 이벤트 콜백 안에서 켜고 끈 것은 다음 스텝부터 반영
+    bool profileSteps = false;
+
+    // 기록 보관 스텝 수 (기본 120, 변경 시 기록 초기화)
+    void SetProfileHistorySize(int size) { profiler.SetHistorySize(size); }
+
+    // 기록 조회 (GetStats(0) = 가장 최근 스텝, ComputeAverage(n) = 최근 n스텝 평균)
+    const PhysicsProfiler& GetProfiler() const { return profiler; }
+
+    // 브로드페이즈 방식 (동적 콜라이더끼리, 적으면 항상 Brute Force)
+    // Rigidbody2D 없는 정적 콜라이더는 방식과 무관하게 별도 정적 트리에 유지 (정적끼리는 쌍 없음)
+    BroadphaseMode broadphaseMode = BroadphaseMode::Quadtree;
+
+    // Sweep and Prune 스텝 통계 (교환 횟수, 후보 쌍 수)
+    const SweepAndPrune::Stats& GetSweepAndPruneStats() const { return sweepAndPrune.GetStats(); }
+
+    // Sweep and Prune 정렬 축 (false = X축, true = Y축)
+    void SetSweepAlongY(bool alongY) { sweepAndPrune.sortAlongY = alongY; }
+
+    // Spatial Hash 스텝 통계 (셀 수, 후보 쌍 수)
+    const SpatialHashGrid::Stats& GetSpatialHashStats() const { return spatialHash.GetStats(); }
+
+    // Spatial Hash 셀 크기 (픽셀)
+    void SetSpatialHashCellSize(float cellSize) { spatialHash.cellSize = cellSize; }
+
+    // Quadtree 초기 영역 (밖으로 나간 콜라이더는 루트 자동 확장, 변경 시 다음 스텝에 반영)
+    float worldWidth = 4000.0f;   // 월드 너비
+    float worldHeight = 4000.0f;  // 월드 높이
+
+    // Quadtree 통계 (오브젝트 수, 깊이, 노드 수)
+    const Quadtree* GetQuadtree() const { return quadtree; }
 
 private:
+    // 콜라이더 쌍 (first = ID가 작은 쪽, key = 상위 32비트 first ID | 하위 32비트 second ID)
+    // 정렬/비교는 key만 사용 (포인터 주소와 무관, 삭제된 콜라이더도 역참조하지 않음)
     struct ColliderPair
     {
         BaseCollider* firstCollider = nullptr;
         BaseCollider* secondCollider = nullptr;
+        uint64_t key = 0;
+
+        uint32_t GetFirstId() const { return static_cast<uint32_t>(key >> 32); }
+        uint32_t GetSecondId() const { return static_cast<uint32_t>(key); }
+
+        bool operator==(const ColliderPair& other) const { return key == other.key; }
 
-        bool operator==(const ColliderPair& other) const
-        {
-            return firstCollider == other.firstCollider && secondCollider == other.secondCollider;
-        }
+        // 정렬 배열 병합 비교용
+        bool operator<(const ColliderPair& other) const { return key < other.key; }
     };
 
-    struct ColliderPairHasher
+    enum class ContactEventType : uint8_t
     {
-        size_t operator()(const ColliderPair& value) const
-        {
-            size_t firstHash = std::hash<void*>()(value.firstCollider);
-            size_t secondHash = std::hash<void*>()(value.secondCollider);
-            return firstHash ^ (secondHash + 0x9e3779b97f4a7c15ULL + (firstHash << 6) + (firstHash >> 2));
-        }
+        Enter,
+        Stay,
+        Exit
     };
 
-private:
-    // Rigidbody  Ʈ
-    void UpdateRigidbodies(const std::vector<GameObject*>& gameObjects, float deltaTime);
+    // 솔버용 접촉 생성 결과 (NotSolved = 솔버 대상이 아닌 쌍, 겹침은 따로 판정)
+    enum class ContactBuildResult : uint8_t
+    {
+        NotSolved,
+        Separated,
+        Touching
+    };
 
-    // 浹 ˻ (Brute Force)
-    void CheckCollisionsBruteForce(const std::vector<BaseCollider*>& colliders);
+    // 스텝 마지막에 전달할 충돌 이벤트 (callback = CollisionCallback 비트 하나)
+    struct ContactEvent
+    {
+        BaseCollider* colliderA = nullptr;
+        BaseCollider* colliderB = nullptr;
+        uint32_t callback = 0;
+    };
+
+    // CCD 대상 스텝 스윕 캐시 (콜라이더 ID 인덱스, stamp가 이번 CCD 단계와 같을 때만 유효)
+    // CCD가 아닌 대상은 단계 동안 움직이지 않고, CCD 콜라이더는 처리해 위치가 바뀌면 다시 계산
+    struct CCDTargetSweep
+    {
+        ShapeSweep sweep;
+        AABB bounds;                  // 스텝 스윕 범위 (여유 없음)
+        float rotationReach = 0.0f;   // ShapeSweep::GetRotationReach
+        float boundingRadius = 0.0f;  // 회전 중심을 감싸는 원 반지름 (어떤 회전에도 형태 포함)
+        float minExtent = 0.0f;       // ShapeSweep::GetMinExtent
+        uint32_t stamp = 0;
+        bool valid = false;           // 쿼리 형태로 만들 수 있는 콜라이더
+        bool moving = false;          // 이동/회전이 있는 스윕
+        bool continuous = false;      // 이번 단계 CCD 콜라이더 (ccdSweepTree로만 후보가 됨)
+    };
+
+    // 내로우페이즈 워커별 결과 (구간 순서대로 이어 붙이면 단일 스레드와 같은 순서)
+    struct NarrowphaseBuffer
+    {
+        std::vector<ColliderPair> touchingPairs;  // 겹치는 쌍 (이벤트용)
+        std::vector<ContactManifold> manifolds;   // 솔버 접촉
+        std::vector<ColliderPair> triggerTouchingPairs;  // 겹치는 트리거 쌍 (이벤트용)
+    };
+
+    // 강체/콜라이더 등록 (GetComponent는 등록 시에만 사용)
+    void RegisterBody(Rigidbody2D* body);
+    void UnregisterBody(Rigidbody2D* body);
+    void RegisterCollider(BaseCollider* collider);
+    void UnregisterCollider(BaseCollider* collider);
+
+    // 컴포넌트 설정 + Transform → BodyStore 동기화
+    void SyncBodies();
+
+    // 강체 적분 설정 (BodyIntegrator 속도/위치 단계 공용)
+    IntegrationSettings MakeIntegrationSettings(float deltaTime) const;
+
+    // BodyStore 위치/회전 → Transform (한 번에 기록)
+    void WriteBackBodies();
+
+    // 브로드페이즈: 후보 쌍 수집 (Brute Force)
+    void GatherPairsBruteForce();
     
-    // 浹 ˻ (Quadtree)
-    void CheckCollisionsWithQuadtree(const std::vector<BaseCollider*>& colliders);
+    // 브로드페이즈: 후보 쌍 수집 (Quadtree)
+    void GatherPairsWithQuadtree();
+
+    // 브로드페이즈: 후보 쌍 수집 (Dynamic AABB Tree)
+    void GatherPairsWithDynamicTree();
+
+    // 브로드페이즈: 후보 쌍 수집 (Sweep and Prune)
+    void GatherPairsWithSweepAndPrune();
+
+    // 브로드페이즈: 후보 쌍 수집 (Spatial Hash)
+    void GatherPairsWithSpatialHash();
+
+    // 레이어 충돌 필터 (스텝 시작 시 계산한 pairMask 비교)
+    static bool CanCollide(const BaseCollider* colliderA, const BaseCollider* colliderB);
+
+    // 동적 트리 프록시 동기화 (추가/이동/제거, activeColliders에 없는 프록시는 제거)
+    void UpdateDynamicTree(const std::vector<BaseCollider*>& activeColliders);
+
+    // 정적 콜라이더 (Rigidbody2D 없음) - 정적 트리에만 들어가고 정적끼리는 쌍을 만들지 않음
+    static bool IsStaticCollider(const BaseCollider* collider);
+
+    // 정적 트리 프록시 동기화 (활성 정적이면 추가 또는 벗어났을 때만 재삽입, 아니면 제거)
+    void UpdateStaticProxy(BaseCollider* collider);
+    void RemoveStaticProxy(BaseCollider* collider);
+
+    // 브로드페이즈: 동적 콜라이더 ↔ 정적 트리 후보 쌍 추가 (방식과 무관)
+    void GatherStaticPairs();
+
+    // 정렬된 후보 쌍에서 트리거 쌍을 triggerPairs로 분리 (두 배열 모두 정렬 유지)
+    void SplitTriggerPairs();
+
+    // 쿼리 전 트리 갱신 (스텝/등록 변경 후 한 번)
+    void EnsureQueryTree();
+
+    // 레이어/트리거/활성 필터
+    bool PassesQueryFilter(BaseCollider* collider, uint32_t layerMask) const;
+
+    // 가장 가까운 캐스트 히트 (cast(shape, maxDistance, hit)가 형태 판정)
+    template<typename CastFunc>
+    bool CastClosest(const XMFLOAT2& origin, const XMFLOAT2& direction, float maxDistance,
+                     const XMFLOAT2& extents, uint32_t layerMask, RaycastHit& outHit, CastFunc&& cast);
+
+    // 범위 AABB 후보 중 test(shape)를 통과한 콜라이더 기록
+    template<typename TestFunc>
+    int OverlapShape(const AABB& bounds, uint32_t layerMask, BaseCollider** outColliders, int maxColliders,
+                     TestFunc&& test);
+
+    // 쌍 pairCount개를 나눌 구간 수 (워커 수/버퍼 준비)
+    int PrepareNarrowphaseSlices(size_t pairCount);
+
+    // 내로우페이즈: 후보 쌍을 연속 구간으로 나눠 워커별 버퍼에 판정 (병렬)
+    void RunNarrowphase();
+
+    // 후보 쌍 [begin, end) 판정 (읽기 전용, 워커 스레드에서 실행)
+    void NarrowphaseRange(size_t begin, size_t end, NarrowphaseBuffer& outBuffer) const;
+
+    // 양쪽 모두 잠들었거나 정적인 쌍 (적어도 한쪽은 잠든 강체)
+    bool IsSleepingPair(const ColliderPair& pair) const;
+
+    // 트리거 쌍 겹침 판정 (매니폴드 없이 bool만, 스텝당 한 번, 워커 병렬) 후 접촉 쌍에 병합
+    void UpdateTriggerOverlaps();
+
+    // 트리거 쌍 [begin, end) 겹침 판정 (읽기 전용, 워커 스레드에서 실행)
+    void TriggerRange(size_t begin, size_t end, std::vector<ColliderPair>& outTouchingPairs) const;
+
+    // 솔버용 접촉 생성 (정적/움직일 수 없는 쌍은 NotSolved, 트리거 쌍은 들어오지 않음)
+    // 접촉 생성 결과가 곧 이벤트용 겹침 판정 (Touching일 때만 outManifold 유효)
+    // keepPrevious = 접촉점 계산 없이 강체 정보만 채움 (pointCount = 0, 이전 접촉 유지)
+    ContactBuildResult BuildContact(const ColliderPair& pair, bool keepPrevious, ContactManifold& outManifold) const;
+
+    // 내로우페이즈 접촉을 구간 순서대로 솔버에 넣고 Sequential Impulse 풀이
+    void SolveContacts(float deltaTime);
+
+    // 접촉 섬 구성 후 깨어 있는 강체가 있는 섬 깨우기 (솔버 전)
+    void WakeIslands();
+
+    // 수면 타이머 갱신 후 멈춘 섬 재우기 (솔버 후)
+    void UpdateSleep(float deltaTime);
 
-    // 浹   ̺Ʈ
+    // 콜라이더에 연결된 강체 깨우기 (접촉 종료 시)
+    void WakeAttachedBody(BaseCollider* collider);
+
+    // 매니폴드 강체 정보 (BodyStore 인덱스, 회전 중심, 역질량/역관성)
+    void SetupManifoldBody(BaseCollider* collider, Rigidbody2D* body, int& outIndex, XMFLOAT2& outCenter,
+                           float& outInverseMass, float& outInverseInertia) const;
+
+    // 접촉 쌍 이전/현재 비교 후 Enter/Stay/Exit 이벤트를 버퍼에 수집
+    void CollectContactEvents();
+
+    // 수집한 이벤트 전달 (스텝 마지막, Transform 기록 후)
+    void DispatchContactEvents();
+
+    // 충돌 감지 및 이벤트
     static ColliderPair MakeSortedPair(BaseCollider* colliderA, BaseCollider* colliderB);
-    static void NotifyEnter(BaseCollider* colliderA, BaseCollider* colliderB);
-    static void NotifyStay(BaseCollider* colliderA, BaseCollider* colliderB);
-    static void NotifyExit(BaseCollider* colliderA, BaseCollider* colliderB);
+    void QueueEvent(BaseCollider* colliderA, BaseCollider* colliderB, ContactEventType type);
+    static void NotifyEvent(BaseCollider* collider, BaseCollider* other, uint32_t callback);
+    bool IsRemovedDuringDispatch(BaseCollider* collider) const;
 
-    // 浹 ݹ߷  (Collision, Trigger )
-    static void ResolveCollision(BaseCollider* colliderA, BaseCollider* colliderB);
-    
-    // CCD (Continuous Collision Detection) - Swept AABB
-    static bool CheckCCDCollision(
-        BaseCollider* moving,
-        BaseCollider* target,
-        const XMFLOAT2& oldPos,
-        const XMFLOAT2& newPos,
-        float& outTOI  // Time of Impact (0~1)
-    );
+    // CCD: useCCD 강체를 첫 충돌 시점까지 서브스텝 (위치 적분 후, 이벤트/Transform 기록 전)
+    void SolveContinuous(float deltaTime);
+
+    // CCD 강체 하나 (ccdColliders[colliderBegin, colliderEnd) = 이 강체의 콜라이더, 충돌해 위치가 바뀌면 true)
+    bool AdvanceContinuousBody(int index, size_t colliderBegin, size_t colliderEnd, float deltaTime);
+
+    // 프로파일러 구간 경계 (이번 스텝을 프로파일 중일 때만 시계 읽기)
+    void ProfileMark(PhysicsPhase phase)
+    {
+        if (profilingStep)
+            profiler.Mark(phase);
+    }
+
+    // 프로파일한 스텝의 카운터 기록
+    void CommitStepStats();
+
+    // CCD 대상의 스텝 스윕 (시작 자세 → 적분 후 자세, 정적/Kinematic/잠든 강체는 이동 없음)
+    bool MakeTargetSweep(BaseCollider* target, ShapeSweep& outSweep) const;
+
+    // CCD 대상 스윕 캐시 갱신 / 이번 단계 값 (없으면 계산)
+    CCDTargetSweep& UpdateCCDTargetSweep(BaseCollider* target, bool continuous);
+    const CCDTargetSweep& GetCCDTargetSweep(BaseCollider* target);
+
+    // 충돌 시점 속도 반응 (법선 방향 접근 속도 제거 + 반발, 대상 강체에는 반작용)
+    void ApplyContinuousImpulse(int index, BaseCollider* target, const XMFLOAT2& normal);
 
 private:
-    std::unordered_set<ColliderPair, ColliderPairHasher> previousCollisionPairs;
-    Quadtree* quadtree;  // Quadtree νϽ
+    // 등록 목록 (Step은 이 목록만 순회)
+    BodyStore bodies;
+    std::vector<BaseCollider*> registeredColliders;   // 인덱스 = BaseCollider::registryIndex
+    uint32_t nextColliderId = 1;                      // 다음 등록 콜라이더 ID (Clear 시 1로)
+    std::vector<BaseCollider*> collidersById{ nullptr }; // 인덱스 = 콜라이더 ID (해제된 ID는 nullptr, 쌍 키 → 포인터)
+    uint32_t registryVersion = 0;                     // 강체/콜라이더 등록·해제마다 증가 (스냅샷 등록 상태 확인)
+    std::vector<GameObject*> registeredObjects;       // 물리 월드 포인터를 설정한 GameObject
+
+    // 스텝별 버퍼 (매 스텝 재사용, 쌍 배열은 항상 정렬 상태)
+    std::vector<BaseCollider*> colliders;             // 이번 스텝 활성 동적 콜라이더 (Rigidbody2D 연결)
+    std::vector<BaseCollider*> staticColliders;       // 이번 스텝 활성 정적 콜라이더
+    std::vector<ColliderPair> candidatePairs;         // 브로드페이즈 후보 쌍 (중복 없음, 트리거 쌍 제외)
+    std::vector<ColliderPair> triggerPairs;           // 브로드페이즈 트리거 후보 쌍 (솔버를 거치지 않음)
+    std::vector<ColliderPair> currentCollisionPairs;  // 이번 스텝 접촉 쌍
+    std::vector<ColliderPair> previousCollisionPairs; // 이전 스텝 접촉 쌍
+    std::vector<ContactEvent> contactEvents;          // 이번 스텝 이벤트 (스텝 마지막에 전달)
+    std::vector<BaseCollider*> removedDuringDispatch; // 이벤트 전달 중 등록 해제된 콜라이더
+    bool dispatchingEvents = false;
+    std::vector<BaseCollider*> queryResults;          // Quadtree 쿼리 결과
+
+    // 레이어 충돌 행렬 (행 = 레이어, 비트 = 충돌하는 상대 레이어)
+    uint32_t layerCollisionMatrix[MaxLayers];
+
+    // 내로우페이즈 (워커 수만큼 버퍼 유지)
+    std::vector<NarrowphaseBuffer> narrowphaseBuffers;
+    PhysicsWorkerPool workerPool;
+
+    // CCD (스텝별 버퍼 재사용)
+    std::vector<BaseCollider*> ccdColliders;          // CCD 강체 콜라이더 (강체 인덱스 순)
+    DynamicAABBTree ccdSweepTree;                     // CCD 콜라이더 스텝 스윕 범위 (CCD 강체끼리 후보 검색)
+    std::vector<int> ccdSweepProxies;                 // ccdColliders별 ccdSweepTree 프록시
+    std::vector<BaseCollider*> ccdCandidates;         // 콜라이더 하나의 스윕 범위 후보 (중복 없음)
+    std::vector<CCDTargetSweep> ccdTargetSweeps;      // 콜라이더 ID별 대상 스윕 캐시
+    uint32_t ccdSweepStamp = 0;                       // CCD 단계마다 증가
+    bool ccdHasDynamicTargets = false;                // CCD가 아닌 움직이는 콜라이더가 있는지 (없으면 동적 트리 검색 생략)
+    std::vector<ColliderPair> ccdHitPairs;            // 이번 스텝 CCD 충돌 쌍 (이벤트용)
+    int ccdHitCount = 0;
+
+    // 접촉 섬 / 수면
+    IslandBuilder islands;
+    std::vector<unsigned char> islandAwake;
+    std::vector<float> islandSleepTime;
+    int sleepingBodyCount = 0;
+
+    // 공간 쿼리 (Dynamic AABB Tree 공유)
+    std::vector<BaseCollider*> queryColliders;        // 쿼리 트리 갱신용 활성 동적 콜라이더
+    bool queryTreeDirty = true;
+
+    Quadtree* quadtree;  // Quadtree 인스턴스
+    float quadtreeWidth = 0.0f;   // Quadtree를 만든 월드 크기 (변경 감지용)
+    float quadtreeHeight = 0.0f;
+
+    // Dynamic AABB Tree (스텝 간 유지)
+    struct TreeProxy
+    {
+        int proxyId = DynamicAABBTree::NullNode;
+        unsigned int stamp = 0;      // 마지막으로 확인된 스텝
+        XMFLOAT2 center{0.0f, 0.0f}; // 이전 스텝 AABB 중심 (변위 계산용)
+    };
+
+    DynamicAABBTree dynamicTree;
+    std::unordered_map<BaseCollider*, TreeProxy> treeProxies;
+    std::vector<int> staleProxies;                    // 이번 스텝 제거할 프록시 (ID 순 정렬)
+
+    // 정적 콜라이더 트리 (추가/제거/이동 시에만 변경, 프록시 ID는 BaseCollider::staticProxyId)
+    DynamicAABBTree staticTree;
+
+    // 접촉 솔버 (매니폴드/누적 충격량 스텝 간 유지)
+    ContactSolver contactSolver;
+
+    // 스냅샷 복원 직후 스텝: 잠든 쌍도 접촉점을 다시 계산 (복원한 접촉에는 충격량만 있음)
+    bool rebuildSleepingContacts = false;
+
+    // Sweep and Prune (끝점 배열 스텝 간 유지)
+    SweepAndPrune sweepAndPrune;
+
+    // Spatial Hash (테이블 스텝 간 재사용)
+    SpatialHashGrid spatialHash;
+    unsigned int stepCount = 0;
+
+    // 스텝 프로파일러 (profilingStep = 이번 스텝 시작 시 profileSteps)
+    PhysicsProfiler profiler;
+    bool profilingStep = false;
 };
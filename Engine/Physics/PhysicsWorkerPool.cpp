@@ -0,0 +1,107 @@
+#include "Physics/PhysicsWorkerPool.h"
+
+PhysicsWorkerPool::~PhysicsWorkerPool()
+{
+    StopThreads();
+}
+
+void PhysicsWorkerPool::Resize(int workerCount)
+{
+    if (workerCount < 1)
+        workerCount = 1;
+
+    if (workerCount == GetWorkerCount())
+        return;
+
+    StopThreads();
+
+    // 워커 번호 1..workerCount-1 (0은 호출 스레드)
+    for (int i = 1; i < workerCount; i++)
+    {
+        threads.emplace_back(&PhysicsWorkerPool::WorkerLoop, this, i);
+    }
+}
+
+void PhysicsWorkerPool::Run(int sliceCount, const std::function<void(int)>& job)
+{
+    if (sliceCount <= 0)
+        return;
+
+    if (sliceCount > GetWorkerCount())
+        sliceCount = GetWorkerCount();
+
+    // 구간이 하나면 스레드 동기화 없이 바로 실행
+    if (sliceCount == 1)
+    {
+        job(0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        currentJob = &job;
+        currentSliceCount = sliceCount;
+        pendingCount = sliceCount - 1;
+        generation++;
+    }
+    startCondition.notify_all();
+
+    // 호출 스레드도 구간 0을 처리
+    job(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    doneCondition.wait(lock, [this]() { return pendingCount == 0; });
+    currentJob = nullptr;
+}
+
+void PhysicsWorkerPool::WorkerLoop(int workerIndex)
+{
+    unsigned int seenGeneration = 0;
+
+    while (true)
+    {
+        const std::function<void(int)>* job = nullptr;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            startCondition.wait(lock, [&]() { return stopping || generation != seenGeneration; });
+
+            if (stopping)
+                return;
+
+            seenGeneration = generation;
+
+            // 이번 작업의 구간 수보다 번호가 크면 참여하지 않음
+            if (workerIndex >= currentSliceCount)
+                continue;
+
+            job = currentJob;
+        }
+
+        (*job)(workerIndex);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pendingCount--;
+        }
+        doneCondition.notify_one();
+    }
+}
+
+void PhysicsWorkerPool::StopThreads()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    startCondition.notify_all();
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    threads.clear();
+
+    stopping = false;
+    generation = 0;
+}
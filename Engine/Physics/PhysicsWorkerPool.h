@@ -0,0 +1,44 @@
+#pragma once
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 물리 병렬 작업용 고정 워커 풀
+// - 스레드는 Resize 때만 생성/종료 (스텝마다 생성하지 않음)
+// - Run(n, job): 구간 0은 호출 스레드가, 1..n-1은 워커가 실행하고 모두 끝날 때까지 대기
+// - 구간 번호 = 워커 번호이므로 구간별 버퍼를 워커 간 잠금 없이 사용 가능
+class PhysicsWorkerPool
+{
+public:
+    PhysicsWorkerPool() = default;
+    ~PhysicsWorkerPool();
+
+    PhysicsWorkerPool(const PhysicsWorkerPool&) = delete;
+    PhysicsWorkerPool& operator=(const PhysicsWorkerPool&) = delete;
+
+    // 호출 스레드 포함 실행 단위 수 (1 = 워커 없음)
+    void Resize(int workerCount);
+    int GetWorkerCount() const { return static_cast<int>(threads.size()) + 1; }
+
+    // job(sliceIndex)를 [0, sliceCount) 구간마다 한 번씩 실행 (sliceCount <= GetWorkerCount())
+    void Run(int sliceCount, const std::function<void(int)>& job);
+
+private:
+    void WorkerLoop(int workerIndex);
+    void StopThreads();
+
+private:
+    std::vector<std::thread> threads;
+
+    std::mutex mutex;
+    std::condition_variable startCondition;
+    std::condition_variable doneCondition;
+
+    const std::function<void(int)>* currentJob = nullptr;
+    int currentSliceCount = 0;
+    unsigned int generation = 0;   // Run 호출마다 증가 (워커 깨움 판별)
+    int pendingCount = 0;          // 아직 끝나지 않은 워커 구간 수
+    bool stopping = false;
+};
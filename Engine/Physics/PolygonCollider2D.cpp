@@ -0,0 +1,112 @@
+#include "PolygonCollider2D.h"
+#include "Physics/CollisionDispatch.h"
+#include "Core/GameObject.h"
+#include "Core/Transform.h"
+#ifndef ENGINE_HEADLESS
+#include "Graphics/DebugRenderer.h"
+#endif
+#include <algorithm>
+#include <cmath>
+
+using namespace DirectX;
+
+PolygonCollider2D::PolygonCollider2D() : BaseCollider(ColliderShapeType::Polygon)
+{
+    SetAsBox(16.0f, 16.0f);
+}
+
+bool PolygonCollider2D::SetPoints(const std::vector<XMFLOAT2>& points)
+{
+    if (!localPolygon.SetHull(points.data(), static_cast<int>(points.size())))
+        return false;
+
+    revision++;
+    return true;
+}
+
+std::vector<XMFLOAT2> PolygonCollider2D::GetPoints() const
+{
+    return std::vector<XMFLOAT2>(localPolygon.vertices, localPolygon.vertices + localPolygon.count);
+}
+
+void PolygonCollider2D::SetAsBox(float halfWidth, float halfHeight)
+{
+    SetPoints({ { -halfWidth, -halfHeight }, { halfWidth, -halfHeight }, { halfWidth, halfHeight }, { -halfWidth, halfHeight } });
+}
+
+void PolygonCollider2D::ComputeWorldShape(ColliderWorldShape& outShape) const
+{
+    XMFLOAT2 pos = gameObject->transform.GetPosition();
+    XMFLOAT2 scale = gameObject->transform.GetScale();
+    float rot = gameObject->transform.GetRotation();
+
+    float cosR = cosf(rot);
+    float sinR = sinf(rot);
+
+    XMFLOAT2 center = {
+        offset.x * cosR - offset.y * sinR + pos.x,
+        offset.x * sinR + offset.y * cosR + pos.y
+    };
+
+    ConvexPolygon& polygon = worldPolygon;
+    polygon.count = localPolygon.count;
+    polygon.radius = 0.0f;
+
+    for (int i = 0; i < localPolygon.count; i++)
+    {
+        float x = localPolygon.vertices[i].x * scale.x;
+        float y = localPolygon.vertices[i].y * scale.y;
+        polygon.vertices[i] = { x * cosR - y * sinR + center.x, x * sinR + y * cosR + center.y };
+    }
+
+    if (scale.x == scale.y && scale.x != 0.0f)
+    {
+        // 균일 스케일: 미리 계산한 법선을 회전만 (음수 스케일은 180도 회전과 같음)
+        float sign = (scale.x > 0.0f) ? 1.0f : -1.0f;
+        for (int i = 0; i < localPolygon.count; i++)
+        {
+            const XMFLOAT2& n = localPolygon.normals[i];
+            polygon.normals[i] = { (n.x * cosR - n.y * sinR) * sign, (n.x * sinR + n.y * cosR) * sign };
+        }
+    }
+    else
+    {
+        // 한 축만 뒤집히면 감김이 바뀌므로 반시계로 맞춘 뒤 법선 다시 계산
+        if (scale.x * scale.y < 0.0f)
+            std::reverse(polygon.vertices, polygon.vertices + polygon.count);
+
+        polygon.ComputeNormals();
+    }
+
+    polygon.ComputeBounds(outShape.boundsMin, outShape.boundsMax);
+
+    outShape.center = center;
+    outShape.axisX = { cosR, sinR };
+    outShape.axisY = { -sinR, cosR };
+    outShape.halfExtents = {
+        0.5f * (outShape.boundsMax.x - outShape.boundsMin.x),
+        0.5f * (outShape.boundsMax.y - outShape.boundsMin.y)
+    };
+    outShape.radius = 0.0f;
+}
+
+bool PolygonCollider2D::Intersects(BaseCollider* other)
+{
+    if (!enabled || !other->IsEnabled())
+        return false;
+
+    return CollisionDispatch::Intersects(this, other);
+}
+
+void PolygonCollider2D::DebugDraw()
+{
+#ifndef ENGINE_HEADLESS
+    if (!enabled) return;
+
+    const ConvexPolygon& polygon = *GetWorldPolygon();
+    XMFLOAT4 col = { 0,1,0,1 };
+
+    for (int i = 0; i < polygon.count; i++)
+        DebugRenderer::Instance().DrawLine(polygon.vertices[i], polygon.vertices[(i + 1) % polygon.count], col);
+#endif
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include "Physics/BaseCollider.h"
+#include "Physics/ConvexPolygon.h"
+#include <vector>
+
+// 볼록 다각형 콜라이더 (로컬 꼭짓점 3~8개)
+// - SetPoints로 받은 점의 볼록 껍질을 반시계로 저장하고 변 법선도 이때 한 번만 계산
+// - 월드 형태는 캐시된 꼭짓점/법선을 회전만 해서 만듦 (균일 스케일이 아니면 법선을 다시 계산)
+// - 충돌은 ConvexPolygon SAT + 참조 면 클리핑 (박스/원/캡슐/다각형 모두)
+class PolygonCollider2D : public BaseCollider
+{
+public:
+    PolygonCollider2D();
+
+    // 로컬 꼭짓점 설정 (오프셋 기준, 볼록 껍질 꼭짓점이 3~8개가 아니면 false - 기존 형태 유지)
+    bool SetPoints(const std::vector<DirectX::XMFLOAT2>& points);
+    std::vector<DirectX::XMFLOAT2> GetPoints() const;
+
+    // 박스 모양으로 설정 (기본값 32x32)
+    void SetAsBox(float halfWidth, float halfHeight);
+
+    // 로컬 다각형 (꼭짓점 + 미리 계산한 변 법선)
+    const ConvexPolygon& GetLocalPolygon() const { return localPolygon; }
+
+    virtual bool Intersects(BaseCollider* other) override;
+    virtual void DebugDraw() override;
+
+protected:
+    void ComputeWorldShape(ColliderWorldShape& outShape) const override;
+    DirectX::XMFLOAT2 GetShapeSize() const override { return { static_cast<float>(revision), 0.0f }; }
+    const ConvexPolygon* GetCachedWorldPolygon() const override { return &worldPolygon; }
+
+private:
+    ConvexPolygon localPolygon;
+    mutable ConvexPolygon worldPolygon;  // 월드 꼭짓점/법선 (ComputeWorldShape에서 갱신)
+    unsigned int revision = 0;  // SetPoints마다 증가 (월드 형태 캐시 무효화)
+};
@@ -1,12 +1,23 @@
 #include "Physics/Quadtree.h"
 #include "Physics/BaseCollider.h"
-#include "Physics/BoxCollider2D.h"
-#include "Physics/CircleCollider.h"
 #include "Core/GameObject.h"
 #include "Core/Transform.h"
 #include <algorithm>
+#include <cmath>
 
-// ========== QuadtreeNode  ==========
+// ========== 콜라이더 AABB ==========
+
+AABB ComputeColliderAABB(BaseCollider* collider)
+{
+    if (!collider || !collider->GetGameObject())
+        return AABB();
+
+    // 월드 형태 캐시 (Transform이 바뀐 콜라이더만 다시 계산)
+    const ColliderWorldShape& shape = collider->GetWorldShape();
+    return AABB(shape.boundsMin, shape.boundsMax);
+}
+
+// ========== QuadtreeNode 구현 ==========
 
 QuadtreeNode::QuadtreeNode(const AABB& bounds, int level, int maxLevel, int maxObjects)
     : bounds(bounds)
@@ -39,34 +50,33 @@ void QuadtreeNode::Clear()
     }
 }
 
-void QuadtreeNode::Split()
+void QuadtreeNode::Split(QuadtreeNode* existingChild, int existingQuadrant)
 {
     if (divided)
         return;
 
     XMFLOAT2 center = bounds.GetCenter();
-    XMFLOAT2 size = bounds.GetSize();
-    float halfWidth = size.x * 0.5f;
-    float halfHeight = size.y * 0.5f;
 
-    // 4 ڽ  
-    // [0]: NW (»), [1]: NE (), [2]: SW (), [3]: SE ()
-    children[0] = new QuadtreeNode(
+    // 4개의 자식 노드 영역
+    // [0]: NW (좌상), [1]: NE (우상), [2]: SW (좌하), [3]: SE (우하)
+    AABB quadrants[4] =
+    {
         AABB(bounds.min.x, bounds.min.y, center.x, center.y),
-        level + 1, maxLevel, maxObjects
-    );
-    children[1] = new QuadtreeNode(
         AABB(center.x, bounds.min.y, bounds.max.x, center.y),
-        level + 1, maxLevel, maxObjects
-    );
-    children[2] = new QuadtreeNode(
         AABB(bounds.min.x, center.y, center.x, bounds.max.y),
-        level + 1, maxLevel, maxObjects
-    );
-    children[3] = new QuadtreeNode(
-        AABB(center.x, center.y, bounds.max.x, bounds.max.y),
-        level + 1, maxLevel, maxObjects
-    );
+        AABB(center.x, center.y, bounds.max.x, bounds.max.y)
+    };
+
+    for (int i = 0; i < 4; i++)
+    {
+        if (existingChild && i == existingQuadrant)
+        {
+            children[i] = existingChild;
+            continue;
+        }
+
+        children[i] = new QuadtreeNode(quadrants[i], level + 1, maxLevel, maxObjects);
+    }
 
     divided = true;
 }
@@ -76,7 +86,7 @@ int QuadtreeNode::GetQuadrant(BaseCollider* collider) const
     AABB colliderAABB = GetColliderAABB(collider);
     XMFLOAT2 center = bounds.GetCenter();
 
-    // ݶ̴   и鿡  Ȯ
+    // 콜라이더가 완전히 한 사분면에 들어가는지 확인
     bool inLeft = (colliderAABB.max.x <= center.x);
     bool inRight = (colliderAABB.min.x >= center.x);
     bool inTop = (colliderAABB.max.y <= center.y);
@@ -93,43 +103,12 @@ int QuadtreeNode::GetQuadrant(BaseCollider* collider) const
         if (inRight) return 3; // SE
     }
 
-    return -1;  //  и鿡    忡 
+    return -1;  // 여러 사분면에 걸쳐있음 → 현재 노드에 유지
 }
 
 AABB QuadtreeNode::GetColliderAABB(BaseCollider* collider) const
 {
-    if (!collider || !collider->GetGameObject())
-        return AABB();
-
-    GameObject* obj = collider->GetGameObject();
-    XMFLOAT2 pos = obj->transform.GetPosition();
-    XMFLOAT2 scale = obj->transform.GetScale();
-
-    // BoxCollider2D
-    if (BoxCollider2D* box = dynamic_cast<BoxCollider2D*>(collider))
-    {
-        float halfWidth = box->halfSize.x * scale.x;
-        float halfHeight = box->halfSize.y * scale.y;
-
-        return AABB(
-            pos.x - halfWidth, pos.y - halfHeight,
-            pos.x + halfWidth, pos.y + halfHeight
-        );
-    }
-
-    // CircleCollider
-    if (CircleCollider* circle = dynamic_cast<CircleCollider*>(collider))
-    {
-        float radius = circle->radius * (std::max)(scale.x, scale.y);
-
-        return AABB(
-            pos.x - radius, pos.y - radius,
-            pos.x + radius, pos.y + radius
-        );
-    }
-
-    // ⺻ ( )
-    return AABB(pos.x - 1, pos.y - 1, pos.x + 1, pos.y + 1);
+    return ComputeColliderAABB(collider);
 }
 
 void QuadtreeNode::Insert(BaseCollider* collider)
@@ -137,12 +116,12 @@ void QuadtreeNode::Insert(BaseCollider* collider)
     if (!collider)
         return;
 
-    //    ̸ 
+    // 이 노드의 영역 밖이면 무시
     AABB colliderAABB = GetColliderAABB(collider);
     if (!bounds.Intersects(colliderAABB))
         return;
 
-    // ̹ ҵǾ ڽĿ 
+    // 이미 분할되었으면 자식에게 위임
     if (divided)
     {
         int quadrant = GetQuadrant(collider);
@@ -151,18 +130,18 @@ void QuadtreeNode::Insert(BaseCollider* collider)
             children[quadrant]->Insert(collider);
             return;
         }
-        // -1̸  и鿡 Ƿ  忡 
+        // -1이면 여러 사분면에 걸쳐있으므로 현재 노드에 유지
     }
 
-    //  忡 ߰
+    // 이 노드에 추가
     objects.push_back(collider);
 
-    // 뷮 ʰ & ִ  ƴϸ 
+    // 용량 초과 & 최대 깊이 아니면 분할
     if (!divided && objects.size() > static_cast<size_t>(maxObjects) && level < maxLevel)
     {
         Split();
 
-        //  Ʈ ڽ ġ
+        // 기존 오브젝트들을 자식으로 재배치
         std::vector<BaseCollider*> remaining;
         for (BaseCollider* obj : objects)
         {
@@ -182,11 +161,11 @@ void QuadtreeNode::Insert(BaseCollider* collider)
 
 void QuadtreeNode::Query(const AABB& range, std::vector<BaseCollider*>& result) const
 {
-    //  ̸ 
+    // 범위 밖이면 무시
     if (!bounds.Intersects(range))
         return;
 
-    //   Ʈ ߰
+    // 이 노드의 오브젝트 추가
     for (BaseCollider* obj : objects)
     {
         AABB objAABB = GetColliderAABB(obj);
@@ -196,7 +175,7 @@ void QuadtreeNode::Query(const AABB& range, std::vector<BaseCollider*>& result)
         }
     }
 
-    // ڽ  ˻
+    // 자식 노드 검색
     if (divided)
     {
         for (int i = 0; i < 4; i++)
@@ -206,7 +185,46 @@ void QuadtreeNode::Query(const AABB& range, std::vector<BaseCollider*>& result)
     }
 }
 
-// ========== Quadtree  ==========
+int QuadtreeNode::CountObjects() const
+{
+    int count = static_cast<int>(objects.size());
+
+    if (divided)
+    {
+        for (int i = 0; i < 4; i++)
+            count += children[i]->CountObjects();
+    }
+
+    return count;
+}
+
+int QuadtreeNode::CountNodes() const
+{
+    int count = 1;
+
+    if (divided)
+    {
+        for (int i = 0; i < 4; i++)
+            count += children[i]->CountNodes();
+    }
+
+    return count;
+}
+
+int QuadtreeNode::GetDeepestLevel() const
+{
+    int deepest = level;
+
+    if (divided)
+    {
+        for (int i = 0; i < 4; i++)
+            deepest = (std::max)(deepest, children[i]->GetDeepestLevel());
+    }
+
+    return deepest;
+}
+
+// ========== Quadtree 구현 ==========
 
 Quadtree::Quadtree(const AABB& worldBounds, int maxLevel, int maxObjects)
     : worldBounds(worldBounds)
@@ -223,8 +241,60 @@ Quadtree::~Quadtree()
 
 void Quadtree::Insert(BaseCollider* collider)
 {
-    if (root)
-        root->Insert(collider);
+    if (!collider || !root)
+        return;
+
+    AABB colliderAABB = ComputeColliderAABB(collider);
+
+    // NaN/무한대 위치는 무시 (무한 확장 방지)
+    if (!std::isfinite(colliderAABB.min.x) || !std::isfinite(colliderAABB.min.y) ||
+        !std::isfinite(colliderAABB.max.x) || !std::isfinite(colliderAABB.max.y))
+        return;
+
+    // 루트 밖이면 루트 확장 (월드 경계 밖 콜라이더도 충돌 검사 대상)
+    for (int step = 0; step < MaxGrowSteps && !root->GetBounds().Contains(colliderAABB); step++)
+    {
+        GrowToward(colliderAABB);
+    }
+
+    root->Insert(collider);
+}
+
+void Quadtree::GrowToward(const AABB& target)
+{
+    const AABB& oldBounds = root->GetBounds();
+    XMFLOAT2 size = oldBounds.GetSize();
+    XMFLOAT2 oldCenter = oldBounds.GetCenter();
+    XMFLOAT2 targetCenter = target.GetCenter();
+
+    // 대상이 있는 쪽으로 확장
+    bool growLeft = targetCenter.x < oldCenter.x;
+    bool growUp = targetCenter.y < oldCenter.y;
+
+    AABB newBounds(
+        growLeft ? oldBounds.min.x - size.x : oldBounds.min.x,
+        growUp ? oldBounds.min.y - size.y : oldBounds.min.y,
+        growLeft ? oldBounds.max.x : oldBounds.max.x + size.x,
+        growUp ? oldBounds.max.y : oldBounds.max.y + size.y
+    );
+
+    // 기존 루트가 들어갈 사분면 (왼쪽으로 확장하면 기존은 오른쪽, 위로 확장하면 기존은 아래쪽)
+    int quadrant = (growUp ? 2 : 0) + (growLeft ? 1 : 0);
+
+    QuadtreeNode* newRoot = new QuadtreeNode(newBounds, root->level - 1, maxLevel, maxObjects);
+    newRoot->Split(root, quadrant);
+    root = newRoot;
+
+    growCount++;
+}
+
+void Quadtree::Reset(const AABB& newWorldBounds)
+{
+    delete root;
+
+    worldBounds = newWorldBounds;
+    root = new QuadtreeNode(worldBounds, 0, maxLevel, maxObjects);
+    growCount = 0;
 }
 
 std::vector<BaseCollider*> Quadtree::Query(const AABB& range) const
@@ -237,41 +307,25 @@ std::vector<BaseCollider*> Quadtree::Query(const AABB& range) const
 
 std::vector<BaseCollider*> Quadtree::QueryNearby(BaseCollider* collider) const
 {
-    if (!collider || !root)
-        return {};
+    std::vector<BaseCollider*> result;
+    QueryNearby(collider, result);
+    return result;
+}
 
-    // ݶ̴ AABB ణ ȮϿ 
-    AABB colliderAABB;
-    if (collider->GetGameObject())
-    {
-        GameObject* obj = collider->GetGameObject();
-        XMFLOAT2 pos = obj->transform.GetPosition();
-        XMFLOAT2 scale = obj->transform.GetScale();
+void Quadtree::QueryNearby(BaseCollider* collider, std::vector<BaseCollider*>& result) const
+{
+    if (!collider || !root || !collider->GetGameObject())
+        return;
 
-        if (BoxCollider2D* box = dynamic_cast<BoxCollider2D*>(collider))
-        {
-            float halfWidth = box->halfSize.x * scale.x;
-            float halfHeight = box->halfSize.y * scale.y;
-            
-            // ణ Ȯ ( )
-            const float margin = 50.0f;
-            colliderAABB = AABB(
-                pos.x - halfWidth - margin, pos.y - halfHeight - margin,
-                pos.x + halfWidth + margin, pos.y + halfHeight + margin
-            );
-        }
-        else if (CircleCollider* circle = dynamic_cast<CircleCollider*>(collider))
-        {
-            float radius = circle->radius * (std::max)(scale.x, scale.y);
-            const float margin = 50.0f;
-            colliderAABB = AABB(
-                pos.x - radius - margin, pos.y - radius - margin,
-                pos.x + radius + margin, pos.y + radius + margin
-            );
-        }
-    }
+    // 콜라이더의 AABB를 약간 확장하여 쿼리 (안전 마진)
+    const float margin = 50.0f;
+    AABB colliderAABB = ComputeColliderAABB(collider);
+    colliderAABB.min.x -= margin;
+    colliderAABB.min.y -= margin;
+    colliderAABB.max.x += margin;
+    colliderAABB.max.y += margin;
 
-    return Query(colliderAABB);
+    root->Query(colliderAABB, result);
 }
 
 void Quadtree::Clear()
@@ -282,11 +336,16 @@ void Quadtree::Clear()
 
 int Quadtree::GetTotalObjects() const
 {
-    // TODO:  īƮ
-    return 0;
+    return root ? root->CountObjects() : 0;
 }
 
 int Quadtree::GetMaxDepth() const
 {
-    return maxLevel;
+    // 현재 루트 기준 가장 깊은 노드의 깊이
+    return root ? root->GetDeepestLevel() - root->level : 0;
+}
+
+int Quadtree::GetNodeCount() const
+{
+    return root ? root->CountNodes() : 0;
 }
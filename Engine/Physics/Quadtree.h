@@ -6,7 +6,7 @@ using namespace DirectX;
 
 class BaseCollider;
 
-// AABB (Axis-Aligned Bounding Box) ü
+// AABB (Axis-Aligned Bounding Box) 구조체
 struct AABB
 {
     XMFLOAT2 min;
@@ -18,7 +18,7 @@ struct AABB
     AABB(const XMFLOAT2& minPos, const XMFLOAT2& maxPos)
         : min(minPos), max(maxPos) {}
 
-    // ߽
+    // 중심점
     XMFLOAT2 GetCenter() const
     {
         return XMFLOAT2{
@@ -27,7 +27,7 @@ struct AABB
         };
     }
 
-    // ũ
+    // 크기
     XMFLOAT2 GetSize() const
     {
         return XMFLOAT2{
@@ -36,21 +36,21 @@ struct AABB
         };
     }
 
-    // ٸ AABB ġ Ȯ
+    // 다른 AABB와 겹치는지 확인
     bool Intersects(const AABB& other) const
     {
         return !(max.x < other.min.x || min.x > other.max.x ||
                  max.y < other.min.y || min.y > other.max.y);
     }
 
-    //  AABB ȿ ִ Ȯ
+    // 점이 AABB 안에 있는지 확인
     bool Contains(const XMFLOAT2& point) const
     {
         return (point.x >= min.x && point.x <= max.x &&
                 point.y >= min.y && point.y <= max.y);
     }
 
-    // AABB ٸ AABB  ϴ
+    // AABB가 다른 AABB를 완전히 포함하는지
     bool Contains(const AABB& other) const
     {
         return (other.min.x >= min.x && other.max.x <= max.x &&
@@ -58,70 +58,102 @@ struct AABB
     }
 };
 
-// Quadtree 
+// 콜라이더의 월드 AABB 계산 (브로드페이즈 공용)
+AABB ComputeColliderAABB(BaseCollider* collider);
+
+// Quadtree 노드
 class QuadtreeNode
 {
 public:
     QuadtreeNode(const AABB& bounds, int level, int maxLevel = 5, int maxObjects = 4);
     ~QuadtreeNode();
 
-    // ݶ̴ 
+    // 콜라이더 삽입
     void Insert(BaseCollider* collider);
 
-    //   ݶ̴ 
+    // 범위 내의 콜라이더 쿼리
     void Query(const AABB& range, std::vector<BaseCollider*>& result) const;
 
-    //  Ʈ 
+    // 모든 오브젝트 제거
     void Clear();
 
+    const AABB& GetBounds() const { return bounds; }
+
+    // 통계 (하위 트리 전체)
+    int CountObjects() const;
+    int CountNodes() const;
+    int GetDeepestLevel() const;
+
 private:
-    // 4
-    void Split();
+    friend class Quadtree;
 
-    // ݶ̴  ڽ 忡 ϴ  (-1 =  忡 )
+    // 4분할 (existingChild가 있으면 해당 사분면에 그대로 연결 - 루트 확장용)
+    void Split(QuadtreeNode* existingChild = nullptr, int existingQuadrant = -1);
+
+    // 콜라이더가 어느 자식 노드에 속하는지 결정 (-1 = 현재 노드에 유지)
     int GetQuadrant(BaseCollider* collider) const;
 
-    // ݶ̴ AABB 
+    // 콜라이더의 AABB 가져오기
     AABB GetColliderAABB(BaseCollider* collider) const;
 
 private:
-    AABB bounds;                              //   
-    int level;                                // Ʈ 
-    int maxLevel;                             // ִ 
-    int maxObjects;                           //   Ʈ 
+    AABB bounds;                              // 이 노드의 영역
+    int level;                                // 트리 깊이 (루트 확장 시 음수 가능)
+    int maxLevel;                             // 최대 깊이 (최소 셀 크기 고정)
+    int maxObjects;                           // 분할 기준 오브젝트 수
 
-    std::vector<BaseCollider*> objects;       //   ݶ̴
-    QuadtreeNode* children[4];                // ڽ  [NW, NE, SW, SE]
+    std::vector<BaseCollider*> objects;       // 이 노드의 콜라이더들
+    QuadtreeNode* children[4];                // 자식 노드 [NW, NE, SW, SE]
 
-    bool divided;                             //  
+    bool divided;                             // 분할 여부
 };
 
-// Quadtree  Ŭ
+// Quadtree 관리 클래스
+// - 월드 경계 밖의 콜라이더가 들어오면 루트를 2배씩 확장 (기존 루트는 자식으로 유지)
+// - 깊이 제한은 처음 루트 기준이므로 확장해도 최소 셀 크기는 그대로
 class Quadtree
 {
 public:
     Quadtree(const AABB& worldBounds, int maxLevel = 5, int maxObjects = 4);
     ~Quadtree();
 
-    // ݶ̴ 
+    // 콜라이더 삽입
     void Insert(BaseCollider* collider);
 
-    //   ݶ̴ 
+    // 범위 내의 콜라이더 쿼리
     std::vector<BaseCollider*> Query(const AABB& range) const;
 
-    // ݶ̴ ó Ʈ 
+    // 콜라이더 근처의 오브젝트 가져오기
     std::vector<BaseCollider*> QueryNearby(BaseCollider* collider) const;
 
-    //  Ʈ 
+    // 결과 버퍼를 재사용하는 버전 (매 스텝 할당 방지)
+    void QueryNearby(BaseCollider* collider, std::vector<BaseCollider*>& result) const;
+
+    // 모든 오브젝트 제거 (확장된 루트 영역은 유지)
     void Clear();
 
-    //  (׿)
+    // 월드 영역 재설정 (트리 재생성)
+    void Reset(const AABB& newWorldBounds);
+
+    // 현재 루트 영역 (확장 포함)
+    const AABB& GetRootBounds() const { return root->GetBounds(); }
+
+    // 통계 (디버그용)
     int GetTotalObjects() const;
     int GetMaxDepth() const;
+    int GetNodeCount() const;
+    int GetGrowCount() const { return growCount; }
+
+private:
+    // target 방향으로 루트를 2배 확장
+    void GrowToward(const AABB& target);
+
+    static constexpr int MaxGrowSteps = 24;  // 삽입당 최대 확장 횟수
 
 private:
     QuadtreeNode* root;
     AABB worldBounds;
     int maxLevel;
     int maxObjects;
+    int growCount = 0;  // 누적 루트 확장 횟수
 };
@@ -1,91 +1,72 @@
 #include "Physics/Rigidbody2D.h"
-#include "Core/GameObject.h"
-#include "Core/Transform.h"
-#include <algorithm>
+#include "Physics/PhysicsSystem.h"
 
-void Rigidbody2D::PhysicsUpdate(float deltaTime)
+void Rigidbody2D::SetVelocity(const XMFLOAT2& vel)
 {
-    if (isKinematic)
-        return;
-
-    //  ġ  (CCD)
-    if (gameObject)
+    if (world)
     {
-        previousPosition = gameObject->transform.GetPosition();
+        BodyStore& bodies = world->GetBodyStore();
+        bodies.velocityX[bodyIndex] = vel.x;
+        bodies.velocityY[bodyIndex] = vel.y;
+        bodies.Wake(bodyIndex);
+        return;
     }
 
-    // 1. ߷  (Unity Ÿ)
-    if (useGravity)
-    {
-        const float GRAVITY = 500.0f; // ȼ/s^2
-        forceAccumulator.y += mass * GRAVITY * gravityScale;
-    }
+    velocity = vel;
+}
 
-    // 2. ӵ  (F = ma  a = F/m)
-    if (mass > 0.0f)
+XMFLOAT2 Rigidbody2D::GetVelocity() const
+{
+    if (world)
     {
-        acceleration.x = forceAccumulator.x / mass;
-        acceleration.y = forceAccumulator.y / mass;
+        const BodyStore& bodies = world->GetBodyStore();
+        return { bodies.velocityX[bodyIndex], bodies.velocityY[bodyIndex] };
     }
 
-    // 3. ӵ Ʈ (v = v0 + at)
-    velocity.x += acceleration.x * deltaTime;
-    velocity.y += acceleration.y * deltaTime;
+    return velocity;
+}
 
-    // 4. ִ ӵ  (ͳθ )
-    const float MAX_VELOCITY = 1000.0f;
-    float speed = sqrtf(velocity.x * velocity.x + velocity.y * velocity.y);
-    if (speed > MAX_VELOCITY)
+void Rigidbody2D::SetAngularVelocity(float angularVel)
+{
+    if (world)
     {
-        velocity.x = (velocity.x / speed) * MAX_VELOCITY;
-        velocity.y = (velocity.y / speed) * MAX_VELOCITY;
+        BodyStore& bodies = world->GetBodyStore();
+        bodies.angularVelocity[bodyIndex] = angularVel;
+        bodies.Wake(bodyIndex);
+        return;
     }
 
-    // 5.    (Drag)
-    if (drag > 0.0f)
-    {
-        float dragFactor = 1.0f - drag * deltaTime;
-        if (dragFactor < 0.0f) dragFactor = 0.0f;
-        
-        velocity.x *= dragFactor;
-        velocity.y *= dragFactor;
-    }
+    angularVelocity = angularVel;
+}
 
-    // 6. ġ Ʈ (x = x0 + vt)
-    if (gameObject)
-    {
-        Transform& transform = gameObject->transform;
-        XMFLOAT2 position = transform.GetPosition();
+float Rigidbody2D::GetAngularVelocity() const
+{
+    if (world)
+        return world->GetBodyStore().angularVelocity[bodyIndex];
 
-        if (!freezePositionX)
-            position.x += velocity.x * deltaTime;
-        
-        if (!freezePositionY)
-            position.y += velocity.y * deltaTime;
+    return angularVelocity;
+}
 
-        transform.SetPosition(position.x, position.y);
-    }
+bool Rigidbody2D::IsSleeping() const
+{
+    return world && world->GetBodyStore().IsSleeping(bodyIndex);
+}
+
+void Rigidbody2D::WakeUp()
+{
+    if (world)
+        world->GetBodyStore().Wake(bodyIndex);
+}
 
-    // 7. ȸ Ʈ
-    if (!freezeRotation && gameObject)
+XMFLOAT2 Rigidbody2D::GetPreviousPosition() const
+{
+    if (world)
     {
-        // ȸ  
-        if (angularDrag > 0.0f)
-        {
-            float rotDragFactor = 1.0f - angularDrag * deltaTime;
-            if (rotDragFactor < 0.0f) rotDragFactor = 0.0f;
-            angularVelocity *= rotDragFactor;
-        }
-
-        Transform& transform = gameObject->transform;
-        float rotation = transform.GetRotation();
-        rotation += angularVelocity * deltaTime;
-        transform.SetRotation(rotation);
+        const BodyStore& bodies = world->GetBodyStore();
+        return { bodies.previousX[bodyIndex], bodies.previousY[bodyIndex] };
     }
 
-    // 8.   ʱȭ (  )
-    forceAccumulator = {0.0f, 0.0f};
-    torque = 0.0f;
+    return previousPosition;
 }
 
 void Rigidbody2D::AddForce(const XMFLOAT2& force)
@@ -93,6 +74,15 @@ void Rigidbody2D::AddForce(const XMFLOAT2& force)
     if (isKinematic)
         return;
 
+    if (world)
+    {
+        BodyStore& bodies = world->GetBodyStore();
+        bodies.forceX[bodyIndex] += force.x;
+        bodies.forceY[bodyIndex] += force.y;
+        bodies.Wake(bodyIndex);
+        return;
+    }
+
     forceAccumulator.x += force.x;
     forceAccumulator.y += force.y;
 }
@@ -102,10 +92,12 @@ void Rigidbody2D::AddImpulse(const XMFLOAT2& impulse)
     if (isKinematic)
         return;
 
-    // ݷ =  * ӵ ȭ  ӵ ȭ = ݷ / 
+    // 충격량 = 질량 * 속도 변화 → 속도 변화 = 충격량 / 질량
     if (mass > 0.0f)
     {
-        velocity.x += impulse.x / mass;
-        velocity.y += impulse.y / mass;
+        XMFLOAT2 newVelocity = GetVelocity();
+        newVelocity.x += impulse.x / mass;
+        newVelocity.y += impulse.y / mass;
+        SetVelocity(newVelocity);
     }
 }
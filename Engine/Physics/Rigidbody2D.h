@@ -4,56 +4,75 @@
 
 using namespace DirectX;
 
-// Rigidbody2D: 2D  ùķ̼  Ʈ (Unity Ÿ)
+class PhysicsSystem;
+
+// Rigidbody2D: 2D 물리 시뮬레이션을 위한 컴포넌트 (Unity 스타일)
+// - 물리 월드에 등록되면 속도/힘은 PhysicsSystem의 BodyStore(SoA)에 저장되고
+//   이 컴포넌트는 인덱스 핸들 역할만 함 (적분은 PhysicsSystem이 일괄 처리)
 class Rigidbody2D : public Component
 {
 public:
     Rigidbody2D() = default;
 
-    //  Ʈ (PhysicsSystem ȣ)
-    void PhysicsUpdate(float deltaTime);
-
-    //  ߰
+    // 힘 추가
     void AddForce(const XMFLOAT2& force);
     void AddImpulse(const XMFLOAT2& impulse);
 
-    // ӵ  
-    void SetVelocity(const XMFLOAT2& vel) { velocity = vel; }
-    XMFLOAT2 GetVelocity() const { return velocity; }
+    // 속도 직접 설정
+    void SetVelocity(const XMFLOAT2& vel);
+    XMFLOAT2 GetVelocity() const;
+
+    // 회전 속도 (rad/s)
+    void SetAngularVelocity(float angularVel);
+    float GetAngularVelocity() const;
+
+    // 이전 위치 (CCD용)
+    XMFLOAT2 GetPreviousPosition() const;
 
-    //  ġ (CCD)
-    XMFLOAT2 GetPreviousPosition() const { return previousPosition; }
+    // 물리 월드 등록 여부
+    bool IsRegistered() const { return world != nullptr; }
 
-    //  Ӽ
-    float mass = 1.0f;              //  (kg)
-    float gravityScale = 1.0f;      // ߷  (0̸ ߷ )
-    float drag = 0.0f;              //   (0~1)
-    float angularDrag = 0.05f;      // ȸ 
+    // 수면 상태 (멈춘 섬은 적분/충돌 판정 생략, 힘/속도 설정 시 자동으로 깨어남)
+    bool IsSleeping() const;
+    void WakeUp();
+
+    // 물리 속성
+    float mass = 1.0f;              // 질량 (kg)
+    float gravityScale = 1.0f;      // 중력 배율 (0이면 중력 무시)
+    float drag = 0.0f;              // 공기 저항 (0~1)
+    float angularDrag = 0.05f;      // 회전 저항
     
-    bool useGravity = true;         // ߷  
-    bool isKinematic = false;       // Kinematic  (  ȹ,  )
+    bool useGravity = true;         // 중력 적용 여부
+    bool isKinematic = false;       // Kinematic 모드 (물리 영향 안받음, 직접 제어)
     
     // CCD (Continuous Collision Detection)
-    bool useCCD = false;            // CCD   ( ü ʿ)
+    bool useCCD = false;            // CCD 사용 여부 (빠른 물체에 필요, 켜면 최대 속도 제한 없음)
+
+    // 렌더 보간 (물리 스텝 직전↔현재 자세를 프레임 시점에 맞춰 그림, 끄면 마지막 스텝 자세 그대로)
+    bool interpolate = true;
     
-    //  
-    float restitution = 0.5f;       // ݹ  (0= ź, 1= ź)
-    float friction = 0.3f;          //  
+    // 물리 재질
+    float restitution = 0.5f;       // 반발 계수 (0=완전 비탄성, 1=완전 탄성)
+    float friction = 0.3f;          // 마찰 계수
 
-    //  
-    bool freezePositionX = false;   // X ̵ 
-    bool freezePositionY = false;   // Y ̵ 
-    bool freezeRotation = false;    // ȸ 
+    // 제약 조건
+    bool freezePositionX = false;   // X축 이동 고정
+    bool freezePositionY = false;   // Y축 이동 고정
+    bool freezeRotation = false;    // 회전 고정
 
 private:
     friend class PhysicsSystem;
+    friend class BodyStore;
+
+    PhysicsSystem* world = nullptr;      // 등록된 물리 월드
+    int bodyIndex = -1;                  // BodyStore 인덱스
 
-    XMFLOAT2 velocity{0.0f, 0.0f};       // ӵ (m/s)
-    XMFLOAT2 acceleration{0.0f, 0.0f};   // ӵ (m/s^2)
-    XMFLOAT2 forceAccumulator{0.0f, 0.0f}; //  
+    // 미등록 상태의 값 (등록 시 BodyStore로 복사, 해제 시 되돌려 받음)
+    XMFLOAT2 velocity{0.0f, 0.0f};       // 속도 (m/s)
+    XMFLOAT2 forceAccumulator{0.0f, 0.0f}; // 누적된 힘
     
-    XMFLOAT2 previousPosition{0.0f, 0.0f}; //   ġ (CCD)
+    XMFLOAT2 previousPosition{0.0f, 0.0f}; // 이전 프레임 위치 (CCD용)
 
-    float angularVelocity = 0.0f;        // ȸ ӵ (rad/s)
-    float torque = 0.0f;                 // ũ (ȸ)
+    float angularVelocity = 0.0f;        // 회전 속도 (rad/s)
+    float torque = 0.0f;                 // 토크 (회전력)
 };
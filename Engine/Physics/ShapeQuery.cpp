@@ -0,0 +1,675 @@
+#include "Physics/ShapeQuery.h"
+#include "Physics/BaseCollider.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    inline XMFLOAT2 Add(const XMFLOAT2& a, const XMFLOAT2& b) { return { a.x + b.x, a.y + b.y }; }
+    inline XMFLOAT2 Sub(const XMFLOAT2& a, const XMFLOAT2& b) { return { a.x - b.x, a.y - b.y }; }
+    inline XMFLOAT2 Scale(const XMFLOAT2& v, float s) { return { v.x * s, v.y * s }; }
+    inline float Dot(const XMFLOAT2& a, const XMFLOAT2& b) { return a.x * b.x + a.y * b.y; }
+
+    // 박스 로컬 좌표 ↔ 월드
+    inline XMFLOAT2 ToLocalVector(const QueryShape& box, const XMFLOAT2& v)
+    {
+        return { Dot(v, box.axisX), Dot(v, box.axisY) };
+    }
+
+    inline XMFLOAT2 ToLocalPoint(const QueryShape& box, const XMFLOAT2& p)
+    {
+        return ToLocalVector(box, Sub(p, box.center));
+    }
+
+    inline XMFLOAT2 ToWorldVector(const QueryShape& box, const XMFLOAT2& v)
+    {
+        return Add(Scale(box.axisX, v.x), Scale(box.axisY, v.y));
+    }
+
+    // 레이 vs 원 (시작점이 안에 있으면 t = 0)
+    bool RayCircle(const XMFLOAT2& origin, const XMFLOAT2& direction, const XMFLOAT2& center, float radius,
+                   float maxDistance, float& outT, XMFLOAT2& outNormal, bool& outInside)
+    {
+        XMFLOAT2 m = Sub(origin, center);
+        float c = Dot(m, m) - radius * radius;
+
+        outInside = c <= 0.0f;
+        if (outInside)
+        {
+            outT = 0.0f;
+            return true;
+        }
+
+        float b = Dot(m, direction);
+        if (b > 0.0f)
+            return false;
+
+        float discriminant = b * b - c;
+        if (discriminant < 0.0f)
+            return false;
+
+        float t = -b - sqrtf(discriminant);
+        if (t > maxDistance)
+            return false;
+
+        outT = (std::max)(t, 0.0f);
+        XMFLOAT2 hitPoint = Add(origin, Scale(direction, outT));
+        outNormal = (radius > 0.0f) ? Scale(Sub(hitPoint, center), 1.0f / radius) : Scale(direction, -1.0f);
+        return true;
+    }
+
+    // 레이 vs 원점 중심 AABB (Slab, 밖에서 들어오는 경우만)
+    bool RaySlab(const XMFLOAT2& origin, const XMFLOAT2& direction, float halfX, float halfY,
+                 float maxDistance, float& outT, XMFLOAT2& outNormal)
+    {
+        float enter = -1e30f;
+        float exit = 1e30f;
+        XMFLOAT2 normal{0.0f, 0.0f};
+
+        const float origins[2] = { origin.x, origin.y };
+        const float directions[2] = { direction.x, direction.y };
+        const float halves[2] = { halfX, halfY };
+
+        for (int axis = 0; axis < 2; axis++)
+        {
+            if (directions[axis] == 0.0f)
+            {
+                if (origins[axis] < -halves[axis] || origins[axis] > halves[axis])
+                    return false;
+                continue;
+            }
+
+            float inverse = 1.0f / directions[axis];
+            float t1 = (-halves[axis] - origins[axis]) * inverse;
+            float t2 = (halves[axis] - origins[axis]) * inverse;
+            float sign = -1.0f;  // t1 쪽 면 법선 = -축
+
+            if (t1 > t2)
+            {
+                std::swap(t1, t2);
+                sign = 1.0f;
+            }
+
+            if (t1 > enter)
+            {
+                enter = t1;
+                normal = (axis == 0) ? XMFLOAT2{ sign, 0.0f } : XMFLOAT2{ 0.0f, sign };
+            }
+            exit = (std::min)(exit, t2);
+        }
+
+        if (enter > exit || enter < 0.0f || enter > maxDistance)
+            return false;
+
+        outT = enter;
+        outNormal = normal;
+        return true;
+    }
+
+    // 레이 vs 둥근 박스 (박스 로컬, 반 크기 half + 반지름 radius의 민코프스키 합)
+    bool RayRoundedBox(const XMFLOAT2& origin, const XMFLOAT2& direction, const XMFLOAT2& half, float radius,
+                       float maxDistance, float& outT, XMFLOAT2& outNormal, bool& outInside)
+    {
+        // 시작점이 안에 있는지 (박스 최근접점 거리 <= 반지름)
+        float closestX = (std::max)(-half.x, (std::min)(origin.x, half.x));
+        float closestY = (std::max)(-half.y, (std::min)(origin.y, half.y));
+        float dx = origin.x - closestX;
+        float dy = origin.y - closestY;
+
+        outInside = dx * dx + dy * dy <= radius * radius;
+        if (outInside)
+        {
+            outT = 0.0f;
+            return true;
+        }
+
+        bool hit = false;
+        float bestT = maxDistance;
+        float t;
+        XMFLOAT2 normal;
+
+        // 1. 가로/세로로 늘린 두 박스 (반지름 0이면 같은 박스)
+        if (RaySlab(origin, direction, half.x + radius, half.y, bestT, t, normal))
+        {
+            bestT = t; outNormal = normal; hit = true;
+        }
+
+        if (radius > 0.0f)
+        {
+            if (RaySlab(origin, direction, half.x, half.y + radius, bestT, t, normal) && t < bestT)
+            {
+                bestT = t; outNormal = normal; hit = true;
+            }
+
+            // 2. 네 모서리 원
+            const XMFLOAT2 corners[4] = {
+                { -half.x, -half.y }, { half.x, -half.y }, { half.x, half.y }, { -half.x, half.y }
+            };
+
+            for (const XMFLOAT2& corner : corners)
+            {
+                bool inside;
+                if (RayCircle(origin, direction, corner, radius, bestT, t, normal, inside) && !inside && t < bestT)
+                {
+                    bestT = t; outNormal = normal; hit = true;
+                }
+            }
+        }
+
+        if (hit)
+            outT = bestT;
+
+        return hit;
+    }
+
+    // 레이 vs 둥근 볼록 다각형 (월드, 다각형 반지름 + radius만큼 부풀린 형태)
+    bool RayRoundedPolygon(const XMFLOAT2& origin, const XMFLOAT2& direction, const ConvexPolygon& polygon, float radius,
+                           float maxDistance, float& outT, XMFLOAT2& outNormal, bool& outInside)
+    {
+        // 시작점이 안에 있는지 (중심부 최단 거리 <= 반지름 합)
+        ConvexPolygon start;
+        start.count = 1;
+        start.vertices[0] = origin;
+        start.radius = radius;
+
+        XMFLOAT2 normal;
+        XMFLOAT2 closest;
+        outInside = ConvexPolygon::Distance(polygon, start, normal, closest) <= 0.0f;
+        if (outInside)
+        {
+            outT = 0.0f;
+            return true;
+        }
+
+        float inflate = fabsf(polygon.radius) + radius;
+        bool hit = false;
+        float bestT = maxDistance;
+        float t;
+
+        // 1. 법선 방향으로 밀어낸 변 (선분은 양쪽 두 변, 앞면으로 들어오는 경우만)
+        int edgeCount = (polygon.count >= 2) ? polygon.count : 0;
+        for (int i = 0; i < edgeCount; i++)
+        {
+            const XMFLOAT2& edgeNormal = polygon.normals[i];
+            float speed = Dot(direction, edgeNormal);
+            if (speed >= 0.0f)
+                continue;
+
+            XMFLOAT2 p = Add(polygon.vertices[i], Scale(edgeNormal, inflate));
+            XMFLOAT2 q = Add(polygon.vertices[(i + 1) % polygon.count], Scale(edgeNormal, inflate));
+
+            t = Dot(edgeNormal, Sub(p, origin)) / speed;
+            if (t < 0.0f || t > bestT)
+                continue;
+
+            XMFLOAT2 edge = Sub(q, p);
+            float lengthSq = Dot(edge, edge);
+            float along = (lengthSq > 0.0f) ? Dot(Sub(Add(origin, Scale(direction, t)), p), edge) / lengthSq : -1.0f;
+            if (along < 0.0f || along > 1.0f)
+                continue;
+
+            bestT = t; outNormal = edgeNormal; hit = true;
+        }
+
+        // 2. 꼭짓점 원
+        if (inflate > 0.0f)
+        {
+            for (int i = 0; i < polygon.count; i++)
+            {
+                bool inside;
+                if (RayCircle(origin, direction, polygon.vertices[i], inflate, bestT, t, normal, inside) && !inside && t < bestT)
+                {
+                    bestT = t; outNormal = normal; hit = true;
+                }
+            }
+        }
+
+        if (hit)
+            outT = bestT;
+
+        return hit;
+    }
+
+    void FillHit(RaycastHit& outHit, const XMFLOAT2& point, const XMFLOAT2& normal, float distance, float maxDistance)
+    {
+        outHit.point = point;
+        outHit.normal = normal;
+        outHit.distance = distance;
+        outHit.fraction = (maxDistance > 0.0f) ? distance / maxDistance : 0.0f;
+    }
+
+    // 박스 꼭짓점 (월드)
+    void GetBoxVertices(const QueryShape& box, XMFLOAT2 outVertices[4])
+    {
+        XMFLOAT2 x = Scale(box.axisX, box.halfExtents.x);
+        XMFLOAT2 y = Scale(box.axisY, box.halfExtents.y);
+
+        outVertices[0] = Sub(Sub(box.center, x), y);
+        outVertices[1] = Sub(Add(box.center, x), y);
+        outVertices[2] = Add(Add(box.center, x), y);
+        outVertices[3] = Add(Sub(box.center, x), y);
+    }
+
+    // 축 투영 범위 (박스)
+    void ProjectBox(const QueryShape& box, const XMFLOAT2& axis, float& outMin, float& outMax)
+    {
+        float center = Dot(box.center, axis);
+        float extent = fabsf(Dot(box.axisX, axis)) * box.halfExtents.x + fabsf(Dot(box.axisY, axis)) * box.halfExtents.y;
+        outMin = center - extent;
+        outMax = center + extent;
+    }
+
+    // 방향으로 가장 먼 꼭짓점들의 평균 (평행한 변이면 중점)
+    XMFLOAT2 SupportPoint(const QueryShape& box, const XMFLOAT2& direction)
+    {
+        XMFLOAT2 vertices[4];
+        GetBoxVertices(box, vertices);
+
+        float best = -1e30f;
+        for (const XMFLOAT2& vertex : vertices)
+            best = (std::max)(best, Dot(vertex, direction));
+
+        XMFLOAT2 sum{0.0f, 0.0f};
+        int count = 0;
+        const float Tolerance = 0.01f;
+
+        for (const XMFLOAT2& vertex : vertices)
+        {
+            if (Dot(vertex, direction) >= best - Tolerance)
+            {
+                sum = Add(sum, vertex);
+                count++;
+            }
+        }
+
+        return Scale(sum, 1.0f / count);
+    }
+
+    // 박스 vs 박스 SAT 스윕 (box가 direction으로 이동)
+    bool SweepBoxes(const QueryShape& target, const QueryShape& box, const XMFLOAT2& direction,
+                    float maxDistance, RaycastHit& outHit)
+    {
+        const XMFLOAT2 axes[4] = { target.axisX, target.axisY, box.axisX, box.axisY };
+
+        float enter = -1e30f;
+        float exit = 1e30f;
+        int enterAxis = -1;
+
+        for (int i = 0; i < 4; i++)
+        {
+            float targetMin, targetMax, boxMin, boxMax;
+            ProjectBox(target, axes[i], targetMin, targetMax);
+            ProjectBox(box, axes[i], boxMin, boxMax);
+
+            float speed = Dot(direction, axes[i]);
+            if (speed == 0.0f)
+            {
+                if (boxMax < targetMin || boxMin > targetMax)
+                    return false;
+                continue;
+            }
+
+            // 이 축에서 겹치는 이동 거리 구간
+            float t1 = (targetMin - boxMax) / speed;
+            float t2 = (targetMax - boxMin) / speed;
+            if (t1 > t2)
+                std::swap(t1, t2);
+
+            if (t1 > enter)
+            {
+                enter = t1;
+                enterAxis = i;
+            }
+            exit = (std::min)(exit, t2);
+
+            if (enter > exit || exit < 0.0f || enter > maxDistance)
+                return false;
+        }
+
+        // 시작부터 겹침
+        if (enter <= 0.0f || enterAxis < 0)
+        {
+            FillHit(outHit, box.center, Scale(direction, -1.0f), 0.0f, maxDistance);
+            return true;
+        }
+
+        // 법선 = 타깃에서 박스 쪽 (이동 방향의 반대편)
+        XMFLOAT2 axis = axes[enterAxis];
+        XMFLOAT2 normal = (Dot(direction, axis) > 0.0f) ? Scale(axis, -1.0f) : axis;
+
+        QueryShape moved = box;
+        moved.center = Add(box.center, Scale(direction, enter));
+
+        // 타깃 면에 닿았으면 박스 꼭짓점, 박스 면에 닿았으면 타깃 꼭짓점이 접촉점
+        XMFLOAT2 point = (enterAxis < 2)
+            ? SupportPoint(moved, Scale(normal, -1.0f))
+            : SupportPoint(target, normal);
+
+        FillHit(outHit, point, normal, enter, maxDistance);
+        return true;
+    }
+
+    // 거리 기반 평행 이동 스윕 (다각형 타깃, shape가 direction으로 이동)
+    // 최근접 방향으로 다가오는 속도로 거리만큼 전진 (이동에 대해 거리가 볼록이므로 넘어가지 않음)
+    bool SweepByDistance(const QueryShape& target, const QueryShape& shape, const XMFLOAT2& direction,
+                         float maxDistance, RaycastHit& outHit)
+    {
+        const int MaxIterations = 20;
+        const float Tolerance = 0.01f;
+
+        ConvexPolygon targetPolygon;
+        ConvexPolygon moving;
+        target.ToPolygon(targetPolygon);
+        shape.ToPolygon(moving);
+
+        float t = 0.0f;
+        XMFLOAT2 normal{ 0.0f, 1.0f };
+        XMFLOAT2 point = shape.center;
+
+        for (int iteration = 0; iteration < MaxIterations; iteration++)
+        {
+            float distance = ConvexPolygon::Distance(targetPolygon, moving, normal, point);
+
+            // 시작부터 겹침
+            if (iteration == 0 && distance <= 0.0f)
+            {
+                FillHit(outHit, shape.center, Scale(direction, -1.0f), 0.0f, maxDistance);
+                return true;
+            }
+
+            if (distance <= Tolerance)
+                break;
+
+            float approach = -Dot(direction, normal);
+            if (approach <= 0.0001f)
+                return false;
+
+            float advance = distance / approach;
+            t += advance;
+            if (t > maxDistance)
+                return false;
+
+            for (int i = 0; i < moving.count; i++)
+                moving.vertices[i] = Add(moving.vertices[i], Scale(direction, advance));
+        }
+
+        // 법선 = 타깃 표면 → 이동 형태, 접촉점 = 타깃 표면 최근접점
+        FillHit(outHit, point, normal, t, maxDistance);
+        return true;
+    }
+}
+
+// ========== QueryShape ==========
+
+QueryShape QueryShape::MakeBox(const XMFLOAT2& center, const XMFLOAT2& halfSize, float angle)
+{
+    QueryShape shape;
+    shape.type = Type::Box;
+    shape.center = center;
+    shape.axisX = { cosf(angle), sinf(angle) };
+    shape.axisY = { -shape.axisX.y, shape.axisX.x };
+    shape.halfExtents = halfSize;
+    return shape;
+}
+
+QueryShape QueryShape::MakeCircle(const XMFLOAT2& center, float radius)
+{
+    QueryShape shape;
+    shape.type = Type::Circle;
+    shape.center = center;
+    shape.radius = radius;
+    return shape;
+}
+
+bool QueryShape::FromCollider(BaseCollider* collider, QueryShape& outShape)
+{
+    if (collider == nullptr || collider->GetGameObject() == nullptr)
+        return false;
+
+    // 콜라이더 월드 형태 캐시 (오프셋, 스케일, 회전 반영)
+    const ColliderWorldShape& shape = collider->GetWorldShape();
+
+    if (collider->GetShapeType() == ColliderShapeType::Box)
+    {
+        outShape.type = Type::Box;
+        outShape.center = shape.center;
+        outShape.axisX = shape.axisX;
+        outShape.axisY = shape.axisY;
+        outShape.halfExtents = shape.halfExtents;
+        outShape.radius = 0.0f;
+        return true;
+    }
+
+    if (collider->GetShapeType() == ColliderShapeType::Polygon || collider->GetShapeType() == ColliderShapeType::Capsule)
+    {
+        // 꼭짓점 평균을 중심으로 (CCD 중심부 축소가 다각형 안쪽으로 모이도록), 캐시된 월드 꼭짓점/법선을 축 기준 로컬로
+        const ConvexPolygon& world = *collider->GetWorldPolygon();
+
+        outShape.type = Type::Polygon;
+        outShape.center = world.GetCentroid();
+        outShape.axisX = shape.axisX;
+        outShape.axisY = shape.axisY;
+        outShape.halfExtents = shape.halfExtents;
+        outShape.radius = world.radius;
+        outShape.polygon.count = world.count;
+        outShape.polygon.radius = world.radius;
+
+        for (int i = 0; i < world.count; i++)
+        {
+            outShape.polygon.vertices[i] = ToLocalPoint(outShape, world.vertices[i]);
+            outShape.polygon.normals[i] = ToLocalVector(outShape, world.normals[i]);
+        }
+        return true;
+    }
+
+    outShape = MakeCircle(shape.center, shape.radius);
+    return true;
+}
+
+XMFLOAT2 QueryShape::GetAABBExtents() const
+{
+    if (type == Type::Circle)
+        return { radius, radius };
+
+    if (type == Type::Polygon)
+    {
+        XMFLOAT2 extents{ 0.0f, 0.0f };
+        for (int i = 0; i < polygon.count; i++)
+        {
+            XMFLOAT2 offset = ToWorldVector(*this, polygon.vertices[i]);
+            extents.x = (std::max)(extents.x, fabsf(offset.x));
+            extents.y = (std::max)(extents.y, fabsf(offset.y));
+        }
+
+        float extent = fabsf(polygon.radius);
+        return { extents.x + extent, extents.y + extent };
+    }
+
+    return {
+        fabsf(axisX.x) * halfExtents.x + fabsf(axisY.x) * halfExtents.y,
+        fabsf(axisX.y) * halfExtents.x + fabsf(axisY.y) * halfExtents.y
+    };
+}
+
+void QueryShape::ToPolygon(ConvexPolygon& outPolygon) const
+{
+    if (type == Type::Circle)
+    {
+        outPolygon.count = 1;
+        outPolygon.vertices[0] = center;
+        outPolygon.radius = fabsf(radius);
+        return;
+    }
+
+    if (type == Type::Box)
+    {
+        outPolygon.SetBox(center, axisX, axisY, halfExtents);
+        return;
+    }
+
+    // 로컬 꼭짓점/법선을 현재 축으로 회전 (법선을 변에서 다시 계산하지 않음)
+    outPolygon.count = polygon.count;
+    outPolygon.radius = polygon.radius;
+    for (int i = 0; i < polygon.count; i++)
+    {
+        outPolygon.vertices[i] = Add(center, ToWorldVector(*this, polygon.vertices[i]));
+        outPolygon.normals[i] = ToWorldVector(*this, polygon.normals[i]);
+    }
+}
+
+// ========== 캐스트 ==========
+
+bool ShapeQuery::Raycast(const QueryShape& target, const XMFLOAT2& origin, const XMFLOAT2& direction,
+                         float maxDistance, RaycastHit& outHit)
+{
+    return CircleCast(target, origin, 0.0f, direction, maxDistance, outHit);
+}
+
+bool ShapeQuery::CircleCast(const QueryShape& target, const XMFLOAT2& origin, float radius,
+                            const XMFLOAT2& direction, float maxDistance, RaycastHit& outHit)
+{
+    float t = 0.0f;
+    XMFLOAT2 normal{0.0f, 0.0f};
+    bool inside = false;
+
+    if (target.type == QueryShape::Type::Circle)
+    {
+        if (!RayCircle(origin, direction, target.center, target.radius + radius, maxDistance, t, normal, inside))
+            return false;
+    }
+    else if (target.type == QueryShape::Type::Polygon)
+    {
+        ConvexPolygon polygon;
+        target.ToPolygon(polygon);
+
+        if (!RayRoundedPolygon(origin, direction, polygon, radius, maxDistance, t, normal, inside))
+            return false;
+    }
+    else
+    {
+        XMFLOAT2 localOrigin = ToLocalPoint(target, origin);
+        XMFLOAT2 localDirection = ToLocalVector(target, direction);
+        XMFLOAT2 localNormal;
+
+        if (!RayRoundedBox(localOrigin, localDirection, target.halfExtents, radius, maxDistance, t, localNormal, inside))
+            return false;
+
+        normal = ToWorldVector(target, localNormal);
+    }
+
+    if (inside)
+    {
+        FillHit(outHit, origin, Scale(direction, -1.0f), 0.0f, maxDistance);
+        return true;
+    }
+
+    // 접촉점 = 이동한 원의 표면 (레이는 반지름 0)
+    XMFLOAT2 center = Add(origin, Scale(direction, t));
+    FillHit(outHit, Sub(center, Scale(normal, radius)), normal, t, maxDistance);
+    return true;
+}
+
+bool ShapeQuery::BoxCast(const QueryShape& target, const QueryShape& box,
+                         const XMFLOAT2& direction, float maxDistance, RaycastHit& outHit)
+{
+    if (target.type == QueryShape::Type::Box)
+        return SweepBoxes(target, box, direction, maxDistance, outHit);
+
+    if (target.type == QueryShape::Type::Polygon)
+        return SweepByDistance(target, box, direction, maxDistance, outHit);
+
+    // 원 타깃: 상대 운동으로 원이 박스 쪽으로 이동하는 원 캐스트와 같음
+    XMFLOAT2 localOrigin = ToLocalPoint(box, target.center);
+    XMFLOAT2 localDirection = ToLocalVector(box, Scale(direction, -1.0f));
+
+    float t;
+    XMFLOAT2 localNormal;
+    bool inside;
+
+    if (!RayRoundedBox(localOrigin, localDirection, box.halfExtents, target.radius, maxDistance, t, localNormal, inside))
+        return false;
+
+    if (inside)
+    {
+        FillHit(outHit, box.center, Scale(direction, -1.0f), 0.0f, maxDistance);
+        return true;
+    }
+
+    // 박스 면 법선(박스 → 원)의 반대가 원 표면 법선
+    XMFLOAT2 boxNormal = ToWorldVector(box, localNormal);
+    XMFLOAT2 normal = Scale(boxNormal, -1.0f);
+    FillHit(outHit, Add(target.center, Scale(normal, target.radius)), normal, t, maxDistance);
+    return true;
+}
+
+// ========== 겹침 ==========
+
+bool ShapeQuery::ContainsPoint(const QueryShape& shape, const XMFLOAT2& point)
+{
+    if (shape.type == QueryShape::Type::Circle)
+    {
+        XMFLOAT2 delta = Sub(point, shape.center);
+        return Dot(delta, delta) <= shape.radius * shape.radius;
+    }
+
+    if (shape.type == QueryShape::Type::Polygon)
+    {
+        ConvexPolygon polygon;
+        shape.ToPolygon(polygon);
+
+        ConvexPolygon pointPolygon;
+        pointPolygon.count = 1;
+        pointPolygon.vertices[0] = point;
+        return ConvexPolygon::Overlaps(polygon, pointPolygon);
+    }
+
+    XMFLOAT2 local = ToLocalPoint(shape, point);
+    return fabsf(local.x) <= shape.halfExtents.x && fabsf(local.y) <= shape.halfExtents.y;
+}
+
+bool ShapeQuery::Overlaps(const QueryShape& a, const QueryShape& b)
+{
+    // 다각형/캡슐이 포함되면 둥근 볼록 다각형끼리
+    if (a.type == QueryShape::Type::Polygon || b.type == QueryShape::Type::Polygon)
+    {
+        ConvexPolygon polygonA;
+        ConvexPolygon polygonB;
+        a.ToPolygon(polygonA);
+        b.ToPolygon(polygonB);
+        return ConvexPolygon::Overlaps(polygonA, polygonB);
+    }
+
+    // 원 vs 원
+    if (a.type == QueryShape::Type::Circle && b.type == QueryShape::Type::Circle)
+    {
+        XMFLOAT2 delta = Sub(b.center, a.center);
+        float radiusSum = a.radius + b.radius;
+        return Dot(delta, delta) <= radiusSum * radiusSum;
+    }
+
+    // 박스 vs 원 (박스 최근접점)
+    if (a.type != b.type)
+    {
+        const QueryShape& box = (a.type == QueryShape::Type::Box) ? a : b;
+        const QueryShape& circle = (a.type == QueryShape::Type::Box) ? b : a;
+
+        XMFLOAT2 local = ToLocalPoint(box, circle.center);
+        float dx = local.x - (std::max)(-box.halfExtents.x, (std::min)(local.x, box.halfExtents.x));
+        float dy = local.y - (std::max)(-box.halfExtents.y, (std::min)(local.y, box.halfExtents.y));
+        return dx * dx + dy * dy <= circle.radius * circle.radius;
+    }
+
+    // 박스 vs 박스 (SAT 4축)
+    const XMFLOAT2 axes[4] = { a.axisX, a.axisY, b.axisX, b.axisY };
+    for (const XMFLOAT2& axis : axes)
+    {
+        float minA, maxA, minB, maxB;
+        ProjectBox(a, axis, minA, maxA);
+        ProjectBox(b, axis, minB, maxB);
+
+        if (maxA < minB || maxB < minA)
+            return false;
+    }
+
+    return true;
+}
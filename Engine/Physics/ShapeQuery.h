@@ -0,0 +1,67 @@
+#pragma once
+#include <cstdint>
+#include <DirectXMath.h>
+#include "Physics/ConvexPolygon.h"
+
+using namespace DirectX;
+
+class BaseCollider;
+
+// 레이/캐스트 결과
+struct RaycastHit
+{
+    BaseCollider* collider = nullptr;
+    XMFLOAT2 point{0.0f, 0.0f};    // 월드 접촉점
+    XMFLOAT2 normal{0.0f, 0.0f};   // 맞은 콜라이더 표면 법선 (시작부터 겹치면 -direction)
+    float distance = 0.0f;         // 시작점에서 이동한 거리
+    float fraction = 0.0f;         // distance / maxDistance
+};
+
+// 쿼리용 월드 형태 (OBB, 원, 둥근 볼록 다각형)
+struct QueryShape
+{
+    enum class Type { Box, Circle, Polygon };
+
+    Type type = Type::Circle;
+    XMFLOAT2 center{0.0f, 0.0f};
+    XMFLOAT2 axisX{1.0f, 0.0f};    // 박스 로컬 축 (단위 벡터)
+    XMFLOAT2 axisY{0.0f, 1.0f};
+    XMFLOAT2 halfExtents{0.0f, 0.0f};
+    float radius = 0.0f;
+    ConvexPolygon polygon;         // 다각형/캡슐 꼭짓점과 법선 (center, axisX/Y 기준 로컬, 회전 스윕은 축만 돌림)
+
+    static QueryShape MakeBox(const XMFLOAT2& center, const XMFLOAT2& halfSize, float angle);
+    static QueryShape MakeCircle(const XMFLOAT2& center, float radius);
+
+    // 콜라이더의 현재 월드 형태 (지원하지 않는 타입이면 false)
+    static bool FromCollider(BaseCollider* collider, QueryShape& outShape);
+
+    // 월드 AABB 반 크기 (브로드페이즈 확장량)
+    XMFLOAT2 GetAABBExtents() const;
+
+    // 월드 둥근 볼록 다각형 (박스 = 꼭짓점 4개, 원 = 꼭짓점 1개 + 반지름)
+    void ToPolygon(ConvexPolygon& outPolygon) const;
+};
+
+// 형태 단위 기하 판정 (브로드페이즈 후보에 대해 PhysicsSystem이 호출)
+// - 캐스트는 direction(단위 벡터)으로 maxDistance까지 이동할 때 처음 닿는 거리
+// - 시작부터 겹치면 거리 0, 법선 = -direction
+class ShapeQuery
+{
+public:
+    // 레이 (원점 반지름 0 캐스트)
+    static bool Raycast(const QueryShape& target, const XMFLOAT2& origin, const XMFLOAT2& direction,
+                        float maxDistance, RaycastHit& outHit);
+
+    // 원 캐스트 (원 중심이 origin에서 이동)
+    static bool CircleCast(const QueryShape& target, const XMFLOAT2& origin, float radius,
+                           const XMFLOAT2& direction, float maxDistance, RaycastHit& outHit);
+
+    // 박스 캐스트 (회전 없는 평행 이동, 박스끼리는 SAT 스윕, 다각형 타깃은 거리 기반 전진)
+    static bool BoxCast(const QueryShape& target, const QueryShape& box,
+                        const XMFLOAT2& direction, float maxDistance, RaycastHit& outHit);
+
+    // 겹침
+    static bool ContainsPoint(const QueryShape& shape, const XMFLOAT2& point);
+    static bool Overlaps(const QueryShape& a, const QueryShape& b);
+};
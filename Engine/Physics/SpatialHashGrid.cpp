@@ -0,0 +1,182 @@
+#include "Physics/SpatialHashGrid.h"
+#include <algorithm>
+#include <cmath>
+
+SpatialHashGrid::SpatialHashGrid()
+{
+    table.resize(1024);
+}
+
+uint64_t SpatialHashGrid::MakeKey(int cellX, int cellY)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) |
+           static_cast<uint64_t>(static_cast<uint32_t>(cellY));
+}
+
+int SpatialHashGrid::CellCoord(float value) const
+{
+    return static_cast<int>(floorf(value / cellSize));
+}
+
+void SpatialHashGrid::EnsureTableCapacity(size_t entryCount)
+{
+    // 부하율 50% 이하 유지
+    size_t required = table.size();
+    while (required < entryCount * 2)
+        required *= 2;
+
+    if (required != table.size())
+    {
+        table.assign(required, Slot());
+        stamp = 0;
+    }
+}
+
+int SpatialHashGrid::FindOrAddSlot(uint64_t key)
+{
+    // 64비트 곱셈 해시 + 선형 탐사
+    const size_t mask = table.size() - 1;
+    size_t index = static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32) & mask;
+
+    while (true)
+    {
+        Slot& slot = table[index];
+
+        if (slot.stamp != stamp)
+        {
+            slot.key = key;
+            slot.stamp = stamp;
+            slot.start = 0;
+            slot.count = 0;
+            usedSlots.push_back(static_cast<int>(index));
+            return static_cast<int>(index);
+        }
+
+        if (slot.key == key)
+            return static_cast<int>(index);
+
+        index = (index + 1) & mask;
+    }
+}
+
+void SpatialHashGrid::Build(const std::vector<BaseCollider*>& colliders)
+{
+    stats = Stats();
+
+    if (cellSize <= 0.0f)
+        cellSize = 32.0f;
+
+    items.clear();
+    itemBounds.clear();
+    entries.clear();
+    usedSlots.clear();
+
+    // 1. 콜라이더 AABB가 걸치는 모든 셀 항목 생성
+    for (BaseCollider* collider : colliders)
+    {
+        AABB aabb = ComputeColliderAABB(collider);
+        int item = static_cast<int>(items.size());
+        items.push_back(collider);
+        itemBounds.push_back(aabb);
+
+        int minX = CellCoord(aabb.min.x);
+        int minY = CellCoord(aabb.min.y);
+        int maxX = CellCoord(aabb.max.x);
+        int maxY = CellCoord(aabb.max.y);
+
+        for (int y = minY; y <= maxY; y++)
+        {
+            for (int x = minX; x <= maxX; x++)
+            {
+                entries.push_back({ MakeKey(x, y), item });
+            }
+        }
+    }
+
+    // 2. 이번 스텝 테이블 준비 (stamp 증가로 이전 내용 무효화)
+    EnsureTableCapacity(entries.size());
+
+    stamp++;
+    if (stamp == 0)
+    {
+        // stamp 한 바퀴 → 실제 초기화
+        std::fill(table.begin(), table.end(), Slot());
+        stamp = 1;
+    }
+
+    // 3. 셀별 항목 수 세기
+    for (const CellEntry& entry : entries)
+    {
+        table[FindOrAddSlot(entry.key)].count++;
+    }
+
+    // 4. 셀별 시작 위치 (prefix sum)
+    int offset = 0;
+    for (int slotIndex : usedSlots)
+    {
+        Slot& slot = table[slotIndex];
+        slot.start = offset;
+        offset += slot.count;
+        slot.count = 0;
+    }
+
+    // 5. 셀별로 연속 배치
+    cellItems.resize(entries.size());
+    for (const CellEntry& entry : entries)
+    {
+        Slot& slot = table[FindOrAddSlot(entry.key)];
+        cellItems[slot.start + slot.count] = entry.item;
+        slot.count++;
+    }
+
+    stats.occupiedCells = static_cast<int>(usedSlots.size());
+    stats.cellEntries = static_cast<int>(entries.size());
+}
+
+void SpatialHashGrid::ComputePairs()
+{
+    pairs.clear();
+
+    for (int slotIndex : usedSlots)
+    {
+        const Slot& slot = table[slotIndex];
+        int cellX = static_cast<int32_t>(static_cast<uint32_t>(slot.key >> 32));
+        int cellY = static_cast<int32_t>(static_cast<uint32_t>(slot.key));
+
+        for (int i = 0; i < slot.count; i++)
+        {
+            int itemA = cellItems[slot.start + i];
+            const AABB& a = itemBounds[itemA];
+
+            for (int j = i + 1; j < slot.count; j++)
+            {
+                int itemB = cellItems[slot.start + j];
+                const AABB& b = itemBounds[itemB];
+
+                if (!a.Intersects(b))
+                    continue;
+
+                // 여러 셀에 걸친 쌍은 겹침 영역의 최소 코너가 속한 셀에서만 보고 (중복 제거)
+                float cornerX = (std::max)(a.min.x, b.min.x);
+                float cornerY = (std::max)(a.min.y, b.min.y);
+                if (CellCoord(cornerX) != cellX || CellCoord(cornerY) != cellY)
+                    continue;
+
+                pairs.emplace_back(items[itemA], items[itemB]);
+            }
+        }
+    }
+
+    stats.candidatePairs = static_cast<int>(pairs.size());
+}
+
+void SpatialHashGrid::Clear()
+{
+    items.clear();
+    itemBounds.clear();
+    entries.clear();
+    usedSlots.clear();
+    cellItems.clear();
+    pairs.clear();
+    stats = Stats();
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "Physics/Quadtree.h"
+
+class BaseCollider;
+
+// 균일 격자 공간 해시 브로드페이즈
+// - 정수 셀 좌표를 키로 하는 오픈 어드레싱 해시 테이블 (월드 경계 없음)
+// - 테이블/버퍼는 스텝 간 재사용 (용량이 부족할 때만 확장)
+// - 크기가 비슷한 작은 오브젝트가 많은 씬(탄막)에 적합
+class SpatialHashGrid
+{
+public:
+    // 스텝 통계
+    struct Stats
+    {
+        int occupiedCells = 0;    // 오브젝트가 있는 셀 수
+        int cellEntries = 0;      // (셀, 콜라이더) 항목 수
+        int candidatePairs = 0;   // 같은 셀 + AABB 겹침 쌍 수
+    };
+
+    SpatialHashGrid();
+
+    // 격자 재구성 (콜라이더 AABB가 걸치는 모든 셀에 등록)
+    void Build(const std::vector<BaseCollider*>& colliders);
+
+    // 같은 셀에 있고 AABB가 겹치는 쌍 수집 (중복 없음)
+    void ComputePairs();
+
+    const std::vector<std::pair<BaseCollider*, BaseCollider*>>& GetPairs() const { return pairs; }
+    const Stats& GetStats() const { return stats; }
+
+    // 버퍼 해제
+    void Clear();
+
+    // 셀 크기 (픽셀). 대표 오브젝트 지름의 1~2배 권장
+    float cellSize = 32.0f;
+
+private:
+    struct Slot
+    {
+        uint64_t key = 0;
+        uint32_t stamp = 0;   // stamp가 현재 스텝과 같을 때만 유효 (테이블 초기화 불필요)
+        int start = 0;        // cellItems 시작 위치
+        int count = 0;        // 셀 안의 항목 수
+    };
+
+    struct CellEntry
+    {
+        uint64_t key;
+        int item;             // items 인덱스
+    };
+
+    static uint64_t MakeKey(int cellX, int cellY);
+    int CellCoord(float value) const;
+
+    // 키에 해당하는 슬롯 찾기 (없으면 생성)
+    int FindOrAddSlot(uint64_t key);
+    void EnsureTableCapacity(size_t entryCount);
+
+private:
+    std::vector<Slot> table;           // 오픈 어드레싱 (크기 = 2의 거듭제곱)
+    std::vector<int> usedSlots;        // 이번 스텝에 사용된 슬롯
+    std::vector<CellEntry> entries;    // (셀 키, 항목) 목록
+    std::vector<int> cellItems;        // 셀별로 연속 배치된 항목 인덱스
+
+    std::vector<BaseCollider*> items;  // 항목 → 콜라이더
+    std::vector<AABB> itemBounds;      // 항목 → AABB
+
+    std::vector<std::pair<BaseCollider*, BaseCollider*>> pairs;
+
+    uint32_t stamp = 0;
+    Stats stats;
+};
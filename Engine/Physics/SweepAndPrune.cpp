@@ -0,0 +1,211 @@
+#include "Physics/SweepAndPrune.h"
+#include <algorithm>
+#include <functional>
+
+SweepAndPrune::SweepAndPrune()
+{
+    proxies.reserve(256);
+    endpoints.reserve(512);
+    activeProxies.reserve(64);
+    pairs.reserve(256);
+}
+
+void SweepAndPrune::Update(const std::vector<BaseCollider*>& colliders)
+{
+    stats = Stats();
+    stepCount++;
+
+    // 1. 프록시 동기화 (새 콜라이더는 끝점 추가)
+    size_t addedCount = 0;
+
+    for (BaseCollider* collider : colliders)
+    {
+        AABB aabb = ComputeColliderAABB(collider);
+        aabb.min.x -= aabbMargin;
+        aabb.min.y -= aabbMargin;
+        aabb.max.x += aabbMargin;
+        aabb.max.y += aabbMargin;
+
+        auto it = proxyLookup.find(collider);
+        if (it != proxyLookup.end())
+        {
+            Proxy& proxy = proxies[it->second];
+            proxy.aabb = aabb;
+            proxy.stamp = stepCount;
+            continue;
+        }
+
+        int proxyIndex;
+        if (!freeProxies.empty())
+        {
+            proxyIndex = freeProxies.back();
+            freeProxies.pop_back();
+        }
+        else
+        {
+            proxyIndex = static_cast<int>(proxies.size());
+            proxies.emplace_back();
+        }
+
+        Proxy& proxy = proxies[proxyIndex];
+        proxy.collider = collider;
+        proxy.aabb = aabb;
+        proxy.stamp = stepCount;
+        proxy.activeIndex = -1;
+        proxyLookup.emplace(collider, proxyIndex);
+
+        Endpoint minPoint;
+        minPoint.data = static_cast<uint32_t>(proxyIndex) << 1;
+        Endpoint maxPoint;
+        maxPoint.data = (static_cast<uint32_t>(proxyIndex) << 1) | 1u;
+        endpoints.push_back(minPoint);
+        endpoints.push_back(maxPoint);
+
+        addedCount++;
+    }
+
+    // 2. 이번 스텝에 없는 콜라이더 제거
+    RemoveStaleProxies();
+
+    // 3. 끝점 값 갱신 후 정렬
+    RefreshEndpointValues();
+
+    // 축 변경 또는 대량 추가 시에는 전체 정렬이 삽입 정렬보다 빠름
+    if (sortAlongY != sortedAlongY || addedCount * 2 * 8 > endpoints.size())
+    {
+        std::sort(endpoints.begin(), endpoints.end());
+        sortedAlongY = sortAlongY;
+        stats.fullSort = true;
+    }
+    else
+    {
+        InsertionSort();
+    }
+
+    stats.proxyCount = static_cast<int>(proxyLookup.size());
+}
+
+void SweepAndPrune::RemoveStaleProxies()
+{
+    bool removedAny = false;
+
+    for (auto it = proxyLookup.begin(); it != proxyLookup.end();)
+    {
+        Proxy& proxy = proxies[it->second];
+        if (proxy.stamp != stepCount)
+        {
+            // 삭제된 콜라이더일 수 있으므로 포인터는 역참조하지 않음
+            proxy.collider = nullptr;
+            freeProxies.push_back(it->second);
+            it = proxyLookup.erase(it);
+            removedAny = true;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    if (!removedAny)
+        return;
+
+    // 해시 순회 순서와 무관하게 작은 인덱스부터 재사용 (실행마다 같은 교환 횟수)
+    std::sort(freeProxies.begin(), freeProxies.end(), std::greater<int>());
+
+    // 제거된 프록시의 끝점 삭제 (나머지 순서는 유지)
+    endpoints.erase(
+        std::remove_if(endpoints.begin(), endpoints.end(), [this](const Endpoint& endpoint)
+        {
+            return proxies[endpoint.GetProxy()].collider == nullptr;
+        }),
+        endpoints.end()
+    );
+}
+
+void SweepAndPrune::RefreshEndpointValues()
+{
+    for (Endpoint& endpoint : endpoints)
+    {
+        const AABB& aabb = proxies[endpoint.GetProxy()].aabb;
+
+        if (sortAlongY)
+            endpoint.value = endpoint.IsMax() ? aabb.max.y : aabb.min.y;
+        else
+            endpoint.value = endpoint.IsMax() ? aabb.max.x : aabb.min.x;
+    }
+}
+
+void SweepAndPrune::InsertionSort()
+{
+    // 이전 스텝 순서가 거의 유지되므로 교환 횟수 = 움직임의 양
+    int swapCount = 0;
+
+    for (size_t i = 1; i < endpoints.size(); i++)
+    {
+        Endpoint key = endpoints[i];
+        size_t j = i;
+
+        while (j > 0 && key < endpoints[j - 1])
+        {
+            endpoints[j] = endpoints[j - 1];
+            j--;
+            swapCount++;
+        }
+
+        endpoints[j] = key;
+    }
+
+    stats.swapCount = swapCount;
+}
+
+void SweepAndPrune::ComputePairs()
+{
+    pairs.clear();
+    activeProxies.clear();
+
+    for (const Endpoint& endpoint : endpoints)
+    {
+        int proxyIndex = endpoint.GetProxy();
+        Proxy& proxy = proxies[proxyIndex];
+
+        if (endpoint.IsMax())
+        {
+            // 활성 목록에서 제거 (마지막 원소와 교환)
+            int last = activeProxies.back();
+            activeProxies[proxy.activeIndex] = last;
+            proxies[last].activeIndex = proxy.activeIndex;
+            activeProxies.pop_back();
+            proxy.activeIndex = -1;
+            continue;
+        }
+
+        // 정렬 축에서 겹치는 활성 프록시 중 반대 축도 겹치는 것만 쌍으로
+        for (int otherIndex : activeProxies)
+        {
+            const AABB& other = proxies[otherIndex].aabb;
+
+            bool overlaps = sortedAlongY
+                ? !(proxy.aabb.max.x < other.min.x || proxy.aabb.min.x > other.max.x)
+                : !(proxy.aabb.max.y < other.min.y || proxy.aabb.min.y > other.max.y);
+
+            if (overlaps)
+                pairs.emplace_back(proxies[otherIndex].collider, proxy.collider);
+        }
+
+        proxy.activeIndex = static_cast<int>(activeProxies.size());
+        activeProxies.push_back(proxyIndex);
+    }
+
+    stats.candidatePairs = static_cast<int>(pairs.size());
+}
+
+void SweepAndPrune::Clear()
+{
+    proxies.clear();
+    freeProxies.clear();
+    proxyLookup.clear();
+    endpoints.clear();
+    activeProxies.clear();
+    pairs.clear();
+    stats = Stats();
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Physics/Quadtree.h"
+
+class BaseCollider;
+
+// Sweep and Prune 브로드페이즈 (한 축 정렬)
+// - 끝점(endpoint) 배열을 스텝 간 유지하고 삽입 정렬로 갱신 (시간적 일관성)
+// - 움직임이 적은 프레임은 거의 O(N), 한 축으로 퍼진 씬(횡스크롤)에 적합
+class SweepAndPrune
+{
+public:
+    // 스텝 통계
+    struct Stats
+    {
+        int proxyCount = 0;       // 등록된 콜라이더 수
+        int swapCount = 0;        // 삽입 정렬 교환 횟수
+        int candidatePairs = 0;   // 정렬 축 + 반대 축 겹침 쌍 수
+        bool fullSort = false;    // 대량 추가로 전체 정렬했는지
+    };
+
+    SweepAndPrune();
+
+    // 콜라이더 목록 동기화 (추가/이동/제거) 후 끝점 정렬
+    void Update(const std::vector<BaseCollider*>& colliders);
+
+    // 정렬된 끝점을 훑어 겹치는 쌍 수집
+    void ComputePairs();
+
+    const std::vector<std::pair<BaseCollider*, BaseCollider*>>& GetPairs() const { return pairs; }
+    const Stats& GetStats() const { return stats; }
+
+    // 모든 프록시 제거
+    void Clear();
+
+    // 정렬 축 (false = X축, true = Y축). 변경 시 다음 Update에서 전체 정렬
+    bool sortAlongY = false;
+
+    // AABB 여유 공간 (스텝 중 위치 보정 대비)
+    float aabbMargin = 2.0f;
+
+private:
+    struct Proxy
+    {
+        BaseCollider* collider = nullptr;
+        AABB aabb;
+        unsigned int stamp = 0;   // 마지막으로 확인된 스텝
+        int activeIndex = -1;     // Sweep 중 활성 목록 위치
+    };
+
+    struct Endpoint
+    {
+        float value = 0.0f;
+        uint32_t data = 0;        // (proxyIndex << 1) | isMax
+
+        int GetProxy() const { return static_cast<int>(data >> 1); }
+        bool IsMax() const { return (data & 1u) != 0; }
+
+        // 같은 값이면 min을 먼저 (맞닿은 경우도 겹침으로 처리)
+        bool operator<(const Endpoint& other) const
+        {
+            if (value != other.value)
+                return value < other.value;
+            return (data & 1u) < (other.data & 1u);
+        }
+    };
+
+    void RefreshEndpointValues();
+    void InsertionSort();
+    void RemoveStaleProxies();
+
+private:
+    std::vector<Proxy> proxies;
+    std::vector<int> freeProxies;
+    std::unordered_map<BaseCollider*, int> proxyLookup;
+
+    std::vector<Endpoint> endpoints;
+    std::vector<int> activeProxies;  // Sweep 활성 목록 (재사용)
+    std::vector<std::pair<BaseCollider*, BaseCollider*>> pairs;
+
+    unsigned int stepCount = 0;
+    bool sortedAlongY = false;
+    Stats stats;
+};
@@ -0,0 +1,317 @@
+#include "Physics/TilemapCollider.h"
+#include "Physics/BoxCollider2D.h"
+#include "Physics/PhysicsSystem.h"
+#include "Core/GameObject.h"
+#include <algorithm>
+
+TilemapCollider::~TilemapCollider()
+{
+    ReleaseColliders();
+}
+
+void TilemapCollider::OnDestroy()
+{
+    ReleaseColliders();
+}
+
+// ========== 타일 ==========
+
+void TilemapCollider::SetGridSize(int newWidth, int newHeight)
+{
+    width = (std::max)(0, newWidth);
+    height = (std::max)(0, newHeight);
+
+    tiles.assign(static_cast<size_t>(width) * height, 0);
+    cellRects.assign(tiles.size(), -1);
+    dirtyCells.clear();
+    Rebuild();
+}
+
+void TilemapCollider::SetTile(int x, int y, bool solid)
+{
+    if (x < 0 || y < 0 || x >= width || y >= height)
+        return;
+
+    uint8_t value = solid ? 1 : 0;
+    int index = CellIndex(x, y);
+    if (tiles[index] == value)
+        return;
+
+    tiles[index] = value;
+    dirtyCells.push_back(index);
+}
+
+bool TilemapCollider::IsSolid(int x, int y) const
+{
+    if (x < 0 || y < 0 || x >= width || y >= height)
+        return false;
+    return tiles[CellIndex(x, y)] != 0;
+}
+
+void TilemapCollider::SetTiles(const std::vector<uint8_t>& newTiles)
+{
+    if (newTiles.size() != tiles.size())
+        return;
+
+    for (size_t i = 0; i < newTiles.size(); i++)
+        tiles[i] = newTiles[i] ? 1 : 0;
+
+    Rebuild();
+}
+
+void TilemapCollider::SetTileSize(const XMFLOAT2& size)
+{
+    tileSize = size;
+    for (int slot = 0; slot < static_cast<int>(rects.size()); slot++)
+    {
+        if (rects[slot].width > 0)
+            ApplyRectToCollider(slot);
+    }
+}
+
+void TilemapCollider::SetOrigin(const XMFLOAT2& newOrigin)
+{
+    origin = newOrigin;
+    for (int slot = 0; slot < static_cast<int>(rects.size()); slot++)
+    {
+        if (rects[slot].width > 0)
+            ApplyRectToCollider(slot);
+    }
+}
+
+void TilemapCollider::SetLayer(int layerIndex)
+{
+    layer = (layerIndex >= 0 && layerIndex < 32) ? layerIndex : 0;
+    for (BoxCollider2D* box : colliders)
+        box->SetLayer(layer);
+}
+
+void TilemapCollider::SetCollisionMask(uint32_t mask)
+{
+    collisionMask = mask;
+    for (BoxCollider2D* box : colliders)
+        box->SetCollisionMask(collisionMask);
+}
+
+// ========== 합치기 ==========
+
+void TilemapCollider::Rebuild()
+{
+    // 모든 슬롯을 비우고 0번부터 다시 채움 (콜라이더는 재사용)
+    rects.assign(colliders.size(), TileRect{});
+    freeSlots.clear();
+    for (int slot = static_cast<int>(colliders.size()) - 1; slot >= 0; slot--)
+        freeSlots.push_back(slot);
+
+    rectCount = 0;
+    cellRects.assign(tiles.size(), -1);
+    dirtyCells.clear();
+
+    if (width > 0 && height > 0)
+        MergeRegion(0, 0, width - 1, height - 1);
+
+    // 남은 슬롯은 뒤쪽에 모여 있으므로 콜라이더를 해제하고 잘라냄
+    while (colliders.size() > static_cast<size_t>(rectCount))
+    {
+        ReleaseCollider(colliders.back());
+        colliders.pop_back();
+        rects.pop_back();
+    }
+    freeSlots.clear();
+}
+
+void TilemapCollider::ApplyChanges()
+{
+    if (dirtyCells.empty())
+        return;
+
+    // 바뀐 타일마다: 그 타일과 상하좌우 이웃을 덮는 사각형을 지우고 그 범위만 다시 합침
+    // (이웃 사각형까지 지워야 새 타일이 기존 사각형과 합쳐짐)
+    static const int Neighbors[5][2] = { { 0, 0 }, { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+
+    for (int cell : dirtyCells)
+    {
+        int cellX = cell % width;
+        int cellY = cell / width;
+
+        int minX = cellX, minY = cellY;
+        int maxX = cellX, maxY = cellY;
+
+        for (const auto& neighbor : Neighbors)
+        {
+            int x = cellX + neighbor[0];
+            int y = cellY + neighbor[1];
+            if (x < 0 || y < 0 || x >= width || y >= height)
+                continue;
+
+            int slot = cellRects[CellIndex(x, y)];
+            if (slot < 0)
+                continue;
+
+            const TileRect& rect = rects[slot];
+            minX = (std::min)(minX, rect.x);
+            minY = (std::min)(minY, rect.y);
+            maxX = (std::max)(maxX, rect.x + rect.width - 1);
+            maxY = (std::max)(maxY, rect.y + rect.height - 1);
+            RemoveRect(slot);
+        }
+
+        MergeRegion(minX, minY, maxX, maxY);
+    }
+
+    dirtyCells.clear();
+
+    // 다시 쓰이지 않은 슬롯의 콜라이더는 꺼둔 채 재사용 대기
+    for (int slot : freeSlots)
+        colliders[slot]->SetEnabled(false);
+}
+
+void TilemapCollider::MergeRegion(int minX, int minY, int maxX, int maxY)
+{
+    auto isOpen = [&](int x, int y)
+    {
+        int index = CellIndex(x, y);
+        return tiles[index] != 0 && cellRects[index] < 0;
+    };
+
+    for (int y = minY; y <= maxY; y++)
+    {
+        for (int x = minX; x <= maxX; x++)
+        {
+            if (!isOpen(x, y))
+                continue;
+
+            // 오른쪽으로 최대한
+            int rectWidth = 1;
+            while (x + rectWidth <= maxX && isOpen(x + rectWidth, y))
+                rectWidth++;
+
+            // 같은 폭의 다음 행이 모두 비어 있는 동안 y 방향으로
+            int rectHeight = 1;
+            while (y + rectHeight <= maxY)
+            {
+                bool rowOpen = true;
+                for (int i = 0; i < rectWidth && rowOpen; i++)
+                    rowOpen = isOpen(x + i, y + rectHeight);
+                if (!rowOpen)
+                    break;
+                rectHeight++;
+            }
+
+            AddRect({ x, y, rectWidth, rectHeight });
+            x += rectWidth - 1;
+        }
+    }
+}
+
+// ========== 사각형 / 콜라이더 ==========
+
+void TilemapCollider::AddRect(const TileRect& rect)
+{
+    int slot;
+    if (!freeSlots.empty())
+    {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+        rects[slot] = rect;
+    }
+    else
+    {
+        slot = static_cast<int>(rects.size());
+        rects.push_back(rect);
+        colliders.push_back(CreateCollider());
+    }
+
+    for (int y = rect.y; y < rect.y + rect.height; y++)
+        for (int x = rect.x; x < rect.x + rect.width; x++)
+            cellRects[CellIndex(x, y)] = slot;
+
+    rectCount++;
+    ApplyRectToCollider(slot);
+    colliders[slot]->SetEnabled(enabled);
+}
+
+void TilemapCollider::RemoveRect(int slot)
+{
+    TileRect& rect = rects[slot];
+    for (int y = rect.y; y < rect.y + rect.height; y++)
+        for (int x = rect.x; x < rect.x + rect.width; x++)
+            cellRects[CellIndex(x, y)] = -1;
+
+    // 콜라이더는 같은 ApplyChanges 안에서 다른 사각형으로 재사용 (정적 트리에서는 이동으로 처리)
+    rect = TileRect{};
+    freeSlots.push_back(slot);
+    rectCount--;
+}
+
+void TilemapCollider::ApplyRectToCollider(int slot)
+{
+    const TileRect& rect = rects[slot];
+    BoxCollider2D* box = colliders[slot];
+
+    box->SetOffset(origin.x + (rect.x + rect.width * 0.5f) * tileSize.x,
+                   origin.y + (rect.y + rect.height * 0.5f) * tileSize.y);
+    box->halfSize = { rect.width * tileSize.x * 0.5f, rect.height * tileSize.y * 0.5f };
+}
+
+BoxCollider2D* TilemapCollider::CreateCollider()
+{
+    BoxCollider2D* box = new BoxCollider2D();
+    box->SetOwner(gameObject);
+    box->SetApplication(application);
+    box->SetLayer(layer);
+    box->SetCollisionMask(collisionMask);
+
+    if (gameObject && gameObject->GetPhysicsWorld())
+        gameObject->GetPhysicsWorld()->RegisterComponent(box);
+
+    return box;
+}
+
+void TilemapCollider::ReleaseCollider(BoxCollider2D* box)
+{
+    if (gameObject && gameObject->GetPhysicsWorld())
+        gameObject->GetPhysicsWorld()->UnregisterComponent(box);
+    delete box;
+}
+
+void TilemapCollider::ReleaseColliders()
+{
+    for (BoxCollider2D* box : colliders)
+        ReleaseCollider(box);
+
+    colliders.clear();
+    rects.clear();
+    freeSlots.clear();
+    cellRects.assign(tiles.size(), -1);
+    rectCount = 0;
+}
+
+// ========== 컴포넌트 ==========
+
+void TilemapCollider::FixedUpdate(float fixedDelta)
+{
+    // 물리 스텝 전에 호출되므로 여기서 콜라이더를 바꿔도 안전
+    ApplyChanges();
+}
+
+void TilemapCollider::DebugDraw()
+{
+    for (int slot = 0; slot < static_cast<int>(rects.size()); slot++)
+    {
+        if (rects[slot].width > 0)
+            colliders[slot]->DebugDraw();
+    }
+}
+
+void TilemapCollider::OnEnable()
+{
+    for (int slot = 0; slot < static_cast<int>(rects.size()); slot++)
+        colliders[slot]->SetEnabled(rects[slot].width > 0);
+}
+
+void TilemapCollider::OnDisable()
+{
+    for (BoxCollider2D* box : colliders)
+        box->SetEnabled(false);
+}
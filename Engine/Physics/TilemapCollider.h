@@ -0,0 +1,112 @@
+#pragma once
+#include "Core/Component.h"
+#include <cstdint>
+#include <vector>
+#include <DirectXMath.h>
+
+using namespace DirectX;
+
+class BoxCollider2D;
+
+// 타일 격자 콜라이더
+// - 채워진 타일을 탐욕적으로 축 정렬 사각형으로 합쳐 사각형마다 BoxCollider2D 하나를 만듦
+//   (타일마다 콜라이더를 두는 것보다 콜라이더 수가 훨씬 적고, 합쳐진 타일 사이 내부 모서리가 없음)
+// - 만든 BoxCollider2D는 GameObject 컴포넌트 목록에 넣지 않고 PhysicsSystem에 직접 등록
+//   (Rigidbody2D가 없으면 정적 트리에 들어감, 충돌 이벤트는 이 GameObject의 컴포넌트로 전달)
+// - SetTile 변경은 다음 FixedUpdate(또는 ApplyChanges)에서 바뀐 타일 주변 사각형만 다시 합침
+// - 타일 (x, y)의 로컬 영역 = origin + (x, y) * tileSize 부터 tileSize 크기 (Transform 스케일 1 기준)
+class TilemapCollider : public Component
+{
+public:
+    TilemapCollider() = default;
+    ~TilemapCollider();
+
+    // 격자 크기 (모든 타일을 비우고 사각형 제거)
+    void SetGridSize(int newWidth, int newHeight);
+    int GetWidth() const { return width; }
+    int GetHeight() const { return height; }
+
+    // 타일 (범위 밖은 무시 / 빈 타일)
+    void SetTile(int x, int y, bool solid);
+    bool IsSolid(int x, int y) const;
+
+    // 전체 타일 (행 우선, width * height, 0 = 빈 타일) - 설정 후 전체 다시 합침
+    void SetTiles(const std::vector<uint8_t>& newTiles);
+    const std::vector<uint8_t>& GetTiles() const { return tiles; }
+
+    // 타일 크기와 격자 원점 (로컬 픽셀) - 바꾸면 전체 다시 합침
+    void SetTileSize(const XMFLOAT2& size);
+    XMFLOAT2 GetTileSize() const { return tileSize; }
+    void SetOrigin(const XMFLOAT2& newOrigin);
+    XMFLOAT2 GetOrigin() const { return origin; }
+
+    // 생성한 콜라이더에 적용할 충돌 설정
+    void SetLayer(int layerIndex);
+    int GetLayer() const { return layer; }
+    void SetCollisionMask(uint32_t mask);
+    uint32_t GetCollisionMask() const { return collisionMask; }
+
+    // 대기 중인 타일 변경 반영 (스텝 밖에서 호출, FixedUpdate가 자동 호출)
+    void ApplyChanges();
+
+    // 전체 격자를 처음부터 다시 합침 (국소 갱신이 누적돼 사각형이 잘게 나뉘었을 때)
+    void Rebuild();
+
+    // 합쳐진 사각형 (타일 단위)
+    struct TileRect
+    {
+        int x = 0;
+        int y = 0;
+        int width = 0;
+        int height = 0;
+    };
+
+    int GetRectCount() const { return rectCount; }
+
+    // 사각형 슬롯 (빈 슬롯은 width = 0) - 디버그/통계용
+    const std::vector<TileRect>& GetRects() const { return rects; }
+
+    // 생성한 콜라이더 (빈 슬롯은 nullptr, PhysicsSystem 등록/해제용)
+    const std::vector<BoxCollider2D*>& GetColliders() const { return colliders; }
+
+    void FixedUpdate(float fixedDelta) override;
+    void DebugDraw() override;
+    void OnDestroy() override;
+
+protected:
+    void OnEnable() override;
+    void OnDisable() override;
+
+private:
+    int CellIndex(int x, int y) const { return y * width + x; }
+
+    // 사각형 추가/제거 (콜라이더 생성/재사용 + 물리 월드 등록)
+    void AddRect(const TileRect& rect);
+    void RemoveRect(int slot);
+    void ApplyRectToCollider(int slot);
+
+    // [minX, maxX] x [minY, maxY] 범위에서 사각형에 속하지 않은 채워진 타일을 탐욕적으로 합침
+    // (행 우선으로 시작 타일을 찾아 오른쪽으로 최대한, 그 폭 그대로 다음 행(y + 1)으로 최대한 확장)
+    void MergeRegion(int minX, int minY, int maxX, int maxY);
+
+    // 콜라이더 생성(물리 월드 등록)/해제
+    BoxCollider2D* CreateCollider();
+    void ReleaseCollider(BoxCollider2D* box);
+    void ReleaseColliders();
+
+    int width = 0;
+    int height = 0;
+    XMFLOAT2 tileSize{ 16.0f, 16.0f };
+    XMFLOAT2 origin{ 0.0f, 0.0f };
+    int layer = 0;
+    uint32_t collisionMask = 0xFFFFFFFFu;
+
+    std::vector<uint8_t> tiles;           // 0 = 빈 타일
+    std::vector<int> cellRects;           // 타일별 사각형 슬롯 (-1 = 빈 타일)
+    std::vector<TileRect> rects;          // 사각형 슬롯
+    std::vector<BoxCollider2D*> colliders;// 슬롯별 콜라이더
+    std::vector<int> freeSlots;           // 빈 슬롯 (콜라이더는 등록된 채 꺼진 상태로 재사용 대기)
+    int rectCount = 0;
+
+    std::vector<int> dirtyCells;          // 대기 중인 변경 타일
+};
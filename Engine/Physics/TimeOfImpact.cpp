@@ -0,0 +1,362 @@
+#include "Physics/TimeOfImpact.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace
+{
+    inline float Dot(const XMFLOAT2& a, const XMFLOAT2& b) { return a.x * b.x + a.y * b.y; }
+    inline XMFLOAT2 Sub(const XMFLOAT2& a, const XMFLOAT2& b) { return { a.x - b.x, a.y - b.y }; }
+    inline XMFLOAT2 Add(const XMFLOAT2& a, const XMFLOAT2& b) { return { a.x + b.x, a.y + b.y }; }
+    inline XMFLOAT2 Scale(const XMFLOAT2& v, float s) { return { v.x * s, v.y * s }; }
+    inline float Length(const XMFLOAT2& v) { return sqrtf(Dot(v, v)); }
+
+    inline XMFLOAT2 Rotate(const XMFLOAT2& v, float cosA, float sinA)
+    {
+        return { v.x * cosA - v.y * sinA, v.x * sinA + v.y * cosA };
+    }
+
+    // 방향 정규화 (길이 0이면 fallback)
+    inline XMFLOAT2 Normalize(const XMFLOAT2& v, const XMFLOAT2& fallback)
+    {
+        float length = Length(v);
+        return (length > 0.0001f) ? Scale(v, 1.0f / length) : fallback;
+    }
+
+    void GetBoxVertices(const QueryShape& box, XMFLOAT2 (&outVertices)[4])
+    {
+        XMFLOAT2 x = Scale(box.axisX, box.halfExtents.x);
+        XMFLOAT2 y = Scale(box.axisY, box.halfExtents.y);
+
+        outVertices[0] = Sub(Sub(box.center, x), y);
+        outVertices[1] = Sub(Add(box.center, x), y);
+        outVertices[2] = Add(Add(box.center, x), y);
+        outVertices[3] = Add(Sub(box.center, x), y);
+    }
+
+    XMFLOAT2 ClosestPointOnSegment(const XMFLOAT2& point, const XMFLOAT2& start, const XMFLOAT2& end)
+    {
+        XMFLOAT2 edge = Sub(end, start);
+        float lengthSq = Dot(edge, edge);
+        if (lengthSq <= 0.0f)
+            return start;
+
+        float t = (std::max)(0.0f, (std::min)(1.0f, Dot(Sub(point, start), edge) / lengthSq));
+        return Add(start, Scale(edge, t));
+    }
+
+    // 투영 구간이 떨어져 있는 축이 있으면 분리
+    bool HasSeparatingAxis(const XMFLOAT2 (&verticesA)[4], const XMFLOAT2 (&verticesB)[4], const XMFLOAT2& axis)
+    {
+        float minA = FLT_MAX, maxA = -FLT_MAX;
+        float minB = FLT_MAX, maxB = -FLT_MAX;
+
+        for (int i = 0; i < 4; i++)
+        {
+            float projectionA = Dot(verticesA[i], axis);
+            float projectionB = Dot(verticesB[i], axis);
+            minA = (std::min)(minA, projectionA);
+            maxA = (std::max)(maxA, projectionA);
+            minB = (std::min)(minB, projectionB);
+            maxB = (std::max)(maxB, projectionB);
+        }
+
+        return maxA < minB || maxB < minA;
+    }
+
+    float DistanceCircles(const QueryShape& a, const QueryShape& b, XMFLOAT2& outNormal)
+    {
+        XMFLOAT2 delta = Sub(b.center, a.center);
+        outNormal = Normalize(delta, { 0.0f, 1.0f });
+        return (std::max)(0.0f, Length(delta) - fabsf(a.radius) - fabsf(b.radius));
+    }
+
+    // 법선 = 박스 → 원
+    float DistanceBoxCircle(const QueryShape& box, const QueryShape& circle, XMFLOAT2& outNormal)
+    {
+        XMFLOAT2 delta = Sub(circle.center, box.center);
+        float localX = Dot(delta, box.axisX);
+        float localY = Dot(delta, box.axisY);
+
+        float clampedX = (std::max)(-box.halfExtents.x, (std::min)(box.halfExtents.x, localX));
+        float clampedY = (std::max)(-box.halfExtents.y, (std::min)(box.halfExtents.y, localY));
+
+        // 원 중심이 박스 안 = 겹침
+        if (clampedX == localX && clampedY == localY)
+        {
+            outNormal = Normalize(delta, box.axisY);
+            return 0.0f;
+        }
+
+        XMFLOAT2 closest = Add(box.center, Add(Scale(box.axisX, clampedX), Scale(box.axisY, clampedY)));
+        XMFLOAT2 offset = Sub(circle.center, closest);
+        float distance = Length(offset);
+
+        outNormal = Normalize(offset, box.axisY);
+        return (std::max)(0.0f, distance - fabsf(circle.radius));
+    }
+
+    // 분리된 볼록 다각형 사이 거리 = 꼭짓점 ↔ 상대 변 최단 거리
+    float DistanceBoxes(const QueryShape& a, const QueryShape& b, XMFLOAT2& outNormal)
+    {
+        XMFLOAT2 verticesA[4];
+        XMFLOAT2 verticesB[4];
+        GetBoxVertices(a, verticesA);
+        GetBoxVertices(b, verticesB);
+
+        outNormal = Normalize(Sub(b.center, a.center), { 0.0f, 1.0f });
+
+        const XMFLOAT2 axes[4] = { a.axisX, a.axisY, b.axisX, b.axisY };
+        bool separated = false;
+        for (const XMFLOAT2& axis : axes)
+        {
+            if (HasSeparatingAxis(verticesA, verticesB, axis))
+            {
+                separated = true;
+                break;
+            }
+        }
+
+        if (!separated)
+            return 0.0f;
+
+        float bestDistanceSq = FLT_MAX;
+        XMFLOAT2 bestOffset{ 0.0f, 0.0f };
+
+        for (int i = 0; i < 4; i++)
+        {
+            for (int j = 0; j < 4; j++)
+            {
+                // A 꼭짓점 → B 변
+                XMFLOAT2 closestOnB = ClosestPointOnSegment(verticesA[i], verticesB[j], verticesB[(j + 1) % 4]);
+                XMFLOAT2 offset = Sub(closestOnB, verticesA[i]);
+                float distanceSq = Dot(offset, offset);
+                if (distanceSq < bestDistanceSq)
+                {
+                    bestDistanceSq = distanceSq;
+                    bestOffset = offset;
+                }
+
+                // B 꼭짓점 → A 변 (법선은 A → B)
+                XMFLOAT2 closestOnA = ClosestPointOnSegment(verticesB[i], verticesA[j], verticesA[(j + 1) % 4]);
+                offset = Sub(verticesB[i], closestOnA);
+                distanceSq = Dot(offset, offset);
+                if (distanceSq < bestDistanceSq)
+                {
+                    bestDistanceSq = distanceSq;
+                    bestOffset = offset;
+                }
+            }
+        }
+
+        outNormal = Normalize(bestOffset, outNormal);
+        return sqrtf(bestDistanceSq);
+    }
+}
+
+// ========== ShapeSweep ==========
+
+QueryShape ShapeSweep::GetShape(float t) const
+{
+    float angle = rotation * t;
+    float cosA = cosf(angle);
+    float sinA = sinf(angle);
+
+    QueryShape result = shape;
+    XMFLOAT2 arm = Rotate(Sub(shape.center, pivot), cosA, sinA);
+    result.center = Add(Add(pivot, Scale(translation, t)), arm);
+    result.axisX = Rotate(shape.axisX, cosA, sinA);
+    result.axisY = Rotate(shape.axisY, cosA, sinA);
+    return result;
+}
+
+ShapeSweep ShapeSweep::GetRemaining(float t) const
+{
+    ShapeSweep remaining;
+    remaining.shape = GetShape(t);
+    remaining.pivot = Add(pivot, Scale(translation, t));
+    remaining.translation = Scale(translation, 1.0f - t);
+    remaining.rotation = rotation * (1.0f - t);
+    return remaining;
+}
+
+float ShapeSweep::GetRotationReach() const
+{
+    // 원은 자기 중심 회전에 불변이므로 중심까지 거리만
+    float reach = Length(Sub(shape.center, pivot));
+    if (shape.type == QueryShape::Type::Box)
+        reach += Length(shape.halfExtents);
+
+    if (shape.type == QueryShape::Type::Polygon)
+    {
+        float farthest = 0.0f;
+        for (int i = 0; i < shape.polygon.count; i++)
+            farthest = (std::max)(farthest, Length(shape.polygon.vertices[i]));
+        reach += farthest + fabsf(shape.polygon.radius);
+    }
+    return reach;
+}
+
+float ShapeSweep::GetMotionReach() const
+{
+    return Length(translation) + fabsf(rotation) * GetRotationReach();
+}
+
+namespace
+{
+    // 다각형 중심에서 가장 가까운 변까지 거리 (선분/점은 0)
+    float GetPolygonInnerExtent(const ConvexPolygon& polygon)
+    {
+        if (polygon.count < 3)
+            return 0.0f;
+
+        float inner = FLT_MAX;
+        for (int i = 0; i < polygon.count; i++)
+            inner = (std::min)(inner, Dot(polygon.normals[i], polygon.vertices[i]));
+        return (std::max)(0.0f, inner);
+    }
+}
+
+float ShapeSweep::GetMinExtent() const
+{
+    if (shape.type == QueryShape::Type::Box)
+        return (std::min)(shape.halfExtents.x, shape.halfExtents.y);
+
+    if (shape.type == QueryShape::Type::Polygon)
+        return GetPolygonInnerExtent(shape.polygon) + fabsf(shape.polygon.radius);
+
+    return fabsf(shape.radius);
+}
+
+ShapeSweep ShapeSweep::GetCore(float inset) const
+{
+    ShapeSweep core = *this;
+    if (shape.type == QueryShape::Type::Box)
+    {
+        core.shape.halfExtents.x = (std::max)(0.0f, shape.halfExtents.x - inset);
+        core.shape.halfExtents.y = (std::max)(0.0f, shape.halfExtents.y - inset);
+    }
+    else if (shape.type == QueryShape::Type::Polygon)
+    {
+        // 반지름을 먼저 줄이고 남은 만큼 꼭짓점을 중심 쪽으로 모음 (변 법선은 그대로)
+        ConvexPolygon& polygon = core.shape.polygon;
+        float radius = fabsf(shape.polygon.radius);
+        polygon.radius = (std::max)(0.0f, radius - inset);
+        core.shape.radius = polygon.radius;
+
+        float remaining = inset - radius;
+        if (remaining > 0.0f)
+        {
+            float inner = GetPolygonInnerExtent(shape.polygon);
+            if (inner <= 0.0f)
+            {
+                // 선분: 반지름 = 두께이므로 길이만 중심 쪽으로 (중심점 요청이면 점)
+                float halfLength = Length(shape.polygon.vertices[0]);
+                inner = (halfLength > 0.0f) ? halfLength : 1.0f;
+            }
+
+            float factor = (std::max)(0.0f, 1.0f - remaining / inner);
+            for (int i = 0; i < polygon.count; i++)
+                polygon.vertices[i] = Scale(polygon.vertices[i], factor);
+        }
+    }
+    else
+    {
+        core.shape.radius = (std::max)(0.0f, fabsf(shape.radius) - inset);
+    }
+    return core;
+}
+
+// ========== 거리 ==========
+
+float TimeOfImpact::Distance(const QueryShape& a, const QueryShape& b, XMFLOAT2& outNormal)
+{
+    // 다각형/캡슐이 포함되면 둥근 볼록 다각형끼리 (박스 = 꼭짓점 4개, 원 = 꼭짓점 1개)
+    if (a.type == QueryShape::Type::Polygon || b.type == QueryShape::Type::Polygon)
+    {
+        ConvexPolygon polygonA;
+        ConvexPolygon polygonB;
+        a.ToPolygon(polygonA);
+        b.ToPolygon(polygonB);
+
+        XMFLOAT2 pointA;
+        return ConvexPolygon::Distance(polygonA, polygonB, outNormal, pointA);
+    }
+
+    bool boxA = a.type == QueryShape::Type::Box;
+    bool boxB = b.type == QueryShape::Type::Box;
+
+    if (boxA && boxB)
+        return DistanceBoxes(a, b, outNormal);
+
+    if (!boxA && !boxB)
+        return DistanceCircles(a, b, outNormal);
+
+    if (boxA)
+        return DistanceBoxCircle(a, b, outNormal);
+
+    // 원 ↔ 박스 (법선을 A → B로 뒤집음)
+    float distance = DistanceBoxCircle(b, a, outNormal);
+    outNormal = Scale(outNormal, -1.0f);
+    return distance;
+}
+
+// ========== Conservative Advancement ==========
+
+bool TimeOfImpact::Solve(const ShapeSweep& sweepA, const ShapeSweep& sweepB, float targetSeparation,
+                         float tolerance, TimeOfImpactResult& outResult)
+{
+    // 상대 이동과 회전으로 형태 위 점이 움직일 수 있는 최대 거리
+    XMFLOAT2 relativeTranslation = Sub(sweepA.translation, sweepB.translation);
+    float rotationReach = fabsf(sweepA.rotation) * sweepA.GetRotationReach() +
+                          fabsf(sweepB.rotation) * sweepB.GetRotationReach();
+
+    if (Length(relativeTranslation) + rotationReach <= 0.0001f)
+        return false;
+
+    XMFLOAT2 normal{ 0.0f, 1.0f };
+    float distance = Distance(sweepA.shape, sweepB.shape, normal);
+
+    // 시작부터 겹치면 이산 솔버 담당
+    outResult.overlapped = distance <= 0.0f;
+    if (outResult.overlapped)
+        return false;
+
+    // 이미 목표 거리 안쪽이면 (직전 충돌 후 붙어 있는 상태) 현재 거리의 절반을 목표로
+    // → 미끄러지는 접촉은 충돌로 보지 않고, 다가오는 경우만 더 붙기 전에 멈춤
+    if (distance <= targetSeparation + tolerance)
+    {
+        targetSeparation = 0.5f * distance;
+        tolerance = 0.25f * distance;
+    }
+
+    float t = 0.0f;
+
+    for (int iteration = 0; iteration < MaxIterations; iteration++)
+    {
+        if (iteration > 0)
+            distance = Distance(sweepA.GetShape(t), sweepB.GetShape(t), normal);
+
+        if (distance <= targetSeparation + tolerance)
+        {
+            outResult.fraction = t;
+            outResult.normal = normal;
+            return true;
+        }
+
+        // 최근접 방향으로 다가오는 최대 속도 (볼록 형태 거리는 이동에 대해 볼록 → 이만큼 전진해도 targetSeparation보다 가까워질 수 없음)
+        // 나란히 미끄러지는 접촉은 다가오는 성분이 없어 한 번에 넘어감
+        float approach = Dot(relativeTranslation, normal) + rotationReach;
+        if (approach <= 0.0001f)
+            return false;
+
+        t += (distance - targetSeparation) / approach;
+        if (t >= 1.0f)
+            return false;
+    }
+
+    // 반복 한도 (아직 닿지 않은 마지막 시점)
+    outResult.fraction = t;
+    outResult.normal = normal;
+    return true;
+}
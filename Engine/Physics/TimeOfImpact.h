@@ -0,0 +1,57 @@
+#pragma once
+#include <DirectXMath.h>
+#include "Physics/ShapeQuery.h"
+
+using namespace DirectX;
+
+// 한 스텝 동안 강체와 함께 움직이는 형태 (t = 0 → 1 선형 이동 + 회전)
+struct ShapeSweep
+{
+    QueryShape shape;                 // t = 0 월드 형태
+    XMFLOAT2 pivot{0.0f, 0.0f};       // 회전 중심 (t = 0 강체 위치)
+    XMFLOAT2 translation{0.0f, 0.0f}; // t = 0 → 1 이동량
+    float rotation = 0.0f;            // t = 0 → 1 회전량 (rad)
+
+    // t 시점 월드 형태
+    QueryShape GetShape(float t) const;
+
+    // t 시점부터 끝까지 남은 스윕 (t = 0으로 다시 매김)
+    ShapeSweep GetRemaining(float t) const;
+
+    // 회전 중심에서 형태 위 가장 먼 점까지 거리 (회전으로 움직이는 최대 거리 = |rotation| x 이 값)
+    float GetRotationReach() const;
+
+    // 스윕 동안 형태 위 점이 움직이는 최대 거리 (이동 + 회전)
+    float GetMotionReach() const;
+
+    // 형태의 가장 얇은 반 두께 (박스 짧은 반 크기, 원 반지름, 다각형 중심 ~ 가장 가까운 변 + 반지름)
+    float GetMinExtent() const;
+
+    // 형태를 inset만큼 안쪽으로 줄인 스윕 (얕게 겹친 상태에서도 중심부끼리는 거리를 잴 수 있음)
+    ShapeSweep GetCore(float inset) const;
+};
+
+// 충돌 시점 결과
+struct TimeOfImpactResult
+{
+    float fraction = 1.0f;            // 스윕 비율 (0~1)
+    XMFLOAT2 normal{0.0f, 1.0f};      // A → B (가장 가까운 방향)
+    bool overlapped = false;          // 시작부터 겹침 (Solve는 false)
+};
+
+// Conservative Advancement 충돌 시점 계산 (박스/원/다각형/캡슐 조합)
+// - 현재 거리를 최근접 방향 상대 이동량 + 회전 이동량으로 나눈 만큼 전진 (겹침 없이 접근)
+// - 거리가 targetSeparation + tolerance 이하가 되면 그 시점을 반환
+class TimeOfImpact
+{
+public:
+    // 두 형태 사이 최단 거리 (겹치면 0), outNormal = A → B
+    static float Distance(const QueryShape& a, const QueryShape& b, XMFLOAT2& outNormal);
+
+    // 처음 targetSeparation까지 가까워지는 시점 (닿지 않거나 시작부터 겹치면 false)
+    // 시작 거리가 이미 targetSeparation 이하면 시작 거리의 절반을 목표로 함
+    static bool Solve(const ShapeSweep& sweepA, const ShapeSweep& sweepB, float targetSeparation,
+                      float tolerance, TimeOfImpactResult& outResult);
+
+    static const int MaxIterations = 20;
+};
@@ -7,6 +7,9 @@
 #include "Graphics/Camera2D.h"
 #include "Physics/BoxCollider2D.h"
 #include "Physics/CircleCollider.h"
+#include "Physics/CapsuleCollider2D.h"
+#include "Physics/PolygonCollider2D.h"
+#include "Physics/TilemapCollider.h"
 #include "Physics/Rigidbody2D.h"
 #include "Core/Animator.h"
 #include "Animation/AnimatorController.h"
@@ -29,8 +32,8 @@ std::string SceneSerializer::WStringToString(const std::wstring& wstr)
     if (wstr.empty())
         return "";
     
-    //   (޸ )
-    if (wstr.length() > 65535) // 64KB 
+    // 길이 제한 (메모리 안전)
+    if (wstr.length() > 65535) // 64KB 제한
         return "";
     
     try
@@ -54,8 +57,8 @@ std::wstring SceneSerializer::StringToWString(const std::string& str)
     if (str.empty())
         return L"";
     
-    //   (޸ )
-    if (str.length() > 65535) // 64KB 
+    // 길이 제한 (메모리 안전)
+    if (str.length() > 65535) // 64KB 제한
         return L"";
     
     try
@@ -85,22 +88,30 @@ bool SceneSerializer::SaveScene(SceneBase* scene, const std::wstring& filePath)
         sceneData["sceneName"] = WStringToString(scene->GetCurrentSceneName());
         sceneData["gameObjects"] = json::array();
 
+        // 레이어 충돌 행렬 (행 = 레이어)
+        PhysicsSystem& physics = scene->GetPhysicsSystem();
+        sceneData["layerCollisionMatrix"] = json::array();
+        for (int layer = 0; layer < PhysicsSystem::MaxLayers; layer++)
+        {
+            sceneData["layerCollisionMatrix"].push_back(physics.GetLayerCollisionMask(layer));
+        }
+
         const auto& objects = scene->GetAllGameObjects();
         for (GameObject* obj : objects)
         {
-            // θ  Ʈ Ʈ ȭ (ڽ  Ե)
+            // 부모가 없는 루트 오브젝트만 직렬화 (자식은 재귀적으로 포함됨)
             if (obj && obj->GetParent() == nullptr)
             {
                 sceneData["gameObjects"].push_back(SerializeGameObject(obj));
             }
         }
 
-        // Ϸ 
+        // 파일로 저장
         std::ofstream file(filePath);
         if (!file.is_open())
             return false;
 
-        file << sceneData.dump(2); // 鿩 2ĭ
+        file << sceneData.dump(2); // 들여쓰기 2칸
         file.close();
 
         return true;
@@ -118,7 +129,7 @@ bool SceneSerializer::LoadScene(const std::wstring& filePath, SceneBase* scene,
 
     try
     {
-        //  б
+        // 파일 읽기
         std::ifstream file(filePath);
         if (!file.is_open())
             return false;
@@ -127,13 +138,23 @@ bool SceneSerializer::LoadScene(const std::wstring& filePath, SceneBase* scene,
         file >> sceneData;
         file.close();
 
-        //  ̸ 
+        // 씬 이름 설정
         if (sceneData.contains("sceneName"))
         {
-            // SceneBase ̸  Լ   Ƿ ϴ ŵ
+            // SceneBase는 이름 설정 함수가 없을 수도 있으므로 일단 스킵
+        }
+
+        // 레이어 충돌 행렬 복원 (없으면 기본값 = 전체 충돌)
+        if (sceneData.contains("layerCollisionMatrix"))
+        {
+            const auto& matrix = sceneData["layerCollisionMatrix"];
+            for (int layer = 0; layer < PhysicsSystem::MaxLayers && layer < static_cast<int>(matrix.size()); layer++)
+            {
+                scene->GetPhysicsSystem().SetLayerCollisionMask(layer, matrix[layer].get<uint32_t>());
+            }
         }
 
-        // GameObject ε
+        // GameObject 로드
         if (sceneData.contains("gameObjects"))
         {
             for (const auto& objData : sceneData["gameObjects"])
@@ -141,10 +162,10 @@ bool SceneSerializer::LoadScene(const std::wstring& filePath, SceneBase* scene,
                 GameObject* obj = DeserializeGameObject(objData, app, scene);
                 if (obj)
                 {
-                    // Ʈ ü  ߰ (ڽĵ鵵 ȭ)
+                    // 루트 객체를 씬에 추가 (자식들도 평면화됨)
                     scene->AddGameObject(obj);
                     
-                    // Canvas ,  ڽ uiObjects 籸
+                    // Canvas인 경우, 모든 자식을 uiObjects에 재구축
                     if (obj->GetComponent<Canvas>() != nullptr)
                     {
                         scene->RebuildCanvasUIObjectsList(obj);
@@ -168,12 +189,12 @@ json SceneSerializer::SerializeGameObject(GameObject* obj)
 
     json j;
     j["name"] = WStringToString(obj->GetName());
-    j["active"] = true; // GameObject IsActive()  true 
+    j["active"] = true; // GameObject에 IsActive()가 없으면 true로 고정
 
-    // Transform ȭ
+    // Transform 직렬화
     j["transform"] = SerializeTransform(obj);
 
-    // Components ȭ
+    // Components 직렬화
     j["components"] = json::array();
     const auto& components = obj->GetComponents();
     for (Component* comp : components)
@@ -188,7 +209,7 @@ json SceneSerializer::SerializeGameObject(GameObject* obj)
         }
     }
 
-    // ڽ GameObject ȭ
+    // 자식 GameObject 직렬화
     j["children"] = json::array();
     const auto& children = obj->GetChildren();
     for (GameObject* child : children)
@@ -210,29 +231,29 @@ GameObject* SceneSerializer::DeserializeGameObject(const json& j, Application* a
     GameObject* obj = new GameObject();
     obj->SetApplication(app);
 
-    // ̸ 
+    // 이름 설정
     if (j.contains("name"))
     {
         obj->SetName(StringToWString(j["name"]));
     }
 
-    // Transform ȭ
+    // Transform 역직렬화
     if (j.contains("transform"))
     {
         DeserializeTransform(obj, j["transform"]);
     }
 
-    // Components ȭ
+    // Components 역직렬화
     if (j.contains("components"))
     {
         for (const auto& compData : j["components"])
         {
             Component* comp = DeserializeComponent(compData, obj);
-            // DeserializeComponent ο AddComponent 
+            // DeserializeComponent 내부에서 AddComponent 됨
         }
     }
 
-    // ڽ GameObject ȭ
+    // 자식 GameObject 역직렬화
     if (j.contains("children"))
     {
         for (const auto& childData : j["children"])
@@ -240,8 +261,8 @@ GameObject* SceneSerializer::DeserializeGameObject(const json& j, Application* a
             GameObject* child = DeserializeGameObject(childData, app, scene);
             if (child)
             {
-                // ڽ  迭 ߰ ʰ, θ-ڽ 踸 
-                // GameObject Ҹڰ ڽĵ ڵ 
+                // 자식은 씬 배열에 추가하지 않고, 부모-자식 관계만 설정
+                // GameObject 소멸자가 자식들을 자동으로 정리함
                 child->SetParent(obj);
             }
         }
@@ -299,17 +320,17 @@ json SceneSerializer::SerializeComponent(Component* component)
     {
         j["type"] = "SpriteRenderer";
         
-        // ؽó ȭ (Asset )
+        // 텍스처 직렬화 (Asset 경로)
         if (auto texture = spr->GetTexture())
         {
-            // ü ο ̸  (Ȯ )
+            // 전체 경로에서 이름만 추출 (확장자 제외)
             std::wstring fullPath = texture->Path();
             size_t lastSlash = fullPath.find_last_of(L"/\\");
             std::wstring fileName = (lastSlash != std::wstring::npos) 
                 ? fullPath.substr(lastSlash + 1) 
                 : fullPath;
             
-            // Ȯ 
+            // 확장자 제거
             size_t lastDot = fileName.find_last_of(L".");
             if (lastDot != std::wstring::npos)
             {
@@ -319,7 +340,7 @@ json SceneSerializer::SerializeComponent(Component* component)
             j["texture"] = WStringToString(fileName);
         }
         
-        // Color ȭ
+        // Color 직렬화
         auto color = spr->GetColor();
         j["color"] = {
             {"r", color.x},
@@ -333,49 +354,118 @@ json SceneSerializer::SerializeComponent(Component* component)
     {
         j["type"] = "Camera2D";
         
-        // Ʈ ũ
+        // 뷰포트 크기
         j["viewportWidth"] = cam->GetViewportWidth();
         j["viewportHeight"] = cam->GetViewportHeight();
         
-        //   ( ī޶  )
+        // 줌 스케일 (에디터 카메라는 저장하지 않음)
         if (!cam->GetIsEditorCamera())
         {
             j["zoomScale"] = cam->GetZoomScale();
         }
         
-        //  ī޶ ġ GameObject Transform ̹ 
-        // Camera2D ü ġ  
+        // 게임 카메라의 위치는 GameObject Transform에 이미 저장됨
+        // Camera2D 자체의 위치는 저장하지 않음
     }
     // BoxCollider2D
     else if (auto* box = dynamic_cast<BoxCollider2D*>(component))
     {
         j["type"] = "BoxCollider2D";
         
-        // HalfSize 
+        // HalfSize 저장
         j["halfSize"] = {
             {"x", box->halfSize.x},
             {"y", box->halfSize.y}
         };
         
-        // Offset 
+        // Offset 저장
         auto offset = box->GetOffset();
         j["offset"] = { {"x", offset.x}, {"y", offset.y} };
         
         j["isTrigger"] = box->IsTrigger();
+        j["layer"] = box->GetLayer();
+        j["collisionMask"] = box->GetCollisionMask();
     }
     // CircleCollider
     else if (auto* circle = dynamic_cast<CircleCollider*>(component))
     {
         j["type"] = "CircleCollider";
         
-        // Radius 
+        // Radius 저장
         j["radius"] = circle->radius;
         
-        // Offset 
+        // Offset 저장
         auto offset = circle->GetOffset();
         j["offset"] = { {"x", offset.x}, {"y", offset.y} };
         
         j["isTrigger"] = circle->IsTrigger();
+        j["layer"] = circle->GetLayer();
+        j["collisionMask"] = circle->GetCollisionMask();
+    }
+    // PolygonCollider2D
+    else if (auto* polygon = dynamic_cast<PolygonCollider2D*>(component))
+    {
+        j["type"] = "PolygonCollider2D";
+        
+        // 로컬 꼭짓점 저장 (법선은 로드 시 다시 계산)
+        json points = json::array();
+        for (const auto& point : polygon->GetPoints())
+        {
+            points.push_back({ {"x", point.x}, {"y", point.y} });
+        }
+        j["points"] = points;
+        
+        auto offset = polygon->GetOffset();
+        j["offset"] = { {"x", offset.x}, {"y", offset.y} };
+        
+        j["isTrigger"] = polygon->IsTrigger();
+        j["layer"] = polygon->GetLayer();
+        j["collisionMask"] = polygon->GetCollisionMask();
+    }
+    // CapsuleCollider2D
+    else if (auto* capsule = dynamic_cast<CapsuleCollider2D*>(component))
+    {
+        j["type"] = "CapsuleCollider2D";
+        j["radius"] = capsule->radius;
+        j["height"] = capsule->height;
+        
+        auto offset = capsule->GetOffset();
+        j["offset"] = { {"x", offset.x}, {"y", offset.y} };
+        
+        j["isTrigger"] = capsule->IsTrigger();
+        j["layer"] = capsule->GetLayer();
+        j["collisionMask"] = capsule->GetCollisionMask();
+    }
+    // TilemapCollider
+    else if (auto* tilemap = dynamic_cast<TilemapCollider*>(component))
+    {
+        j["type"] = "TilemapCollider";
+        j["width"] = tilemap->GetWidth();
+        j["height"] = tilemap->GetHeight();
+        
+        auto tileSize = tilemap->GetTileSize();
+        j["tileSize"] = { {"x", tileSize.x}, {"y", tileSize.y} };
+        
+        auto origin = tilemap->GetOrigin();
+        j["origin"] = { {"x", origin.x}, {"y", origin.y} };
+        
+        j["layer"] = tilemap->GetLayer();
+        j["collisionMask"] = tilemap->GetCollisionMask();
+        
+        // 타일은 행마다 '0'/'1' 문자열로 저장 (합쳐진 사각형은 로드 시 다시 계산)
+        const auto& tiles = tilemap->GetTiles();
+        json rows = json::array();
+        for (int y = 0; y < tilemap->GetHeight(); y++)
+        {
+            std::string row(tilemap->GetWidth(), '0');
+            for (int x = 0; x < tilemap->GetWidth(); x++)
+            {
+                if (tiles[y * tilemap->GetWidth() + x])
+                    row[x] = '1';
+            }
+            rows.push_back(row);
+        }
+        j["rows"] = rows;
     }
     // Rigidbody2D
     else if (auto* rb = dynamic_cast<Rigidbody2D*>(component))
@@ -387,13 +477,14 @@ json SceneSerializer::SerializeComponent(Component* component)
         j["friction"] = rb->friction;
         j["useGravity"] = rb->useGravity;
         j["freezeRotation"] = rb->freezeRotation;
+        j["interpolate"] = rb->interpolate;
     }
     // Animator
     else if (auto* animator = dynamic_cast<Animator*>(component))
     {
         j["type"] = "Animator";
         
-        // AnimatorController ȭ
+        // AnimatorController 직렬화
         if (auto controller = animator->GetController())
         {
             std::wstring fullPath = controller->Path();
@@ -448,7 +539,7 @@ json SceneSerializer::SerializeComponent(Component* component)
             j["texture"] = WStringToString(fileName);
         }
         
-        // Color ȭ
+        // Color 직렬화
         auto color = image->GetColor();
         j["color"] = {
             {"r", color.x},
@@ -462,7 +553,7 @@ json SceneSerializer::SerializeComponent(Component* component)
     {
         j["type"] = "Button";
         
-        // Button Image ϹǷ Image  
+        // Button은 Image를 상속하므로 Image 정보도 저장
         if (auto texture = button->GetTexture())
         {
             std::wstring fullPath = texture->Path();
@@ -480,7 +571,7 @@ json SceneSerializer::SerializeComponent(Component* component)
             j["texture"] = WStringToString(fileName);
         }
         
-        // Color 
+        // Color 저장
         auto color = button->GetColor();
         j["color"] = {
             {"r", color.x},
@@ -507,7 +598,7 @@ json SceneSerializer::SerializeComponent(Component* component)
     else if (auto* audioSource = dynamic_cast<AudioSource*>(component))
     {
         j["type"] = "AudioSource";
-        // AudioSource API ̹Ƿ type 
+        // AudioSource API가 제한적이므로 type만 저장
     }
     // Script Component (custom user scripts)
     else
@@ -548,7 +639,7 @@ Component* SceneSerializer::DeserializeComponent(const json& j, GameObject* obj)
     {
         auto* spr = obj->AddComponent<SpriteRenderer>();
         
-        // ؽó ε
+        // 텍스처 로드
         if (j.contains("texture"))
         {
             try
@@ -566,11 +657,11 @@ Component* SceneSerializer::DeserializeComponent(const json& j, GameObject* obj)
             }
             catch (...)
             {
-                // ؽó ε  - ϰ 
+                // 텍스처 로드 실패 - 무시하고 진행
             }
         }
         
-        // Color 
+        // Color 복원
         if (j.contains("color"))
         {
             XMFLOAT4 color;
@@ -587,7 +678,7 @@ Component* SceneSerializer::DeserializeComponent(const json& j, GameObject* obj)
     {
         auto* cam = obj->AddComponent<Camera2D>();
         
-        // Ʈ ũ 
+        // 뷰포트 크기 복원
         if (j.contains("viewportWidth") && j.contains("viewportHeight"))
         {
             float width = j["viewportWidth"];
@@ -596,11 +687,11 @@ Component* SceneSerializer::DeserializeComponent(const json& j, GameObject* obj)
         }
         else
         {
-            // Ʈ ũⰡ    ⺻ 
+            // 뷰포트 크기가 저장되지 않은 경우 기본값 사용
             cam->SetViewportSize(800.0f, 600.0f);
         }
         
-        //    (Ǿ ִ 츸)
+        // 줌 스케일 복원 (저장되어 있는 경우만)
         if (j.contains("zoomScale"))
         {
             float zoom = j["zoomScale"];
@@ -613,14 +704,14 @@ Component* SceneSerializer::DeserializeComponent(const json& j, GameObject* obj)
     {
         auto* box = obj->AddComponent<BoxCollider2D>();
         
-        // HalfSize 
+        // HalfSize 복원
         if (j.contains("halfSize"))
         {
             box->halfSize.x = j["halfSize"]["x"];
             box->halfSize.y = j["halfSize"]["y"];
         }
         
-        // Offset 
+        // Offset 복원
         if (j.contains("offset"))
         {
             box->SetOffset(j["offset"]["x"], j["offset"]["y"]);
@@ -631,19 +722,30 @@ Component* SceneSerializer::DeserializeComponent(const json& j, GameObject* obj)
             box->SetTrigger(j["isTrigger"]);
         }
         
+        // 충돌 레이어 복원
+        if (j.contains("layer"))
+        {
+            box->SetLayer(j["layer"]);
+        }
+        
+        if (j.contains("collisionMask"))
+        {
+            box->SetCollisionMask(j["collisionMask"].get<uint32_t>());
+        }
+        
         return box;
     }
     else if (type == "CircleCollider")
     {
         auto* circle = obj->AddComponent<CircleCollider>();
         
-        // Radius 
+        // Radius 복원
         if (j.contains("radius"))
         {
             circle->radius = j["radius"];
         }
         
-        // Offset 
+        // Offset 복원
         if (j.contains("offset"))
         {
             circle->SetOffset(j["offset"]["x"], j["offset"]["y"]);
@@ -654,8 +756,137 @@ Component* SceneSerializer::DeserializeComponent(const json& j, GameObject* obj)
             circle->SetTrigger(j["isTrigger"]);
         }
         
+        // 충돌 레이어 복원
+        if (j.contains("layer"))
+        {
+            circle->SetLayer(j["layer"]);
+        }
+        
+        if (j.contains("collisionMask"))
+        {
+            circle->SetCollisionMask(j["collisionMask"].get<uint32_t>());
+        }
+        
         return circle;
     }
+    else if (type == "PolygonCollider2D")
+    {
+        auto* polygon = obj->AddComponent<PolygonCollider2D>();
+        
+        // 꼭짓점 복원 (볼록 껍질 3~8개가 아니면 기본 박스 유지)
+        if (j.contains("points"))
+        {
+            std::vector<XMFLOAT2> points;
+            for (const auto& point : j["points"])
+            {
+                points.push_back({ point["x"].get<float>(), point["y"].get<float>() });
+            }
+            polygon->SetPoints(points);
+        }
+        
+        if (j.contains("offset"))
+        {
+            polygon->SetOffset(j["offset"]["x"], j["offset"]["y"]);
+        }
+        
+        if (j.contains("isTrigger"))
+        {
+            polygon->SetTrigger(j["isTrigger"]);
+        }
+        
+        if (j.contains("layer"))
+        {
+            polygon->SetLayer(j["layer"]);
+        }
+        
+        if (j.contains("collisionMask"))
+        {
+            polygon->SetCollisionMask(j["collisionMask"].get<uint32_t>());
+        }
+        
+        return polygon;
+    }
+    else if (type == "CapsuleCollider2D")
+    {
+        auto* capsule = obj->AddComponent<CapsuleCollider2D>();
+        
+        if (j.contains("radius"))
+        {
+            capsule->radius = j["radius"];
+        }
+        
+        if (j.contains("height"))
+        {
+            capsule->height = j["height"];
+        }
+        
+        if (j.contains("offset"))
+        {
+            capsule->SetOffset(j["offset"]["x"], j["offset"]["y"]);
+        }
+        
+        if (j.contains("isTrigger"))
+        {
+            capsule->SetTrigger(j["isTrigger"]);
+        }
+        
+        if (j.contains("layer"))
+        {
+            capsule->SetLayer(j["layer"]);
+        }
+        
+        if (j.contains("collisionMask"))
+        {
+            capsule->SetCollisionMask(j["collisionMask"].get<uint32_t>());
+        }
+        
+        return capsule;
+    }
+    else if (type == "TilemapCollider")
+    {
+        auto* tilemap = obj->AddComponent<TilemapCollider>();
+        
+        int width = j.contains("width") ? j["width"].get<int>() : 0;
+        int height = j.contains("height") ? j["height"].get<int>() : 0;
+        tilemap->SetGridSize(width, height);
+        
+        if (j.contains("tileSize"))
+        {
+            tilemap->SetTileSize({ j["tileSize"]["x"].get<float>(), j["tileSize"]["y"].get<float>() });
+        }
+        
+        if (j.contains("origin"))
+        {
+            tilemap->SetOrigin({ j["origin"]["x"].get<float>(), j["origin"]["y"].get<float>() });
+        }
+        
+        // 충돌 레이어 복원
+        if (j.contains("layer"))
+        {
+            tilemap->SetLayer(j["layer"]);
+        }
+        
+        if (j.contains("collisionMask"))
+        {
+            tilemap->SetCollisionMask(j["collisionMask"].get<uint32_t>());
+        }
+        
+        // 타일 복원 후 한 번에 합침
+        if (j.contains("rows"))
+        {
+            std::vector<uint8_t> tiles(static_cast<size_t>(width) * height, 0);
+            const auto& rows = j["rows"];
+            for (int y = 0; y < height && y < static_cast<int>(rows.size()); y++)
+            {
+                std::string row = rows[y].get<std::string>();
+                for (int x = 0; x < width && x < static_cast<int>(row.size()); x++)
+                    tiles[y * width + x] = (row[x] == '1') ? 1 : 0;
+            }
+            tilemap->SetTiles(tiles);
+        }
+        
+        return tilemap;
+    }
     else if (type == "Rigidbody2D")
     {
         auto* rb = obj->AddComponent<Rigidbody2D>();
@@ -666,6 +897,7 @@ Component* SceneSerializer::DeserializeComponent(const json& j, GameObject* obj)
         if (j.contains("friction")) rb->friction = j["friction"];
         if (j.contains("useGravity")) rb->useGravity = j["useGravity"];
         if (j.contains("freezeRotation")) rb->freezeRotation = j["freezeRotation"];
+        if (j.contains("interpolate")) rb->interpolate = j["interpolate"];
         
         return rb;
     }
@@ -673,7 +905,7 @@ Component* SceneSerializer::DeserializeComponent(const json& j, GameObject* obj)
     {
         auto* animator = obj->AddComponent<Animator>();
         
-        // AnimatorController ε
+        // AnimatorController 로드
         if (j.contains("controller"))
         {
             try
@@ -751,7 +983,7 @@ Component* SceneSerializer::DeserializeComponent(const json& j, GameObject* obj)
             }
         }
         
-        // Color 
+        // Color 복원
         if (j.contains("color"))
         {
             image->SetColor(
@@ -768,7 +1000,7 @@ Component* SceneSerializer::DeserializeComponent(const json& j, GameObject* obj)
     {
         auto* button = obj->AddComponent<Button>();
         
-        // Button Image ϹǷ ؽó ε
+        // Button은 Image를 상속하므로 텍스처 로드
         if (j.contains("texture"))
         {
             try
@@ -789,7 +1021,7 @@ Component* SceneSerializer::DeserializeComponent(const json& j, GameObject* obj)
             }
         }
         
-        // Color ε
+        // Color 로드
         if (j.contains("color"))
         {
             button->SetColor(
@@ -826,7 +1058,7 @@ Component* SceneSerializer::DeserializeComponent(const json& j, GameObject* obj)
     else if (type == "AudioSource")
     {
         auto* audioSource = obj->AddComponent<AudioSource>();
-        // AudioSource API ̹Ƿ  
+        // AudioSource API가 제한적이므로 복원 생략
         return audioSource;
     }
     else if (type == "Script")
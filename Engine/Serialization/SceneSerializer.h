@@ -10,32 +10,32 @@ class Application;
 
 using json = nlohmann::json;
 
-//  JSON Ϸ /εϴ ȭ Ŭ
+// 씬을 JSON 파일로 저장/로드하는 직렬화 클래스
 class SceneSerializer
 {
 public:
-    //  Ϸ 
+    // 씬을 파일로 저장
     static bool SaveScene(SceneBase* scene, const std::wstring& filePath);
     
-    // Ͽ  ε
+    // 파일에서 씬 로드
     static bool LoadScene(const std::wstring& filePath, SceneBase* scene, Application* app);
     
-    // GameObject JSON ȭ
+    // GameObject를 JSON으로 직렬화
     static json SerializeGameObject(GameObject* obj);
     
-    // JSON GameObject ȭ (scene Ű ߰)
+    // JSON에서 GameObject 역직렬화 (scene 매개변수 추가)
     static GameObject* DeserializeGameObject(const json& j, Application* app, SceneBase* scene = nullptr);
     
-    // ڿ ȯ ƿƼ
+    // 문자열 변환 유틸리티
     static std::string WStringToString(const std::wstring& wstr);
     static std::wstring StringToWString(const std::string& str);
 
 private:
-    // Transform ȭ
+    // Transform 직렬화
     static json SerializeTransform(GameObject* obj);
     static void DeserializeTransform(GameObject* obj, const json& j);
     
-    // Component ȭ
+    // Component 직렬화
     static json SerializeComponent(Component* component);
     static Component* DeserializeComponent(const json& j, GameObject* obj);
 };
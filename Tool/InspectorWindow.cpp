@@ -4,6 +4,8 @@
 #include "Graphics/Camera2D.h"
 #include "Physics/BoxCollider2D.h"
 #include "Physics/CircleCollider.h"
+#include "Physics/CapsuleCollider2D.h"
+#include "Physics/PolygonCollider2D.h"
 #include "Physics/Rigidbody2D.h"
 #include "Core/Animator.h"
 #include "Animation/AnimatorController.h"
@@ -35,6 +37,51 @@ static std::string WStringToString(const std::wstring& wstr)
     return result;
 }
 
+// Collider layer / collision mask editing (shared by all collider types)
+static void RenderColliderLayers(BaseCollider* collider, const char* idSuffix)
+{
+    std::string suffix = std::string("##") + idSuffix;
+
+    int layer = collider->GetLayer();
+    if (ImGui::SliderInt(("Layer" + suffix).c_str(), &layer, 0, 31))
+    {
+        collider->SetLayer(layer);
+    }
+
+    // 浹  ̾ (8 üũڽ)
+    if (ImGui::TreeNode(("Collision Mask" + suffix).c_str()))
+    {
+        unsigned int mask = collider->GetCollisionMask();
+        bool changed = false;
+
+        for (int bit = 0; bit < 32; bit++)
+        {
+            if (bit % 8 != 0)
+                ImGui::SameLine();
+
+            std::string label = std::to_string(bit) + suffix + std::to_string(bit);
+            changed |= ImGui::CheckboxFlags(label.c_str(), &mask, 1u << bit);
+        }
+
+        if (ImGui::SmallButton(("All" + suffix).c_str()))
+        {
+            mask = 0xFFFFFFFFu;
+            changed = true;
+        }
+        ImGui::SameLine();
+        if (ImGui::SmallButton(("None" + suffix).c_str()))
+        {
+            mask = 0;
+            changed = true;
+        }
+
+        if (changed)
+            collider->SetCollisionMask(mask);
+
+        ImGui::TreePop();
+    }
+}
+
 InspectorWindow::InspectorWindow()
     : EditorWindow("Inspector", true) // ⺻ 
 {
@@ -404,6 +451,9 @@ void InspectorWindow::RenderComponents(GameObject* obj)
                 boxCollider->SetTrigger(isTrigger);
             }
             
+            // Layer / Collision Mask
+            RenderColliderLayers(boxCollider, "BoxCollider");
+            
             // Fit To Texture button
             if (ImGui::Button("Fit To Texture##BoxCollider"))
             {
@@ -434,6 +484,9 @@ void InspectorWindow::RenderComponents(GameObject* obj)
                 circleCollider->SetTrigger(isTrigger);
             }
             
+            // Layer / Collision Mask
+            RenderColliderLayers(circleCollider, "CircleCollider");
+            
             // Fit To Texture button
             if (ImGui::Button("Fit To Texture##CircleCollider"))
             {
@@ -441,6 +494,96 @@ void InspectorWindow::RenderComponents(GameObject* obj)
             }
         }
         
+        // PolygonCollider2D Ư ó
+        if (auto* polygonCollider = dynamic_cast<PolygonCollider2D*>(comp))
+        {
+            // Points (  3~8 ƴϰ Ǵ  õ)
+            std::vector<XMFLOAT2> points = polygonCollider->GetPoints();
+            bool pointsChanged = false;
+            for (size_t i = 0; i < points.size(); i++)
+            {
+                std::string label = "Point " + std::to_string(i) + "##PolygonCollider";
+                if (ImGui::DragFloat2(label.c_str(), &points[i].x, 0.5f, -10000.0f, 10000.0f))
+                {
+                    pointsChanged = true;
+                }
+            }
+            
+            //     ߰ /   
+            if (points.size() < ConvexPolygon::MaxVertices && ImGui::Button("Add Point##PolygonCollider"))
+            {
+                XMFLOAT2 first = points.front();
+                XMFLOAT2 last = points.back();
+                XMFLOAT2 middle = { (first.x + last.x) * 0.5f, (first.y + last.y) * 0.5f };
+                
+                //  ٱ  о   
+                points.push_back({ middle.x + (first.y - last.y) * 0.1f, middle.y - (first.x - last.x) * 0.1f });
+                pointsChanged = true;
+            }
+            
+            if (points.size() > 3)
+            {
+                ImGui::SameLine();
+                if (ImGui::Button("Remove Point##PolygonCollider"))
+                {
+                    points.pop_back();
+                    pointsChanged = true;
+                }
+            }
+            
+            if (pointsChanged)
+            {
+                polygonCollider->SetPoints(points);
+            }
+            
+            // Offset
+            auto offset = polygonCollider->GetOffset();
+            if (ImGui::DragFloat2("Offset##PolygonCollider", &offset.x, 0.5f, -10000.0f, 10000.0f))
+            {
+                polygonCollider->SetOffset(offset.x, offset.y);
+            }
+            
+            // Is Trigger checkbox
+            bool isTrigger = polygonCollider->IsTrigger();
+            if (ImGui::Checkbox("Is Trigger##PolygonCollider", &isTrigger))
+            {
+                polygonCollider->SetTrigger(isTrigger);
+            }
+            
+            // Layer / Collision Mask
+            RenderColliderLayers(polygonCollider, "PolygonCollider");
+        }
+        
+        // CapsuleCollider2D Ư ó
+        if (auto* capsuleCollider = dynamic_cast<CapsuleCollider2D*>(comp))
+        {
+            ImGui::DragFloat("Radius##CapsuleCollider", &capsuleCollider->radius, 0.5f, 0.1f, 10000.0f);
+            ImGui::DragFloat("Height##CapsuleCollider", &capsuleCollider->height, 0.5f, 0.1f, 10000.0f);
+            
+            // Offset
+            auto offset = capsuleCollider->GetOffset();
+            if (ImGui::DragFloat2("Offset##CapsuleCollider", &offset.x, 0.5f, -10000.0f, 10000.0f))
+            {
+                capsuleCollider->SetOffset(offset.x, offset.y);
+            }
+            
+            // Is Trigger checkbox
+            bool isTrigger = capsuleCollider->IsTrigger();
+            if (ImGui::Checkbox("Is Trigger##CapsuleCollider", &isTrigger))
+            {
+                capsuleCollider->SetTrigger(isTrigger);
+            }
+            
+            // Layer / Collision Mask
+            RenderColliderLayers(capsuleCollider, "CapsuleCollider");
+            
+            // Fit To Texture button
+            if (ImGui::Button("Fit To Texture##CapsuleCollider"))
+            {
+                capsuleCollider->FitToTexture();
+            }
+        }
+        
         // Rigidbody2D Ư ó
         if (auto* rigidbody = dynamic_cast<Rigidbody2D*>(comp))
         {
@@ -450,6 +593,7 @@ void InspectorWindow::RenderComponents(GameObject* obj)
             ImGui::DragFloat("Friction", &rigidbody->friction, 0.01f, 0.0f, 1.0f);
             ImGui::Checkbox("Use Gravity", &rigidbody->useGravity);
             ImGui::Checkbox("Freeze Rotation", &rigidbody->freezeRotation);
+            ImGui::Checkbox("Interpolate", &rigidbody->interpolate);
         }
 
         // Animator Ư ó
@@ -719,6 +863,16 @@ void InspectorWindow::RenderComponents(GameObject* obj)
             obj->AddComponent<CircleCollider>();
         }
         
+        if (ImGui::Selectable("PolygonCollider2D"))
+        {
+            obj->AddComponent<PolygonCollider2D>();
+        }
+        
+        if (ImGui::Selectable("CapsuleCollider2D"))
+        {
+            obj->AddComponent<CapsuleCollider2D>();
+        }
+        
         if (ImGui::Selectable("Rigidbody2D"))
         {
             obj->AddComponent<Rigidbody2D>();